@@ -2,8 +2,8 @@
 
 // Define possible BaudRate-Array
 const uint32_t possibleBaudRates[12] = {
-    (uint32_t)5E3,      // Not allowed for ClockRate 25MHz and 40MHz
-    (uint32_t)10E3,     // Not allowed for ClockRate 40MHz
+    (uint32_t)5E3,      // Not possible for ClockRate 20MHz, 25MHz and 40MHz (Prescaler out of range)
+    (uint32_t)10E3,     // Not possible for ClockRate 40MHz (Prescaler out of range)
     (uint32_t)20E3,
     (uint32_t)40E3,
     (uint32_t)50E3,
@@ -13,7 +13,7 @@ const uint32_t possibleBaudRates[12] = {
     (uint32_t)200E3,
     (uint32_t)250E3,
     (uint32_t)500E3,
-    (uint32_t)1000E3,   // Not allowed for ClockRate 8MHz
+    (uint32_t)1000E3,   // Not possible for ClockRate 8MHz and 25MHz (min. 5 TQ / Deviation of the Bitrate)
 };
 
 // Define possible ClockFrequency-Array
@@ -164,9 +164,9 @@ uint8_t testInit(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     Serial.println(".4: Test undefined Baudrates in init-Function");
     uint32_t undefinedBaudrates[4] = {
         (uint32_t)0,
-        (uint32_t)6e3,
-        (uint32_t)110e3,
+        (uint32_t)500,
         (uint32_t)1100e3,
+        (uint32_t)2000e3,
     };
 
     for (size_t i = 0; i < 4; i++)
@@ -215,14 +215,25 @@ uint8_t testInit(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     return Errors;
 };
 
-uint8_t testSetSpiPins(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+uint8_t testInitConfig(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
     uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
+    const uint32_t Ids[2] = {0x123, 0x124};
+    const bool Extended[2] = {false, false};
+
     uint8_t Errors = 0;
+    MCP2515InitConfig Config = {};
+    MCP2515Snapshot Snapshot;
+
+    Config.baudRate = defaultBaudrate;
+    Config.interrupts = CANINTE_BIT_RXnIE(0) | CANINTE_BIT_RXnIE(1);
+    Config.rollover = true;
+    Config.operationMode = MCP2515_OP_NORMAL;
+    Config.reCheckEnabled = true;
 
     delay(500);
     if (Module.getIsInitialized())
@@ -232,47 +243,127 @@ uint8_t testSetSpiPins(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettin
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setSpiPins-Function");
+    Serial.println(": Test init-Function with a Configuration");
 
     delay(1000);
 
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setSpiPins-Function when not initialized");
+    Serial.println(".1: Test init-Function with a Configuration when initialized");
 
-    if (!Module.setSpiPins(CS_Pin))
+    if (Module.init(Config) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_IS_INITIALIZED) != ERROR_MCP2515_IS_INITIALIZED))
     {
-        Serial.println("\t- Failed. Setting SPI-Pin not successfull");
+        Serial.print("\t- Failed. Init successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
-    
+
     delay(1000);
-    
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setSpiPins-Function when initialized");
+    Serial.println(".2: Test init-Function with an invalid Configuration");
 
-    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
-        delay(100);
+    Module.deinit();
+    delay(500);
+
+    Config.operationMode = 5;
+
+    if (Module.init(Config) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
+    {
+        Serial.print("\t- Failed. Init successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Config.operationMode = MCP2515_OP_NORMAL;
+        Config.baudRate = 0;
+
+        if (Module.init(Config) ||
+            ((Module.getLastMCPError() & ERROR_MCP2515_INIT_CHANGE_BITTIMING) != ERROR_MCP2515_INIT_CHANGE_BITTIMING) ||
+            Module.getIsInitialized())
+        {
+            Serial.print("\t- Failed. Init successfull or failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
     }
 
-    if (Module.setSpiPins(CS_Pin))
+    Config.operationMode = MCP2515_OP_NORMAL;
+    Config.baudRate = defaultBaudrate;
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test init-Function with a Configuration without Filters");
+
+    if (!Module.init(Config) ||
+        !Module.getIsInitialized() ||
+        (Module.getOperationMode() != MCP2515_OP_NORMAL) ||
+        (Module.getBaudRate() != defaultBaudrate) ||
+        !Module.captureSnapshot(Snapshot) ||
+        (Snapshot.registers[6] != Config.interrupts) ||
+        (Snapshot.registers[7] != (RXBnCTRL_BIT_RXM | RXBnCTRL_BIT_BUFFER0_BUKT)) ||
+        (Snapshot.registers[8] != RXBnCTRL_BIT_RXM))
     {
-        Serial.println("\t- Failed. Setting SPI-Pin successfull in initialized Mode");
+        Serial.print("\t- Failed. Init not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
 
     delay(1000);
-    
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test init-Function with a Configuration with Filters and the Listen-Only-Mode");
+
     Module.deinit();
+    delay(500);
+
+    Config.filtersEnabled = Module.compileFilters(Ids, Extended, 2, Config.filters);
+    Config.operationMode = MCP2515_OP_LISTEN;
+    Config.oneShotMode = true;
+
+    if (!Config.filtersEnabled ||
+        !Module.init(Config) ||
+        (Module.getOperationMode() != MCP2515_OP_LISTEN) ||
+        !Module.getOneShotMode() ||
+        !Module.captureSnapshot(Snapshot) ||
+        (Snapshot.registers[7] != RXBnCTRL_BIT_BUFFER0_BUKT) ||
+        (Snapshot.registers[8] != 0x00) ||
+        (Snapshot.filters[0] != (uint8_t)(Config.filters.filters[0] >> 21)))
+    {
+        Serial.print("\t- Failed. Init not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
     delay(1000);
-    Module.setSpiPins(CS_Pin);
-    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Module.deinit();
+    delay(500);
+
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
     Serial.print(Errors, DEC);
@@ -283,7 +374,8 @@ uint8_t testSetSpiPins(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettin
     return Errors;
 };
 
-uint8_t testSetSpiMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+#ifdef MCP2515_ENABLE_ERROR_LOG
+uint8_t testErrorLog(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
@@ -291,74 +383,85 @@ uint8_t testSetSpiMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettin
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
     uint8_t Errors = 0;
+    MCP2515ErrorEvent Event;
 
     delay(500);
     if (Module.getIsInitialized())
     {
         Module.deinit();
-        delay(1000);
     }
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setSpiMode-Function");
+    Serial.println(": Test Error-Log");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setSpiMode-Function when not initialized");
+    Serial.println(".1: Test Error-Log when not initialized");
 
-    if (!Module.setSpiMode(SPI_MODE0))
+    Module.clearErrorEvents();
+    Module.setNormalMode();
+
+    if ((Module.getErrorEventCount() != 1) ||
+        !Module.getErrorEvent(0, Event) ||
+        (Event.code != Module.getLastMCPError()) ||
+        ((Event.code & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED) ||
+        (Event.context != MCP2515_CONTEXT_OPERATION_MODE) ||
+        Event.registersValid)
     {
-        Serial.println("\t- Failed. Setting SPI-Mode not successfull");
+        Serial.print("\t- Failed. Error-Event not stored. Count = ");
+        Serial.println(Module.getErrorEventCount(), DEC);
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setSpiMode-Function when initialized");
-
     while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
         delay(100);
     }
 
-    if (Module.setSpiMode(SPI_MODE0))
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test Error-Log with successful Calls");
+
+    Module.clearErrorEvents();
+
+    if (!Module.setNormalMode() ||
+        (Module.check4FreeTransmitBuffer() == 0xFF) ||
+        (Module.getErrorEventCount() != 0) ||
+        Module.getErrorEvent(0, Event))
     {
-        Serial.println("\t- Failed. Setting SPI-Mode successfull in initialized Mode");
+        Serial.print("\t- Failed. Error-Event stored for a successful Call. Count = ");
+        Serial.println(Module.getErrorEventCount(), DEC);
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
 
-    delay(500);
-    Module.deinit();
-    delay(500);
+    delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setSpiMode-Function with allowed Values");
-    Serial.print(Teststep, DEC);
-    Serial.println(".3.1: Set SPI-Mode 0");
-    if (!Module.setSpiMode(SPI_MODE0))
-    {
-        Serial.println("\t- Failed. Setting SPI-Mode SPI_MODE0 not successfull");
-        Errors++;
-    } else {
-        Serial.println("\t- passed");
-    }
+    Serial.println(".3: Test Error-Log with an Error in a nested Call");
 
-    delay(500);
+    Module.clearErrorEvents();
+    Module.changeBaudRate(1);
 
-    Serial.print(Teststep, DEC);
-    Serial.println(".3.2: Set SPI-Mode 3");
-    if (!Module.setSpiMode(SPI_MODE3))
+    if ((Module.getErrorEventCount() != 1) ||
+        !Module.getErrorEvent(0, Event) ||
+        (Event.code != Module.getLastMCPError()) ||
+        (Event.code == EMPTY_VALUE_16_BIT) ||
+        (Event.context != MCP2515_CONTEXT_SETTINGS) ||
+        !Event.registersValid ||
+        ((Event.canStatus >> 5) != Module.getOperationMode()))
     {
-        Serial.println("\t- Failed. Setting SPI-Mode SPI_MODE3 not successfull");
+        Serial.print("\t- Failed. Error-Event not stored once. Count = ");
+        Serial.println(Module.getErrorEventCount(), DEC);
         Errors++;
     } else {
         Serial.println("\t- passed");
@@ -368,33 +471,48 @@ uint8_t testSetSpiMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettin
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".4: Test setSpiMode-Function with not allowed Values");
-    Serial.print(Teststep, DEC);
-    Serial.println(".4.1: Set SPI-Mode 1");
-    if (Module.setSpiMode(SPI_MODE1))
+    Serial.println(".4: Test Error-Log when the Ring is full");
+
+    for (uint8_t i = 0; i < MCP2515_ERROR_LOG_SIZE + 2; i++)
     {
-        Serial.println("\t- Failed. Setting SPI-Mode SPI_MODE1 successfull");
+        Module.sendMessage(3);
+    }
+
+    if ((Module.getErrorEventCount() != MCP2515_ERROR_LOG_SIZE) ||
+        (Module.getErrorEventTotal() != MCP2515_ERROR_LOG_SIZE + 3) ||
+        Module.getErrorEvent(MCP2515_ERROR_LOG_SIZE, Event) ||
+        !Module.getErrorEvent(MCP2515_ERROR_LOG_SIZE - 1, Event) ||
+        (Event.context != MCP2515_CONTEXT_TRANSMISSION) ||
+        ((Event.code & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
+    {
+        Serial.print("\t- Failed. Oldest Error-Event not overwritten. Total = ");
+        Serial.println(Module.getErrorEventTotal(), DEC);
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
 
-    delay(500);
+    delay(1000);
 
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".4.2: Set SPI-Mode 2");
-    if (Module.setSpiMode(SPI_MODE2))
+    Serial.println(".5: Test clearErrorEvents-Function");
+
+    Module.clearErrorEvents();
+
+    if ((Module.getErrorEventCount() != 0) ||
+        (Module.getErrorEventTotal() != 0))
     {
-        Serial.println("\t- Failed. Setting SPI-Mode SPI_MODE2 successfull");
+        Serial.println("\t- Failed. Error-Log not cleared");
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
 
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    delay(1000);
-    Module.setSpiMode(SPI_MODE0);
     delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(500);
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
     Serial.print(Errors, DEC);
@@ -403,10 +521,11 @@ uint8_t testSetSpiMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettin
     delay(1000);
 
     return Errors;
-};
-
+}
+#endif
 
-uint8_t testSetDataOrder(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+uint8_t testPerformanceCounters(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
@@ -414,6 +533,7 @@ uint8_t testSetDataOrder(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSett
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
     uint8_t Errors = 0;
+    MCP2515PerformanceCounters Counters;
 
     delay(500);
     if (Module.getIsInitialized())
@@ -423,17 +543,28 @@ uint8_t testSetDataOrder(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSett
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setDataOrder-Function");
+    Serial.println(": Test Performance-Counters");
 
     delay(1000);
 
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setDataOrder-Function when not initialized");
+    Serial.println(".1: Test resetPerformanceCounters-Function");
 
-    if (!Module.setDataOrder(MSBFIRST))
+    Module.resetPerformanceCounters();
+    Module.getPerformanceCounters(Counters);
+
+    if ((Counters.spiTransactions != 0) ||
+        (Counters.spiBytes != 0) ||
+        (Counters.readbacks != 0) ||
+        (Counters.contextCalls[MCP2515_CONTEXT_OPERATION_MODE] != 0))
     {
-        Serial.println("\t- Failed. Setting DataOrder not successfull");
+        Serial.println("\t- Failed. Performance-Counters not reset");
         Errors++;
     } else {
         Serial.println("\t- passed");
@@ -443,32 +574,54 @@ uint8_t testSetDataOrder(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSett
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setDataOrder-Function when initialized");
+    Serial.println(".2: Test SPI-Counters and Call-Counters");
 
-    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
-        delay(100);
-    }
+    Module.resetPerformanceCounters();
 
-    if (Module.setDataOrder(MSBFIRST))
+    if (!Module.setConfigurationMode())
     {
-        Serial.println("\t- Failed. Setting DataOrder successfull in initialized Mode");
+        Serial.print("\t- Failed. Setting Configuration-Mode not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
     } else {
-        Serial.println("\t- passed");
+        Module.getPerformanceCounters(Counters);
+
+        if ((Counters.spiTransactions == 0) ||
+            (Counters.spiBytes < 2 * Counters.spiTransactions) ||
+            (Counters.contextCalls[MCP2515_CONTEXT_OPERATION_MODE] != 1))
+        {
+            Serial.print("\t- Failed. SPI-Transactions = ");
+            Serial.print(Counters.spiTransactions, DEC);
+            Serial.print(", SPI-Bytes = ");
+            Serial.print(Counters.spiBytes, DEC);
+            Serial.print(", Calls = ");
+            Serial.println(Counters.contextCalls[MCP2515_CONTEXT_OPERATION_MODE], DEC);
+            Errors++;
+        } else {
+            Serial.print("\t- passed (");
+            Serial.print(Counters.spiTransactions, DEC);
+            Serial.print(" SPI-Transactions, ");
+            Serial.print(Counters.spiBytes, DEC);
+            Serial.print(" Bytes, ");
+            Serial.print(Counters.contextTime[MCP2515_CONTEXT_OPERATION_MODE], DEC);
+            Serial.println(" us)");
+        }
     }
 
-    delay(500);
-    Module.deinit();
-    delay(500);
+    delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setDataOrder-Function with allowed Values");
-    Serial.print(Teststep, DEC);
-    Serial.println(".3.1: Set DataOrder MSBFIRST");
-    if (!Module.setDataOrder(MSBFIRST))
+    Serial.println(".3: Test Call-Counters with nested public Calls");
+
+    Module.resetPerformanceCounters();
+    Module.changeBaudRate(defaultBaudrate);
+    Module.getPerformanceCounters(Counters);
+
+    if ((Counters.contextCalls[MCP2515_CONTEXT_SETTINGS] != 1) ||
+        (Counters.contextCalls[MCP2515_CONTEXT_OPERATION_MODE] != 0))
     {
-        Serial.println("\t- Failed. Setting DataOrder MSBFIRST not successfull");
+        Serial.println("\t- Failed. Nested public Calls counted");
         Errors++;
     } else {
         Serial.println("\t- passed");
@@ -478,21 +631,36 @@ uint8_t testSetDataOrder(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSett
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".4: Test setDataOrder-Function with not allowed Values");
-    Serial.print(Teststep, DEC);
-    Serial.println(".4.1: Set DataOrder LSBFIRST");
-    if (Module.setDataOrder(LSBFIRST))
+    Serial.println(".4: Test Readback-Counter");
+
+    Module.setReCheckEnabler(false);
+    Module.resetPerformanceCounters();
+    Module.changeInterruptSetting(true, 1);
+    Module.getPerformanceCounters(Counters);
+
+    uint32_t Readbacks = Counters.readbacks;
+
+    Module.setReCheckEnabler(true);
+    Module.resetPerformanceCounters();
+    Module.changeInterruptSetting(false, 1);
+    Module.getPerformanceCounters(Counters);
+
+    if ((Readbacks != 0) ||
+        (Counters.readbacks == 0))
     {
-        Serial.println("\t- Failed. Setting DataOrder LSBFIRST successfull");
+        Serial.print("\t- Failed. Readbacks without ReCheck = ");
+        Serial.print(Readbacks, DEC);
+        Serial.print(", with ReCheck = ");
+        Serial.println(Counters.readbacks, DEC);
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
 
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    delay(1000);
-    Module.setSpiMode(MSBFIRST);
     delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(500);
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
     Serial.print(Errors, DEC);
@@ -501,30 +669,27 @@ uint8_t testSetDataOrder(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSett
     delay(1000);
 
     return Errors;
-};
-
+}
+#endif
 
-uint8_t testSetSpiFrequency(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
-    
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+uint8_t testLatencyHistograms(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
     uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
-    uint32_t allowedSPIFrequencys[4] = {
-        (uint32_t)1e6,
-        (uint32_t)2e6,
-        (uint32_t)8e6,
-        (uint32_t)10e6,
-    };
-
-    uint32_t unallowedSPIFrequencys[2] = {
-        (uint32_t)5e3,
-        (uint32_t)11e6,
-    };
-
     uint8_t Errors = 0;
+    uint8_t Data[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    MCP2515LatencyHistogram Start;
+    MCP2515LatencyHistogram Complete;
+
+    uint32_t ID_Receive = 0;
+    bool Extended_Receive = false;
+    bool RTR_Receive = false;
+    uint8_t DLC_Receive = 0;
+    uint8_t Data_Receive[8];
 
     delay(500);
     if (Module.getIsInitialized())
@@ -534,96 +699,118 @@ uint8_t testSetSpiFrequency(uint8_t Teststep, MCP2515 &Module, uint32_t defaultS
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setSpiFrequency-Function");
+    Serial.println(": Test Latency-Histograms");
 
     delay(1000);
 
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setSpiFrequency-Function when not initialized");
+    Serial.println(".1: Test resetLatencyHistograms-Function");
 
-    if (!Module.setSpiFrequency(defaultSPIFrequency))
+    Module.resetLatencyHistograms();
+    Module.getLatencyHistogram(MCP2515_LATENCY_ENQUEUE_TO_TX_START, Start);
+
+    if ((Start.count != 0) ||
+        (Module.getLatencyPercentile(MCP2515_LATENCY_ENQUEUE_TO_TX_START, 99) != 0) ||
+        Module.getLatencyHistogram(MCP2515_LATENCY_HISTOGRAMS, Start))
     {
-        Serial.println("\t- Failed. Setting SpiFrequency not successfull");
+        Serial.println("\t- Failed. Latency-Histograms not reset");
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setSpiFrequency-Function when initialized");
+    Serial.println(".2: Test TX-Latencies in Loopback-Mode");
 
-    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+    Serial.println("\t- Set OperationMode Loopback");
+    while (!Module.setLoopbackMode()){
         delay(100);
     }
 
-    if (Module.setSpiFrequency(defaultSPIFrequency))
+    Module.resetLatencyHistograms();
+
+    if (!Module.fillTransmitBuffer(0, 0x100, false, false, 8, Data) ||
+        !Module.sendMessage(0))
     {
-        Serial.println("\t- Failed. Setting SpiFrequency successfull in initialized Mode");
+        Serial.print("\t- Failed. Send Message not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
     } else {
-        Serial.println("\t- passed");
-    }
+        Module.getLatencyHistogram(MCP2515_LATENCY_ENQUEUE_TO_TX_START, Start);
+        Module.getLatencyHistogram(MCP2515_LATENCY_ENQUEUE_TO_TX_COMPLETE, Complete);
 
-    delay(500);
-    Module.deinit();
+        if ((Start.count != 1) ||
+            (Complete.count != 1) ||
+            (Complete.min < Start.min) ||
+            (Module.getLatencyPercentile(MCP2515_LATENCY_ENQUEUE_TO_TX_COMPLETE, 99) != Complete.max))
+        {
+            Serial.print("\t- Failed. TX-Start-Count = ");
+            Serial.print(Start.count, DEC);
+            Serial.print(", TX-Complete-Count = ");
+            Serial.println(Complete.count, DEC);
+            Errors++;
+        } else {
+            Serial.print("\t- passed (TX-Start ");
+            Serial.print(Start.max, DEC);
+            Serial.print(" us, TX-Complete ");
+            Serial.print(Complete.max, DEC);
+            Serial.println(" us)");
+        }
+    }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setSpiFrequency-Function with allowed Values");
+    Serial.println(".3: Test RX-Latencies in Loopback-Mode");
 
-    for (size_t i = 0; i < 4; i++)
+    Module.captureInterrupt();
+
+    if (!(Module.check4InterruptFlags() & 0x01) ||
+        !Module.getAllFromReceiveBuffer(0, ID_Receive, Extended_Receive, RTR_Receive, DLC_Receive, Data_Receive))
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".3.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Set SpiFrequency ");
-        Serial.print(allowedSPIFrequencys[i]/1000000, DEC);
-        Serial.println("MHz");
-        if (!Module.setSpiFrequency(allowedSPIFrequencys[i]))
+        Serial.print("\t- Failed. Receive Message not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Module.getLatencyHistogram(MCP2515_LATENCY_INT_TO_AVAILABLE, Start);
+        Module.getLatencyHistogram(MCP2515_LATENCY_AVAILABLE_TO_CONSUMED, Complete);
+
+        if ((Start.count != 1) ||
+            (Complete.count != 1))
         {
-            Serial.println("\t- Failed. Setting SpiFrequency not successfull");
+            Serial.print("\t- Failed. INT-Count = ");
+            Serial.print(Start.count, DEC);
+            Serial.print(", Consumed-Count = ");
+            Serial.println(Complete.count, DEC);
             Errors++;
         } else {
             Serial.println("\t- passed");
         }
-        delay(500);
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".4: Test setSpiFrequency-Function with not allowed Values");
+    Serial.println(".4: Test printLatencyHistograms-Function");
 
-    for (size_t i = 0; i < 2; i++)
-    {
-        Serial.print(Teststep, DEC);
-        Serial.print(".4.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Set SpiFrequency ");
-        Serial.print(unallowedSPIFrequencys[i]/1000000, DEC);
-        Serial.println("MHz");
-        if (Module.setSpiFrequency(unallowedSPIFrequencys[i]))
-        {
-            Serial.println("\t- Failed. Setting SpiFrequency successfull");
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
-        delay(500);
-    }
+    Module.printLatencyHistograms(Serial);
+    Serial.println("\t- passed");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Module.setSpiFrequency(defaultSPIFrequency);
-    delay(1000);
+    delay(500);
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
     Serial.print(Errors, DEC);
@@ -632,23 +819,16 @@ uint8_t testSetSpiFrequency(uint8_t Teststep, MCP2515 &Module, uint32_t defaultS
     delay(1000);
 
     return Errors;
-};
-
-uint8_t testSetClockFrequency(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+}
+#endif
 
+uint8_t testSetSpiPins(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
     uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
-    uint32_t unallowedClockFrequencys[4] = {
-        (uint32_t)5e6,
-        (uint32_t)11e6,
-        (uint32_t)20e6,
-        (uint32_t)45e6,
-    };
-
     uint8_t Errors = 0;
 
     delay(500);
@@ -659,106 +839,46 @@ uint8_t testSetClockFrequency(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setClockFrequency-Function");
+    Serial.println(": Test setSpiPins-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setClockFrequency-Function when not initialized");
+    Serial.println(".1: Test setSpiPins-Function when not initialized");
 
-    if (!Module.setClockFrequency(defaultClockFrequency))
+    if (!Module.setSpiPins(CS_Pin))
     {
-        Serial.println("\t- Failed. Setting ClockFrequency not successfull");
+        Serial.println("\t- Failed. Setting SPI-Pin not successfull");
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
     
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
     
-    delay(500);
-
-    if (!Module.setSpiFrequency(defaultSPIFrequency)){
-        Serial.println("\t- Setting SPI-Frequency failed.");
-    }
-    if (!Module.setSpiPins(CS_Pin)){
-        Serial.println("\t- Setting SPI-Pin failed.");
-    }
-
-    delay(500);
-
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setClockFrequency-Function when initialized");
+    Serial.println(".2: Test setSpiPins-Function when initialized");
 
     while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
         delay(100);
     }
 
-    if (Module.setClockFrequency(defaultClockFrequency))
+    if (Module.setSpiPins(CS_Pin))
     {
-        Serial.println("\t- Failed. Setting ClockFrequency successfull in initialized Mode");
+        Serial.println("\t- Failed. Setting SPI-Pin successfull in initialized Mode");
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
 
-    delay(500);
-    Module.deinit();
-
-    delay(1000);
-
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setClockFrequency-Function with allowed Values");
-
-    for (size_t i = 0; i < 4; i++)
-    {
-        Serial.print(Teststep, DEC);
-        Serial.print(".3.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Set ClockFrequency ");
-        Serial.print(possibleClockFrequency[i]/1000000, DEC);
-        Serial.println("MHz");
-        if (!Module.setClockFrequency(possibleClockFrequency[i]))
-        {
-            Serial.println("\t- Failed. Setting ClockFrequency not successfull");
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
-        delay(500);
-    }
-
     delay(1000);
-
+    
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".4: Test setClockFrequency-Function with not allowed Values");
-
-    for (size_t i = 0; i < 4; i++)
-    {
-        Serial.print(Teststep, DEC);
-        Serial.print(".4.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Set ClockFrequency ");
-        Serial.print(unallowedClockFrequencys[i]/1000000, DEC);
-        Serial.println("MHz");
-        if (Module.setClockFrequency(unallowedClockFrequencys[i]))
-        {
-            Serial.println("\t- Failed. Setting ClockFrequency successfull");
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
-        delay(500);
-    }
-
+    Module.deinit();
     delay(1000);
-
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Module.setClockFrequency(defaultClockFrequency);
+    Module.setSpiPins(CS_Pin);
     delay(1000);
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
@@ -770,7 +890,7 @@ uint8_t testSetClockFrequency(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     return Errors;
 };
 
-uint8_t testSetConfigurationMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+uint8_t testSetSpiMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
@@ -783,90 +903,105 @@ uint8_t testSetConfigurationMode(uint8_t Teststep, MCP2515 &Module, uint32_t def
     if (Module.getIsInitialized())
     {
         Module.deinit();
+        delay(1000);
     }
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setConfigurationMode-Function");
+    Serial.println(": Test setSpiMode-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setConfigurationMode-Function when not initialized");
+    Serial.println(".1: Test setSpiMode-Function when not initialized");
 
-    if (Module.setConfigurationMode()){
-        Serial.println("\t- Failed. Setting ConfigurationMode successfull");
+    if (!Module.setSpiMode(SPI_MODE0))
+    {
+        Serial.println("\t- Failed. Setting SPI-Mode not successfull");
         Errors++;
-        delay(500);
-        Module.setNormalMode();
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
-        {
-            Serial.print("\t- Failed. Setting ConfigurationMode failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
+        Serial.println("\t- passed");
     }
     
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test setSpiMode-Function when initialized");
+
     while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
         delay(100);
     }
 
+    if (Module.setSpiMode(SPI_MODE0))
+    {
+        Serial.println("\t- Failed. Setting SPI-Mode successfull in initialized Mode");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(500);
+    Module.deinit();
     delay(500);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setConfigurationMode-Function when initialized");
-    
-    if (!Module.setConfigurationMode())
+    Serial.println(".3: Test setSpiMode-Function with allowed Values");
+    Serial.print(Teststep, DEC);
+    Serial.println(".3.1: Set SPI-Mode 0");
+    if (!Module.setSpiMode(SPI_MODE0))
     {
-        Serial.print("\t- Failed. Setting ConfigurationMode not successfull in initialized Mode with Error 0x");
-        Serial.println(Module.getLastMCPError(), HEX);
+        Serial.println("\t- Failed. Setting SPI-Mode SPI_MODE0 not successfull");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(".3.2: Set SPI-Mode 3");
+    if (!Module.setSpiMode(SPI_MODE3))
+    {
+        Serial.println("\t- Failed. Setting SPI-Mode SPI_MODE3 not successfull");
         Errors++;
     } else {
         Serial.println("\t- passed");
-        Module.setNormalMode();
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setConfigurationMode-Function with wrong CS-Pin Configuration");
-    
-    delay(500);
-    pinMode(CS_Pin, INPUT_PULLUP);
+    Serial.println(".4: Test setSpiMode-Function with not allowed Values");
+    Serial.print(Teststep, DEC);
+    Serial.println(".4.1: Set SPI-Mode 1");
+    if (Module.setSpiMode(SPI_MODE1))
+    {
+        Serial.println("\t- Failed. Setting SPI-Mode SPI_MODE1 successfull");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
     delay(500);
 
-    if (Module.setConfigurationMode())
+    Serial.print(Teststep, DEC);
+    Serial.println(".4.2: Set SPI-Mode 2");
+    if (Module.setSpiMode(SPI_MODE2))
     {
-        Serial.println("\t- Failed. Setting ConfigurationMode successfull with wrong CS-Pin Configuration");
+        Serial.println("\t- Failed. Setting SPI-Mode SPI_MODE2 successfull");
         Errors++;
-        Module.setNormalMode();
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_OPERATION_MODE_NOT_SET) != ERROR_MCP2515_OPERATION_MODE_NOT_SET)
-        {
-            Serial.print("\t- Failed. Setting ConfigurationMode failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
+        Serial.println("\t- passed");
     }
 
-    delay(1000);
-
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    pinMode(CS_Pin, OUTPUT);
-    delay(500);
-    Module.setNormalMode();
-    delay(500);
+    delay(1000);
+    Module.setSpiMode(SPI_MODE0);
+    delay(1000);
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
     Serial.print(Errors, DEC);
@@ -875,9 +1010,10 @@ uint8_t testSetConfigurationMode(uint8_t Teststep, MCP2515 &Module, uint32_t def
     delay(1000);
 
     return Errors;
-}
+};
 
-uint8_t testSetNormalMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+
+uint8_t testSetDataOrder(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
@@ -894,90 +1030,76 @@ uint8_t testSetNormalMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSet
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setNormalMode-Function");
+    Serial.println(": Test setDataOrder-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setNormalMode-Function when not initialized");
+    Serial.println(".1: Test setDataOrder-Function when not initialized");
 
-    if (Module.setNormalMode()){
-        Serial.println("\t- Failed. Setting NormalMode successfull");
+    if (!Module.setDataOrder(MSBFIRST))
+    {
+        Serial.println("\t- Failed. Setting DataOrder not successfull");
         Errors++;
-        delay(500);
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
-        {
-            Serial.print("\t- Failed. Setting NormalMode failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test setDataOrder-Function when initialized");
+
     while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
         delay(100);
     }
-    while (!Module.setConfigurationMode()){
-        delay(100);
-    }
-
-    delay(500);
 
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setNormalMode-Function when initialized");
-    
-    if (!Module.setNormalMode())
+    if (Module.setDataOrder(MSBFIRST))
     {
-        Serial.print("\t- Failed. Setting NormalMode not successfull in initialized Mode with Error 0x");
-        Serial.println(Module.getLastMCPError(), HEX);
+        Serial.println("\t- Failed. Setting DataOrder successfull in initialized Mode");
         Errors++;
     } else {
         Serial.println("\t- passed");
     }
 
-    delay(1000);
+    delay(500);
+    Module.deinit();
+    delay(500);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setNormalMode-Function with wrong CS-Pin Configuration");
-
-    while (!Module.setConfigurationMode()){
-        delay(100);
-    }
-    
-    delay(500);
-    pinMode(CS_Pin, INPUT_PULLUP);
-    delay(500);
-
-    if (Module.setNormalMode())
+    Serial.println(".3: Test setDataOrder-Function with allowed Values");
+    Serial.print(Teststep, DEC);
+    Serial.println(".3.1: Set DataOrder MSBFIRST");
+    if (!Module.setDataOrder(MSBFIRST))
     {
-        Serial.println("\t- Failed. Setting NormalMode successfull with wrong CS-Pin Configuration");
+        Serial.println("\t- Failed. Setting DataOrder MSBFIRST not successfull");
         Errors++;
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_OPERATION_MODE_NOT_SET) != ERROR_MCP2515_OPERATION_MODE_NOT_SET)
-        {
-            Serial.print("\t- Failed. Setting NormalMode failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
+        Serial.println("\t- passed");
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    pinMode(CS_Pin, OUTPUT);
-    delay(500);
-    Module.setNormalMode();
-    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test setDataOrder-Function with not allowed Values");
+    Serial.print(Teststep, DEC);
+    Serial.println(".4.1: Set DataOrder LSBFIRST");
+    if (Module.setDataOrder(LSBFIRST))
+    {
+        Serial.println("\t- Failed. Setting DataOrder LSBFIRST successfull");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Module.setSpiMode(MSBFIRST);
+    delay(1000);
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
     Serial.print(Errors, DEC);
@@ -986,15 +1108,29 @@ uint8_t testSetNormalMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSet
     delay(1000);
 
     return Errors;
-}
+};
 
-uint8_t testSetListenOnlyMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+
+uint8_t testSetSpiFrequency(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
     uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
+    uint32_t allowedSPIFrequencys[4] = {
+        (uint32_t)1e6,
+        (uint32_t)2e6,
+        (uint32_t)8e6,
+        (uint32_t)10e6,
+    };
+
+    uint32_t unallowedSPIFrequencys[2] = {
+        (uint32_t)5e3,
+        (uint32_t)11e6,
+    };
+
     uint8_t Errors = 0;
 
     delay(500);
@@ -1005,86 +1141,96 @@ uint8_t testSetListenOnlyMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setListenOnlyMode-Function");
+    Serial.println(": Test setSpiFrequency-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setListenOnlyMode-Function when not initialized");
+    Serial.println(".1: Test setSpiFrequency-Function when not initialized");
 
-    if (Module.setListenOnlyMode()){
-        Serial.println("\t- Failed. Setting ListenOnlyMode successfull");
+    if (!Module.setSpiFrequency(defaultSPIFrequency))
+    {
+        Serial.println("\t- Failed. Setting SpiFrequency not successfull");
         Errors++;
-        delay(500);
-        Module.setNormalMode();
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
-        {
-            Serial.print("\t- Failed. Setting ListenOnlyMode failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
+        Serial.println("\t- passed");
     }
     
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test setSpiFrequency-Function when initialized");
+
     while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
         delay(100);
     }
 
+    if (Module.setSpiFrequency(defaultSPIFrequency))
+    {
+        Serial.println("\t- Failed. Setting SpiFrequency successfull in initialized Mode");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
     delay(500);
+    Module.deinit();
+
+    delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setListenOnlyMode-Function when initialized");
-    
-    if (!Module.setListenOnlyMode())
+    Serial.println(".3: Test setSpiFrequency-Function with allowed Values");
+
+    for (size_t i = 0; i < 4; i++)
     {
-        Serial.print("\t- Failed. Setting ListenOnlyMode not successfull in initialized Mode with Error 0x");
-        Serial.println(Module.getLastMCPError(), HEX);
-        Errors++;
-    } else {
-        Serial.println("\t- passed");
-        Module.setNormalMode();
+        Serial.print(Teststep, DEC);
+        Serial.print(".3.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Set SpiFrequency ");
+        Serial.print(allowedSPIFrequencys[i]/1000000, DEC);
+        Serial.println("MHz");
+        if (!Module.setSpiFrequency(allowedSPIFrequencys[i]))
+        {
+            Serial.println("\t- Failed. Setting SpiFrequency not successfull");
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+        delay(500);
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setListenOnlyMode-Function with wrong CS-Pin Configuration");
-    
-    delay(500);
-    pinMode(CS_Pin, INPUT_PULLUP);
-    delay(500);
+    Serial.println(".4: Test setSpiFrequency-Function with not allowed Values");
 
-    if (Module.setListenOnlyMode())
+    for (size_t i = 0; i < 2; i++)
     {
-        Serial.println("\t- Failed. Setting ListenOnlyMode successfull with wrong CS-Pin Configuration");
-        Errors++;
-        Module.setNormalMode();
-    } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_OPERATION_MODE_NOT_SET) != ERROR_MCP2515_OPERATION_MODE_NOT_SET)
+        Serial.print(Teststep, DEC);
+        Serial.print(".4.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Set SpiFrequency ");
+        Serial.print(unallowedSPIFrequencys[i]/1000000, DEC);
+        Serial.println("MHz");
+        if (Module.setSpiFrequency(unallowedSPIFrequencys[i]))
         {
-            Serial.print("\t- Failed. Setting ListenOnlyMode failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
+            Serial.println("\t- Failed. Setting SpiFrequency successfull");
             Errors++;
         } else {
             Serial.println("\t- passed");
         }
+        delay(500);
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    pinMode(CS_Pin, OUTPUT);
-    delay(500);
-    Module.setNormalMode();
-    delay(500);
+    Module.setSpiFrequency(defaultSPIFrequency);
+    delay(1000);
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
     Serial.print(Errors, DEC);
@@ -1093,15 +1239,23 @@ uint8_t testSetListenOnlyMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     delay(1000);
 
     return Errors;
-}
+};
+
+uint8_t testSetClockFrequency(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
 
-uint8_t testSetLoopbackMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
     uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
+    uint32_t unallowedClockFrequencys[4] = {
+        (uint32_t)0,
+        (uint32_t)500e3,
+        (uint32_t)41e6,
+        (uint32_t)45e6,
+    };
+
     uint8_t Errors = 0;
 
     delay(500);
@@ -1112,102 +1266,123 @@ uint8_t testSetLoopbackMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultS
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setLoopbackMode-Function");
+    Serial.println(": Test setClockFrequency-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setLoopbackMode-Function when not initialized");
+    Serial.println(".1: Test setClockFrequency-Function when not initialized");
 
-    if (Module.setLoopbackMode()){
-        Serial.println("\t- Failed. Setting LoopbackMode successfull");
+    if (!Module.setClockFrequency(defaultClockFrequency))
+    {
+        Serial.println("\t- Failed. Setting ClockFrequency not successfull");
         Errors++;
-        delay(500);
-        Module.setNormalMode();
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
-        {
-            Serial.print("\t- Failed. Setting LoopbackMode failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
+        Serial.println("\t- passed");
     }
     
-    delay(1000);
-
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
-        delay(100);
+    
+    delay(500);
+
+    if (!Module.setSpiFrequency(defaultSPIFrequency)){
+        Serial.println("\t- Setting SPI-Frequency failed.");
+    }
+    if (!Module.setSpiPins(CS_Pin)){
+        Serial.println("\t- Setting SPI-Pin failed.");
     }
 
     delay(500);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setLoopbackMode-Function when initialized");
-    
-    if (!Module.setLoopbackMode())
+    Serial.println(".2: Test setClockFrequency-Function when initialized");
+
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    if (Module.setClockFrequency(defaultClockFrequency))
     {
-        Serial.print("\t- Failed. Setting LoopbackMode not successfull in initialized Mode with Error 0x");
-        Serial.println(Module.getLastMCPError(), HEX);
+        Serial.println("\t- Failed. Setting ClockFrequency successfull in initialized Mode");
         Errors++;
     } else {
         Serial.println("\t- passed");
-        Module.setNormalMode();
     }
 
+    delay(500);
+    Module.deinit();
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setLoopbackMode-Function with wrong CS-Pin Configuration");
-    
-    delay(500);
-    pinMode(CS_Pin, INPUT_PULLUP);
-    delay(500);
+    Serial.println(".3: Test setClockFrequency-Function with allowed Values");
 
-    if (Module.setLoopbackMode())
+    for (size_t i = 0; i < 4; i++)
     {
-        Serial.println("\t- Failed. Setting LoopbackMode successfull with wrong CS-Pin Configuration");
-        Errors++;
-        Module.setNormalMode();
-    } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_OPERATION_MODE_NOT_SET) != ERROR_MCP2515_OPERATION_MODE_NOT_SET)
+        Serial.print(Teststep, DEC);
+        Serial.print(".3.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Set ClockFrequency ");
+        Serial.print(possibleClockFrequency[i]/1000000, DEC);
+        Serial.println("MHz");
+        if (!Module.setClockFrequency(possibleClockFrequency[i]))
         {
-            Serial.print("\t- Failed. Setting LoopbackMode failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
+            Serial.println("\t- Failed. Setting ClockFrequency not successfull");
             Errors++;
         } else {
             Serial.println("\t- passed");
         }
+        delay(500);
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    pinMode(CS_Pin, OUTPUT);
-    delay(500);
-    Module.setNormalMode();
-    delay(500);
     Serial.print(Teststep, DEC);
-    Serial.print(": Tests executed with ");
-    Serial.print(Errors, DEC);
-    Serial.println(" error.");
-    Serial.println();
-    delay(1000);
-
-    return Errors;
-}
-
-uint8_t testSetSleepMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
-    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
-    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
-    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
-    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
-    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+    Serial.println(".4: Test setClockFrequency-Function with not allowed Values");
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".4.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Set ClockFrequency ");
+        Serial.print(unallowedClockFrequencys[i]/1000000, DEC);
+        Serial.println("MHz");
+        if (Module.setClockFrequency(unallowedClockFrequencys[i]))
+        {
+            Serial.println("\t- Failed. Setting ClockFrequency successfull");
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+        delay(500);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Module.setClockFrequency(defaultClockFrequency);
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+};
+
+uint8_t testSetConfigurationMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
     uint8_t Errors = 0;
 
@@ -1219,25 +1394,23 @@ uint8_t testSetSleepMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSett
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setSleepMode-Function");
+    Serial.println(": Test setConfigurationMode-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setSleepMode-Function when not initialized");
+    Serial.println(".1: Test setConfigurationMode-Function when not initialized");
 
-    if (Module.setSleepMode()){
-        Serial.println("\t- Failed. Setting SleepMode successfull");
+    if (Module.setConfigurationMode()){
+        Serial.println("\t- Failed. Setting ConfigurationMode successfull");
         Errors++;
         delay(500);
-        Module.setInterruptFlag(6);
-        delay(1000);
         Module.setNormalMode();
     } else {
         if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
         {
-            Serial.print("\t- Failed. Setting SleepMode failed with the wrong Error 0x");
+            Serial.print("\t- Failed. Setting ConfigurationMode failed with the wrong Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
         } else {
@@ -1252,49 +1425,41 @@ uint8_t testSetSleepMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSett
         delay(100);
     }
 
-    delay(1000);
-    Module.resetInterruptFlag(6);
+    delay(500);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setSleepMode-Function when initialized");
+    Serial.println(".2: Test setConfigurationMode-Function when initialized");
     
-    if (!Module.setSleepMode())
+    if (!Module.setConfigurationMode())
     {
-        Serial.print("\t- Failed. Setting SleepMode not successfull in initialized Mode with Error 0x");
+        Serial.print("\t- Failed. Setting ConfigurationMode not successfull in initialized Mode with Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
     } else {
         Serial.println("\t- passed");
-        delay(500);
-        Module.setInterruptFlag(6);
-        delay(1000);
         Module.setNormalMode();
     }
 
     delay(1000);
-    Module.resetInterruptFlag(6);
-    
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setSleepMode-Function with wrong CS-Pin Configuration");
+    Serial.println(".3: Test setConfigurationMode-Function with wrong CS-Pin Configuration");
     
     delay(500);
     pinMode(CS_Pin, INPUT_PULLUP);
     delay(500);
 
-    if (Module.setSleepMode())
+    if (Module.setConfigurationMode())
     {
-        Serial.println("\t- Failed. Setting SleepMode successfull with wrong CS-Pin Configuration");
+        Serial.println("\t- Failed. Setting ConfigurationMode successfull with wrong CS-Pin Configuration");
         Errors++;
-        delay(500);
-        Module.setInterruptFlag(6);
-        delay(1000);
         Module.setNormalMode();
     } else {
         if ((Module.getLastMCPError() & ERROR_MCP2515_OPERATION_MODE_NOT_SET) != ERROR_MCP2515_OPERATION_MODE_NOT_SET)
         {
-            Serial.print("\t- Failed. Setting SleepMode failed with the wrong Error 0x");
+            Serial.print("\t- Failed. Setting ConfigurationMode failed with the wrong Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
         } else {
@@ -1319,7 +1484,7 @@ uint8_t testSetSleepMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSett
     return Errors;
 }
 
-uint8_t testSetReCheckEnabler(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+uint8_t testSetNormalMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
@@ -1336,21 +1501,22 @@ uint8_t testSetReCheckEnabler(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test setReCheckEnabler-Function");
+    Serial.println(": Test setNormalMode-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test setReCheckEnabler-Function when not initialized");
+    Serial.println(".1: Test setNormalMode-Function when not initialized");
 
-    if (Module.setReCheckEnabler(false)){
-        Serial.println("\t- Failed. Setting ReCheckEnabler successfull");
-        Errors++;    
+    if (Module.setNormalMode()){
+        Serial.println("\t- Failed. Setting NormalMode successfull");
+        Errors++;
+        delay(500);
     } else {
         if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
         {
-            Serial.print("\t- Failed. Setting ReCheckEnabler failed with the wrong Error 0x");
+            Serial.print("\t- Failed. Setting NormalMode failed with the wrong Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
         } else {
@@ -1364,14 +1530,19 @@ uint8_t testSetReCheckEnabler(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
         delay(100);
     }
+    while (!Module.setConfigurationMode()){
+        delay(100);
+    }
+
+    delay(500);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test setReCheckEnabler-Function when initialized");
+    Serial.println(".2: Test setNormalMode-Function when initialized");
     
-    if (!Module.setReCheckEnabler(true))
+    if (!Module.setNormalMode())
     {
-        Serial.print("\t- Failed. Setting ReCheckEnabler not successfull in initialized Mode with Error 0x");
+        Serial.print("\t- Failed. Setting NormalMode not successfull in initialized Mode with Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
     } else {
@@ -1379,41 +1550,64 @@ uint8_t testSetReCheckEnabler(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     }
 
     delay(1000);
-    
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test setReCheckEnabler-Function with defined Values");
-    Serial.println(".3.1: Set ReCheckEnabler true");
+    Serial.println(".3: Test getLastModeTransitionTime-Function");
 
-    if (!Module.setReCheckEnabler(true))
+    while (!Module.setConfigurationMode()){
+        delay(100);
+    }
+
+    // Request and Polling of CANSTAT take at least one SPI-Transaction each
+    if (!Module.setNormalMode() ||
+        (Module.getLastModeTransitionTime() == 0) ||
+        (Module.getLastModeTransitionTime() > (MCP2515_MODE_TRANSITION_TIMEOUT + (MCP2515_MAX_FRAME_BITS * 1000000UL) / defaultBaudrate)))
     {
-        Serial.print("\t- Failed. Setting ReCheckEnabler true failed with Error 0x");
+        Serial.print("\t- Failed. Transition-Time ");
+        Serial.print(Module.getLastModeTransitionTime(), DEC);
+        Serial.print("us with Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
-        
     } else {
         Serial.println("\t- passed");
     }
 
-    delay(500);
+    delay(1000);
 
-    Serial.println(".3.2: Set ReCheckEnabler false");
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test setNormalMode-Function with wrong CS-Pin Configuration");
 
-    if (!Module.setReCheckEnabler(false))
+    while (!Module.setConfigurationMode()){
+        delay(100);
+    }
+    
+    delay(500);
+    pinMode(CS_Pin, INPUT_PULLUP);
+    delay(500);
+
+    if (Module.setNormalMode())
     {
-        Serial.print("\t- Failed. Setting ReCheckEnabler false failed with Error 0x");
-        Serial.println(Module.getLastMCPError(), HEX);
+        Serial.println("\t- Failed. Setting NormalMode successfull with wrong CS-Pin Configuration");
         Errors++;
-        
     } else {
-        Serial.println("\t- passed");
+        if ((Module.getLastMCPError() & ERROR_MCP2515_OPERATION_MODE_NOT_SET) != ERROR_MCP2515_OPERATION_MODE_NOT_SET)
+        {
+            Serial.print("\t- Failed. Setting NormalMode failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    pinMode(CS_Pin, OUTPUT);
     delay(500);
-    Module.setReCheckEnabler(true);
+    Module.setNormalMode();
     delay(500);
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
@@ -1425,15 +1619,13 @@ uint8_t testSetReCheckEnabler(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     return Errors;
 }
 
-
-uint8_t testChangeBaudRate(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+uint8_t testSetListenOnlyMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
     uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
-    uint8_t possibleBaudrateCounter = 0;
-    
+
     uint8_t Errors = 0;
 
     delay(500);
@@ -1444,374 +1636,3319 @@ uint8_t testChangeBaudRate(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSe
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test changeBaudRate-Function (not stable)");
+    Serial.println(": Test setListenOnlyMode-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test changeBaudRate-Function when not initialized");
+    Serial.println(".1: Test setListenOnlyMode-Function when not initialized");
 
-    if (Module.changeBaudRate(possibleBaudRates[possibleBaudrateCounter])){
-        if (possibleBaudRates[possibleBaudrateCounter] == MCP2515_DEFAULT_BAUDRATE)
+    if (Module.setListenOnlyMode()){
+        Serial.println("\t- Failed. Setting ListenOnlyMode successfull");
+        Errors++;
+        delay(500);
+        Module.setNormalMode();
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
         {
-            Serial.print("\t- \"Change\" Baudrate successfull, because the used default Baudrate equals the default Baudrate during Instanziation (");
-            Serial.print((MCP2515_DEFAULT_BAUDRATE/1000), DEC);
-            Serial.print("kB). Change-Process will be skipped. No Error");
-
-            delay(500);
-
-            possibleBaudrateCounter++;
-
-            Serial.print(Teststep, DEC);
-            Serial.println(".1.1: Test with different Baudrate");
-            if (Module.changeBaudRate(possibleBaudRates[possibleBaudrateCounter])){
-                Serial.println("\t- Failed. Setting changeBaudRate successfull");
-                Errors++;
-            } else {
-                Serial.println("\t- passed");
-            }
-        } else {
-            Serial.println("\t- Failed. Setting changeBaudRate successfull");
+            Serial.print("\t- Failed. Setting ListenOnlyMode failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
+        } else {
+            Serial.println("\t- passed");
         }
-    } else {
-        Serial.println("\t- passed");
     }
     
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    possibleBaudrateCounter++;
-
-    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, possibleBaudRates[possibleBaudrateCounter])){
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
         delay(100);
     }
 
+    delay(500);
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test changeBaudRate-Function when initialized");
-
-    possibleBaudrateCounter++;
+    Serial.println(".2: Test setListenOnlyMode-Function when initialized");
     
-    if (!Module.changeBaudRate(possibleBaudRates[possibleBaudrateCounter]))
+    if (!Module.setListenOnlyMode())
     {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) == ERROR_MCP2515_CNF_NOT_FOUND){
-            while ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) == ERROR_MCP2515_CNF_NOT_FOUND)
-            {
-                Serial.print("\t- Change BaudRate not successfull because Baudrate ");
-                Serial.print(possibleBaudRates[possibleBaudrateCounter]/1000, DEC);
-                Serial.print("kB is not defined for the used ClockFrequency ");
-                Serial.print(defaultClockFrequency/1000000, DEC);
-                Serial.println("MHz. No Error. Repeat test with a different Baudrate.");
-                possibleBaudrateCounter++;
-
-                delay(500);
-
-                Module.changeBaudRate(possibleBaudRates[possibleBaudrateCounter]);
-            }
-                        
-            if (Module.getLastMCPError() == 0x00){
-                Serial.println("\t- passed");
-            } else {
-                Serial.print("\t- Failed. Change BaudRate with different Baudrate not successfull in initialized Mode with Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            }
-        } else {
-            Serial.print("\t- Failed. Change BaudRate not successfull in initialized Mode with Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        }
-        
+        Serial.print("\t- Failed. Setting ListenOnlyMode not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
     } else {
         Serial.println("\t- passed");
+        Module.setNormalMode();
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test possible Baudrates in changeBaudRate-Function");
+    Serial.println(".3: Test setListenOnlyMode-Function with wrong CS-Pin Configuration");
+    
+    delay(500);
+    pinMode(CS_Pin, INPUT_PULLUP);
+    delay(500);
 
-    for (size_t i = 0; i < 12; i++){
+    if (Module.setListenOnlyMode())
+    {
+        Serial.println("\t- Failed. Setting ListenOnlyMode successfull with wrong CS-Pin Configuration");
+        Errors++;
+        Module.setNormalMode();
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_OPERATION_MODE_NOT_SET) != ERROR_MCP2515_OPERATION_MODE_NOT_SET)
+        {
+            Serial.print("\t- Failed. Setting ListenOnlyMode failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
 
-        Serial.print(Teststep, DEC);
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    pinMode(CS_Pin, OUTPUT);
+    delay(500);
+    Module.setNormalMode();
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+uint8_t testSetLoopbackMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test setLoopbackMode-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test setLoopbackMode-Function when not initialized");
+
+    if (Module.setLoopbackMode()){
+        Serial.println("\t- Failed. Setting LoopbackMode successfull");
+        Errors++;
+        delay(500);
+        Module.setNormalMode();
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Setting LoopbackMode failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    delay(500);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test setLoopbackMode-Function when initialized");
+    
+    if (!Module.setLoopbackMode())
+    {
+        Serial.print("\t- Failed. Setting LoopbackMode not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+        Module.setNormalMode();
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test setLoopbackMode-Function with wrong CS-Pin Configuration");
+    
+    delay(500);
+    pinMode(CS_Pin, INPUT_PULLUP);
+    delay(500);
+
+    if (Module.setLoopbackMode())
+    {
+        Serial.println("\t- Failed. Setting LoopbackMode successfull with wrong CS-Pin Configuration");
+        Errors++;
+        Module.setNormalMode();
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_OPERATION_MODE_NOT_SET) != ERROR_MCP2515_OPERATION_MODE_NOT_SET)
+        {
+            Serial.print("\t- Failed. Setting LoopbackMode failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    pinMode(CS_Pin, OUTPUT);
+    delay(500);
+    Module.setNormalMode();
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+uint8_t testSetSleepMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test setSleepMode-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test setSleepMode-Function when not initialized");
+
+    if (Module.setSleepMode()){
+        Serial.println("\t- Failed. Setting SleepMode successfull");
+        Errors++;
+        delay(500);
+        Module.setInterruptFlag(6);
+        delay(1000);
+        Module.setNormalMode();
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Setting SleepMode failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    delay(1000);
+    Module.resetInterruptFlag(6);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test setSleepMode-Function when initialized");
+    
+    if (!Module.setSleepMode())
+    {
+        Serial.print("\t- Failed. Setting SleepMode not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+        delay(500);
+        Module.setInterruptFlag(6);
+        delay(1000);
+        Module.setNormalMode();
+    }
+
+    delay(1000);
+    Module.resetInterruptFlag(6);
+    
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test setSleepMode-Function with wrong CS-Pin Configuration");
+    
+    delay(500);
+    pinMode(CS_Pin, INPUT_PULLUP);
+    delay(500);
+
+    if (Module.setSleepMode())
+    {
+        Serial.println("\t- Failed. Setting SleepMode successfull with wrong CS-Pin Configuration");
+        Errors++;
+        delay(500);
+        Module.setInterruptFlag(6);
+        delay(1000);
+        Module.setNormalMode();
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_OPERATION_MODE_NOT_SET) != ERROR_MCP2515_OPERATION_MODE_NOT_SET)
+        {
+            Serial.print("\t- Failed. Setting SleepMode failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    pinMode(CS_Pin, OUTPUT);
+    delay(500);
+    Module.setNormalMode();
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+uint8_t testEnterSleepMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test enterSleepMode-/wakeUp-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test enterSleepMode-/wakeUp-Function when not initialized");
+
+    if (Module.enterSleepMode() ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED) ||
+        Module.wakeUp() ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED))
+    {
+        Serial.print("\t- Failed. Sleep-Mode successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test wakeUp-Function when not sleeping");
+
+    if (Module.wakeUp() ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_FALSE_OPERATION_MODE) != ERROR_MCP2515_FALSE_OPERATION_MODE))
+    {
+        Serial.print("\t- Failed. Wake-Up successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test enterSleepMode-Function with Wake-Up-Filter");
+
+    if (!Module.enterSleepMode(true) ||
+        (Module.getOperationMode() != MCP2515_OP_SLEEP))
+    {
+        Serial.print("\t- Failed. Sleep-Mode not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test enterSleepMode-Function when sleeping");
+
+    if (Module.enterSleepMode(true) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_FALSE_OPERATION_MODE) != ERROR_MCP2515_FALSE_OPERATION_MODE))
+    {
+        Serial.print("\t- Failed. Sleep-Mode successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test wakeUp-Function after enterSleepMode");
+
+    if (!Module.wakeUp() ||
+        (Module.getOperationMode() != MCP2515_OP_NORMAL) ||
+        (Module.handleInterrupt() & 0x40))
+    {
+        Serial.print("\t- Failed. Wake-Up not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".6: Test enterSleepMode-Function without Wake-Up-Filter from the Listen-Only-Mode");
+
+    if (!Module.setListenOnlyMode() ||
+        !Module.enterSleepMode(false) ||
+        (Module.getOperationMode() != MCP2515_OP_SLEEP) ||
+        !Module.wakeUp() ||
+        (Module.getOperationMode() != MCP2515_OP_LISTEN))
+    {
+        Serial.print("\t- Failed. Sleep-Mode/Wake-Up not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(500);
+    Module.setNormalMode();
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+uint8_t testSetReCheckEnabler(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test setReCheckEnabler-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test setReCheckEnabler-Function when not initialized");
+
+    if (Module.setReCheckEnabler(false)){
+        Serial.println("\t- Failed. Setting ReCheckEnabler successfull");
+        Errors++;    
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Setting ReCheckEnabler failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test setReCheckEnabler-Function when initialized");
+    
+    if (!Module.setReCheckEnabler(true))
+    {
+        Serial.print("\t- Failed. Setting ReCheckEnabler not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+    
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test setReCheckEnabler-Function with defined Values");
+    Serial.println(".3.1: Set ReCheckEnabler true");
+
+    if (!Module.setReCheckEnabler(true))
+    {
+        Serial.print("\t- Failed. Setting ReCheckEnabler true failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+        
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(500);
+
+    Serial.println(".3.2: Set ReCheckEnabler false");
+
+    if (!Module.setReCheckEnabler(false))
+    {
+        Serial.print("\t- Failed. Setting ReCheckEnabler false failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+        
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(500);
+    Module.setReCheckEnabler(true);
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+
+uint8_t testRegisterCache(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    uint8_t Divergences = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test Register-Cache-Functions");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test scrubRegisterCache-Function when not initialized");
+
+    if (Module.scrubRegisterCache(Divergences)){
+        Serial.println("\t- Failed. Scrub Register-Cache successfull");
+        Errors++;
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Scrub Register-Cache failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test setRegisterCacheEnabler-Function before the Initialisation");
+
+    if (!Module.setRegisterCacheEnabler(true) ||
+        !Module.getRegisterCacheEnabled())
+    {
+        Serial.print("\t- Failed. Enable Register-Cache not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test scrubRegisterCache-Function after the Initialisation");
+
+    if (!Module.scrubRegisterCache(Divergences) ||
+        (Divergences != 0))
+    {
+        Serial.print("\t- Failed. ");
+        Serial.print(Divergences, DEC);
+        Serial.print(" Divergences with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test scrubRegisterCache-Function after Changes of the Configuration");
+
+    if (!Module.changeBaudRate((uint32_t)125E3) ||
+        !Module.setOneShotMode(true) ||
+        !Module.setLoopbackMode() ||
+        !Module.setOneShotMode(false) ||
+        !Module.setNormalMode() ||
+        !Module.changeBaudRate(defaultBaudrate) ||
+        !Module.scrubRegisterCache(Divergences) ||
+        (Divergences != 0))
+    {
+        Serial.print("\t- Failed. ");
+        Serial.print(Divergences, DEC);
+        Serial.print(" Divergences with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test setRegisterCacheEnabler-Function with defined Values");
+
+    if (!Module.setRegisterCacheEnabler(false) ||
+        Module.getRegisterCacheEnabled() ||
+        !Module.getIsInitialized())
+    {
+        Serial.print("\t- Failed. Disable Register-Cache not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+
+uint8_t testSnapshot(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    const uint32_t Ids[2] = {0x123, 0x124};
+    const bool Extended[2] = {false, false};
+
+    uint8_t Errors = 0;
+    MCP2515Snapshot Snapshot;
+    MCP2515Snapshot RestoredSnapshot;
+    MCP2515FilterConfig Config;
+    uint32_t ReadyTime = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test Snapshot-Functions");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test captureSnapshot-Function when not initialized");
+
+    if (Module.captureSnapshot(Snapshot) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED))
+    {
+        Serial.print("\t- Failed. Capture Snapshot successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test captureSnapshot-Function after Changes of the Configuration");
+
+    if (!Module.changeBaudRate((uint32_t)125E3) ||
+        !Module.setOneShotMode(true) ||
+        !Module.setAcceptedIds(Ids, Extended, 2, Config) ||
+        !Module.captureSnapshot(Snapshot) ||
+        (Snapshot.baudRate != (uint32_t)125E3) ||
+        (Module.getOperationMode() != MCP2515_OP_NORMAL))
+    {
+        Serial.print("\t- Failed. Capture Snapshot not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test restoreSnapshot-Function when initialized");
+
+    if (Module.restoreSnapshot(Snapshot, ReadyTime) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_IS_INITIALIZED) != ERROR_MCP2515_IS_INITIALIZED))
+    {
+        Serial.print("\t- Failed. Restore Snapshot successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test restoreSnapshot-Function with a corrupted Snapshot");
+
+    Module.deinit();
+    delay(500);
+
+    RestoredSnapshot = Snapshot;
+    RestoredSnapshot.filters[0] = RestoredSnapshot.filters[0] ^ 0x01;
+
+    if (Module.restoreSnapshot(RestoredSnapshot, ReadyTime) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_SNAPSHOT_NOT_VALID) != ERROR_MCP2515_SNAPSHOT_NOT_VALID) ||
+        Module.getIsInitialized())
+    {
+        Serial.print("\t- Failed. Restore Snapshot successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test restoreSnapshot-Function after a Reset");
+
+    bool StepFailed = false;
+
+    if (!Module.restoreSnapshot(Snapshot, ReadyTime) ||
+        !Module.getIsInitialized() ||
+        (Module.getOperationMode() != MCP2515_OP_NORMAL) ||
+        (Module.getBaudRate() != (uint32_t)125E3) ||
+        !Module.getOneShotMode() ||
+        !Module.captureSnapshot(RestoredSnapshot))
+    {
+        StepFailed = true;
+    } else {
+        for (uint8_t i = 0; i < MCP2515_CACHED_REGISTERS; i++)
+        {
+            StepFailed = StepFailed || (RestoredSnapshot.registers[i] != Snapshot.registers[i]);
+        }
+        for (uint8_t i = 0; i < MCP2515_FILTER_REGISTERS; i++)
+        {
+            StepFailed = StepFailed || (RestoredSnapshot.filters[i] != Snapshot.filters[i]);
+        }
+    }
+
+    if (StepFailed)
+    {
+        Serial.print("\t- Failed. Restore Snapshot not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.print("\t- passed. Ready after ");
+        Serial.print(ReadyTime, DEC);
+        Serial.println("us");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Module.deinit();
+    delay(500);
+
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+
+uint8_t testChangeBaudRate(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+    uint8_t possibleBaudrateCounter = 0;
+    
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test changeBaudRate-Function (not stable)");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test changeBaudRate-Function when not initialized");
+
+    if (Module.changeBaudRate(possibleBaudRates[possibleBaudrateCounter])){
+        if (possibleBaudRates[possibleBaudrateCounter] == MCP2515_DEFAULT_BAUDRATE)
+        {
+            Serial.print("\t- \"Change\" Baudrate successfull, because the used default Baudrate equals the default Baudrate during Instanziation (");
+            Serial.print((MCP2515_DEFAULT_BAUDRATE/1000), DEC);
+            Serial.print("kB). Change-Process will be skipped. No Error");
+
+            delay(500);
+
+            possibleBaudrateCounter++;
+
+            Serial.print(Teststep, DEC);
+            Serial.println(".1.1: Test with different Baudrate");
+            if (Module.changeBaudRate(possibleBaudRates[possibleBaudrateCounter])){
+                Serial.println("\t- Failed. Setting changeBaudRate successfull");
+                Errors++;
+            } else {
+                Serial.println("\t- passed");
+            }
+        } else {
+            Serial.println("\t- Failed. Setting changeBaudRate successfull");
+            Errors++;
+        }
+    } else {
+        Serial.println("\t- passed");
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    possibleBaudrateCounter++;
+
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, possibleBaudRates[possibleBaudrateCounter])){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test changeBaudRate-Function when initialized");
+
+    possibleBaudrateCounter++;
+    
+    if (!Module.changeBaudRate(possibleBaudRates[possibleBaudrateCounter]))
+    {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) == ERROR_MCP2515_CNF_NOT_FOUND){
+            while ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) == ERROR_MCP2515_CNF_NOT_FOUND)
+            {
+                Serial.print("\t- Change BaudRate not successfull because Baudrate ");
+                Serial.print(possibleBaudRates[possibleBaudrateCounter]/1000, DEC);
+                Serial.print("kB is not defined for the used ClockFrequency ");
+                Serial.print(defaultClockFrequency/1000000, DEC);
+                Serial.println("MHz. No Error. Repeat test with a different Baudrate.");
+                possibleBaudrateCounter++;
+
+                delay(500);
+
+                Module.changeBaudRate(possibleBaudRates[possibleBaudrateCounter]);
+            }
+                        
+            if (Module.getLastMCPError() == 0x00){
+                Serial.println("\t- passed");
+            } else {
+                Serial.print("\t- Failed. Change BaudRate with different Baudrate not successfull in initialized Mode with Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
+                Errors++;
+            }
+        } else {
+            Serial.print("\t- Failed. Change BaudRate not successfull in initialized Mode with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        }
+        
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test possible Baudrates in changeBaudRate-Function");
+
+    for (size_t i = 0; i < 12; i++){
+
+        Serial.print(Teststep, DEC);
+        Serial.print(".3.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Set Baudrate ");
+        Serial.print(possibleBaudRates[i]/1000, DEC);
+        Serial.println("kB");
+
+        if (!Module.changeBaudRate(possibleBaudRates[i])){
+            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
+                Serial.print("\t- Failed with Error 0x");
+                Serial.print(Module.getLastMCPError(), HEX);
+                Serial.println(".");
+                Errors++;
+            } else {
+                Serial.print("\t- Baudrate for choosen ClockFrequency ");
+                Serial.print(defaultClockFrequency/1000000, DEC);
+                Serial.println("MHz not defined. No Error!");
+            }
+        } else {
+            Serial.println("\t- passed");
+        }
+
+        delay(500);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test undefined Baudrates in changeBaudRate-Function");
+    uint32_t undefinedBaudrates[4] = {
+        (uint32_t)0,
+        (uint32_t)500,
+        (uint32_t)1100e3,
+        (uint32_t)2000e3,
+    };
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".4.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Baudrate ");
+        Serial.print(undefinedBaudrates[i]/1000, DEC);
+        Serial.println("kB");
+
+        if (!Module.changeBaudRate(undefinedBaudrates[i])){
+            if ((Module.getLastMCPError() & ERROR_MCP2515_BAUDRATE_NOT_VALID) != ERROR_MCP2515_BAUDRATE_NOT_VALID){
+                Serial.print("\t- Failed. False Error during changeBaudRate with undefined Baudrate ");
+                Serial.print(undefinedBaudrates[i]/1000, DEC);
+                Serial.println("kB");
+                Serial.print("\t- Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
+                Errors++;
+            } else {
+                Serial.println("\t- passed");
+            }
+        } else {
+            Serial.print("\t- Failed. No Error during changeBaudRate with undefined Baudrate ");
+            Serial.print(undefinedBaudrates[i]/1000, DEC);
+            Serial.println("kB");
+            Errors++;
+        }
+        
+        delay(500);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test changeBaudRate from OperationMode ListenOnly");
+
+    for (size_t i = 0; i < 12; i++){
+
+        while (!Module.setListenOnlyMode()){
+            delay(100);
+        }
+        delay(500);
+
+        Serial.print(Teststep, DEC);
+        Serial.print(".5.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Set Baudrate ");
+        Serial.print(possibleBaudRates[i]/1000, DEC);
+        Serial.println("kB");
+
+        if (!Module.changeBaudRate(possibleBaudRates[i])){
+            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
+                Serial.print("\t- Failed with Error 0x");
+                Serial.print(Module.getLastMCPError(), HEX);
+                Serial.println(".");
+                Errors++;
+            } else {
+                Serial.print("\t- Baudrate ");
+                Serial.print(possibleBaudRates[i]/1000, DEC);
+                Serial.print("kB for choosen ClockFrequency ");
+                Serial.print(defaultClockFrequency/1000000, DEC);
+                Serial.println("MHz not defined. No Error!");
+            }
+        } else {
+            if (Module.getOperationMode() != MCP2515_OP_LISTEN)
+            {
+                Serial.println("\t- failed. ChangeBaudrate didn't finish in ListenOnly-Mode.");
+                Errors++;
+            } else {
+                Serial.println("\t- passed");
+            }            
+        }
+        delay(500);
+    }
+
+    while (!Module.setNormalMode()){
+        delay(100);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".6: Test changeBaudRate from OperationMode Loopback");
+
+    for (size_t i = 0; i < 12; i++){
+
+        while (!Module.setLoopbackMode()){
+            delay(100);
+        }
+        delay(500);
+
+        Serial.print(Teststep, DEC);
+        Serial.print(".6.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Set Baudrate ");
+        Serial.print(possibleBaudRates[i]/1000, DEC);
+        Serial.println("kB");
+
+        if (!Module.changeBaudRate(possibleBaudRates[i])){
+            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
+                Serial.print("\t- Failed with Error 0x");
+                Serial.print(Module.getLastMCPError(), HEX);
+                Serial.println(".");
+                Errors++;
+            } else {
+                Serial.print("\t- Baudrate ");
+                Serial.print(possibleBaudRates[i]/1000, DEC);
+                Serial.print("kB for choosen ClockFrequency ");
+                Serial.print(defaultClockFrequency/1000000, DEC);
+                Serial.println("MHz not defined. No Error!");
+            }
+        } else {
+            if (Module.getOperationMode() != MCP2515_OP_LOOPBACK)
+            {
+                Serial.println("\t- failed. ChangeBaudrate didn't finish in Loopback-Mode.");
+                Errors++;
+            } else {
+                Serial.println("\t- passed");
+            }            
+        }
+        delay(500);
+    }
+
+    while (!Module.setNormalMode()){
+        delay(100);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".7: Test changeBaudRate from OperationMode Configuration");
+
+    for (size_t i = 0; i < 12; i++){
+
+        while (!Module.setConfigurationMode()){
+            delay(100);
+        }
+        delay(500);
+
+        Serial.print(Teststep, DEC);
+        Serial.print(".7.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Set Baudrate ");
+        Serial.print(possibleBaudRates[i]/1000, DEC);
+        Serial.println("kB");
+
+        if (!Module.changeBaudRate(possibleBaudRates[i])){
+            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
+                Serial.print("\t- Failed with Error 0x");
+                Serial.print(Module.getLastMCPError(), HEX);
+                Serial.println(".");
+                Errors++;
+            } else {
+                Serial.print("\t- Baudrate ");
+                Serial.print(possibleBaudRates[i]/1000, DEC);
+                Serial.print("kB for choosen ClockFrequency ");
+                Serial.print(defaultClockFrequency/1000000, DEC);
+                Serial.println("MHz not defined. No Error!");
+            }
+        } else {
+            if (Module.getOperationMode() != MCP2515_OP_CONFIGURATION)
+            {
+                Serial.println("\t- failed. ChangeBaudrate didn't finish in Configuration-Mode.");
+                Errors++;
+            } else {
+                Serial.println("\t- passed");
+            }            
+        }
+        delay(500);
+    }
+
+    while (!Module.setNormalMode()){
+        delay(100);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".8: Test changeBaudRate from OperationMode Normal");
+
+    for (size_t i = 0; i < 12; i++){
+
+        while (!Module.setNormalMode()){
+            delay(100);
+        }
+        delay(500);
+
+        Serial.print(Teststep, DEC);
+        Serial.print(".8.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Set Baudrate ");
+        Serial.print(possibleBaudRates[i]/1000, DEC);
+        Serial.println("kB");
+
+        if (!Module.changeBaudRate(possibleBaudRates[i])){
+            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
+                Serial.print("\t- Failed with Error 0x");
+                Serial.print(Module.getLastMCPError(), HEX);
+                Serial.println(".");
+                Errors++;
+            } else {
+                Serial.print("\t- Baudrate ");
+                Serial.print(possibleBaudRates[i]/1000, DEC);
+                Serial.print("kB for choosen ClockFrequency ");
+                Serial.print(defaultClockFrequency/1000000, DEC);
+                Serial.println("MHz not defined. No Error!");
+            }
+        } else {
+            if (Module.getOperationMode() != MCP2515_OP_NORMAL)
+            {
+                Serial.println("\t- failed. ChangeBaudrate didn't finish in Normal-Mode.");
+                Errors++;
+            } else {
+                Serial.println("\t- passed");
+            }            
+        }
+        delay(500);
+    }
+
+    while (!Module.setNormalMode()){
+        delay(100);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".9: Test changeBaudRate from OperationMode Sleep");
+    Serial.println("\t- Makes no sense!");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(500);
+    Module.changeBaudRate(defaultBaudrate);
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+};
+
+uint8_t testCalculateBitTiming(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    // Crystals and Bitrates which are not part of a fixed Table
+    const uint32_t ClockFrequencys[2] = {(uint32_t)12E6, (uint32_t)20E6};
+    const uint32_t BaudRates[3] = {(uint32_t)33333, (uint32_t)83333, (uint32_t)666666};
+
+    uint8_t Errors = 0;
+    uint8_t Cnf[3];
+    int32_t BitRateError;
+    uint16_t SamplePoint;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test calculateBitTiming-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test calculateBitTiming-/setSamplePoint-/setMaxBitRateError-Function with invalid Values");
+
+    if (Module.calculateBitTiming(0, defaultClockFrequency, Cnf, BitRateError, SamplePoint) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_BAUDRATE_NOT_VALID) != ERROR_MCP2515_BAUDRATE_NOT_VALID) ||
+        Module.calculateBitTiming(defaultBaudrate, (uint32_t)45E6, Cnf, BitRateError, SamplePoint) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_CLOCKFREQUENCY_NOT_VALID) != ERROR_MCP2515_CLOCKFREQUENCY_NOT_VALID) ||
+        Module.calculateBitTiming((uint32_t)1000E3, (uint32_t)8E6, Cnf, BitRateError, SamplePoint) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND) ||
+        Module.setSamplePoint(400) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.setMaxBitRateError(50001) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
+    {
+        Serial.print("\t- Failed. Calculation with invalid Values successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test calculateBitTiming-Function with the Sample-Point 87.5%");
+
+    // 16MHz, 500kB: BRP 1, 16 TQ (PRSEG 7, PHSEG1 6, PHSEG2 2), SJW 1
+    if (!Module.calculateBitTiming((uint32_t)500E3, (uint32_t)16E6, Cnf, BitRateError, SamplePoint) ||
+        (Cnf[0] != 0x00) || (Cnf[1] != 0xAE) || (Cnf[2] != 0x01) ||
+        (BitRateError != 0) || (SamplePoint != 875))
+    {
+        Serial.print("\t- Failed. Wrong Bit-Timing 0x");
+        Serial.print(Cnf[0], HEX);
+        Serial.print(" 0x");
+        Serial.print(Cnf[1], HEX);
+        Serial.print(" 0x");
+        Serial.print(Cnf[2], HEX);
+        Serial.print(" Sample-Point ");
+        Serial.println(SamplePoint, DEC);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test calculateBitTiming-Function with non-standard Bitrates");
+
+    bool StepFailed = false;
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        for (uint8_t j = 0; j < 3; j++)
+        {
+            if (!Module.calculateBitTiming(BaudRates[j], ClockFrequencys[i], Cnf, BitRateError, SamplePoint) ||
+                (BitRateError > (int32_t)MCP2515_DEFAULT_MAX_BITRATE_ERROR) ||
+                (BitRateError < -(int32_t)MCP2515_DEFAULT_MAX_BITRATE_ERROR))
+            {
+                Serial.print("\t- Failed. No Bit-Timing for ");
+                Serial.print(BaudRates[j], DEC);
+                Serial.print("B with ");
+                Serial.print(ClockFrequencys[i] / 1000000, DEC);
+                Serial.print("MHz, Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
+                StepFailed = true;
+            }
+        }
+    }
+
+    if (StepFailed)
+    {
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test changeBaudRate-Function with 83.3kB and getBitRateError-/getSamplePoint-Function");
+
+    if (!Module.changeBaudRate(83333) ||
+        (Module.getBitRateError() > (int32_t)MCP2515_DEFAULT_MAX_BITRATE_ERROR) ||
+        (Module.getBitRateError() < -(int32_t)MCP2515_DEFAULT_MAX_BITRATE_ERROR) ||
+        (Module.getSamplePoint() < 500) ||
+        (Module.getSamplePoint() > 950))
+    {
+        Serial.print("\t- Failed. Change BaudRate not successfull with Error 0x");
+        Serial.print(Module.getLastMCPError(), HEX);
+        Serial.print(" Deviation ");
+        Serial.print(Module.getBitRateError(), DEC);
+        Serial.print("ppm Sample-Point ");
+        Serial.println(Module.getSamplePoint(), DEC);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test init-Function with the Bit-Timing calculated at Compile-Time");
+
+    Module.deinit();
+    delay(500);
+
+    // Same Calculation as at Runtime
+    Module.calculateBitTiming((uint32_t)500E3, (uint32_t)8E6, Cnf, BitRateError, SamplePoint);
+
+    if (!Module.init<8000000, 500000>() ||
+        (Module.getClockFrequency() != (uint32_t)8E6) ||
+        (Module.getBaudRate() != (uint32_t)500E3) ||
+        (Module.getBitRateError() != BitRateError) ||
+        (Module.getSamplePoint() != SamplePoint))
+    {
+        Serial.print("\t- Failed. Init not successfull with Error 0x");
+        Serial.print(Module.getLastMCPError(), HEX);
+        Serial.print(" Sample-Point ");
+        Serial.println(Module.getSamplePoint(), DEC);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    Module.deinit();
+    delay(500);
+
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(500);
+    Module.changeBaudRate(defaultBaudrate);
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+};
+
+uint8_t testDetectBaudRate(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    // Candidates ordered by their Likelihood, incl. non-standard Bitrates
+    const uint32_t Candidates[4] = {(uint32_t)250E3, defaultBaudrate, (uint32_t)83333, (uint32_t)125E3};
+
+    uint8_t Errors = 0;
+    uint32_t BaudRate;
+    uint32_t Duration;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test detectBaudRate-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test detectBaudRate-Function when not initialized");
+
+    if (Module.detectBaudRate(Candidates, 4, BaudRate, Duration) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED))
+    {
+        Serial.print("\t- Failed. Detection successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test detectBaudRate-Function with invalid Values");
+
+    if (Module.detectBaudRate(Candidates, 0, BaudRate, Duration) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.detectBaudRate(Candidates, 4, BaudRate, Duration, 0) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
+    {
+        Serial.print("\t- Failed. Detection with invalid Values successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test detectBaudRate-Function on the Bus");
+
+    // Without Traffic on the Bus no Baudrate can be detected, but the previous Settings must be restored
+    if (Module.detectBaudRate(Candidates, 4, BaudRate, Duration))
+    {
+        if ((BaudRate != defaultBaudrate) ||
+            (Module.getBaudRate() != defaultBaudrate) ||
+            (Module.getOperationMode() != MCP2515_OP_NORMAL))
+        {
+            Serial.print("\t- Failed. Wrong Baudrate ");
+            Serial.print(BaudRate, DEC);
+            Serial.print("B detected in ");
+            Serial.print(Duration, DEC);
+            Serial.println("us");
+            Errors++;
+        } else {
+            Serial.print("\t- passed. Baudrate detected in ");
+            Serial.print(Duration, DEC);
+            Serial.println("us");
+        }
+    } else if (((Module.getLastMCPError() & ERROR_MCP2515_BAUDRATE_NOT_DETECTED) != ERROR_MCP2515_BAUDRATE_NOT_DETECTED) ||
+        (Module.getBaudRate() != defaultBaudrate) ||
+        (Module.getOperationMode() != MCP2515_OP_NORMAL))
+    {
+        Serial.print("\t- Failed. Settings not restored or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.print("\t- passed. No Traffic on the Bus, tried for ");
+        Serial.print(Duration, DEC);
+        Serial.println("us");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(500);
+    Module.changeBaudRate(defaultBaudrate);
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+};
+
+uint8_t testChangeInterruptSetting(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test changeInterruptSetting-Function");
+    Serial.println();
+    Serial.println("Please be sure that the Interrupt-Pin is connected correctly!");
+
+    delay(5000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test changeInterruptSetting-Function when not initialized");
+
+    if (Module.changeInterruptSetting(true, 1)){
+        Serial.println("\t- Failed. Change InterruptSetting successfull");
+        Module.changeInterruptSetting(false, 1);
+        Errors++;    
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Change InterruptSetting failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }   
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test changeInterruptSetting-Function when initialized");
+
+    if (!Module.changeInterruptSetting(true, 1))
+    {
+        Serial.print("\t- Failed. Change InterruptSetting not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+        Module.changeInterruptSetting(false, 1);
+    }
+
+    delay(1000);
+    
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test changeInterruptSetting-Function with defined Values");
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".3.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Change Interrupt ");
+        Serial.print(i, DEC);
+        Serial.println(" to true");
+
+        if (!Module.changeInterruptSetting(true, i))
+        {
+            Serial.print("\t- Failed. Change InterruptSetting failed with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+
+        } else {
+            Serial.println("\t- passed");
+            Module.changeInterruptSetting(false, i);
+        }
+
+        delay(500);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test changeInterruptSetting-Function with undefined Values");
+
+    for (size_t i = 8; i < 14; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".4.");
+        Serial.print((i-8), DEC);
+        Serial.print(": Change Interrupt ");
+        Serial.print(i, DEC);
+        Serial.println(" to true");
+
+        if (Module.changeInterruptSetting(true, i))
+        {
+            Serial.println("\t- Failed. Change InterruptSetting successfull");
+            Errors++;
+
+        } else {
+            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
+            {
+                Serial.print("\t- Failed. Change InterruptSetting failed with wrong Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
+                Errors++;
+            } else {
+                Serial.println("\t- passed");
+            }
+        }
+
+        delay(500);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test if Interrupts occurs on INT-Pin");
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".5.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Test Interrupt ");
+        Serial.println(i, DEC);
+
+        while (!Module.resetInterruptFlag(i))
+        {
+            delay(100);
+        }
+
+        Serial.println("\t- set Interrupt-Enabler true");
+
+        while (!Module.changeInterruptSetting(true, i))
+        {
+            delay(100);
+        }
+
+        delay(500);
+        Serial.print("\t\t- corresponding Flag-Value ");
+        Serial.println((((Module.check4InterruptFlags() & (0x01 << i)) > 0) ? 1 : 0), DEC);
+
+        Serial.println("\t- set corresponding Flag");
+        while (!Module.setInterruptFlag(i))
+        {
+            delay(100);
+        }
+
+        delay(100);
+
+        Serial.println("\t- Check Value of the INT-Pin");
+
+        if (digitalRead(INT_Pin) == 0)
+        {
+            Serial.println("\t\t- passed");
+        } else {
+            Serial.println("\t\t- no Interrupt occured");
+            Errors++;
+        }
+
+        while (!Module.resetInterruptFlag(i))
+        {
+            delay(100);
+        }
+
+        while (!Module.changeInterruptSetting(false, i))
+        {
+            delay(100);
+        }
+
+        delay(500);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+
+uint8_t testClockOutput(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test setClockOutput-Function and Start-of-Frame-Timestamps");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test setClockOutput-Function when not initialized");
+
+    if (Module.setClockOutput(MCP2515_CLKOUT_SOF) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED))
+    {
+        Serial.print("\t- Failed. Setting the CLKOUT-Pin successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test setClockOutput-Function with invalid Mode and Prescaler");
+
+    if (Module.setClockOutput(MCP2515_CLKOUT_SOF + 1) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.setClockOutput(MCP2515_CLKOUT_CLOCK, 3) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
+    {
+        Serial.print("\t- Failed. Setting the CLKOUT-Pin successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test setClockOutput-Function with the Start-of-Frame-Signal in Normal-Mode");
+
+    if (!Module.setClockOutput(MCP2515_CLKOUT_SOF) ||
+        (Module.getClockOutput() != MCP2515_CLKOUT_SOF) ||
+        (Module.getOperationMode() != MCP2515_OP_NORMAL))
+    {
+        Serial.print("\t- Failed. Setting the Start-of-Frame-Signal not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test changeBaudRate-Function keeps the Start-of-Frame-Signal");
+
+    if (!Module.changeBaudRate(defaultBaudrate) ||
+        (Module.getClockOutput() != MCP2515_CLKOUT_SOF))
+    {
+        Serial.print("\t- Failed. Start-of-Frame-Signal not kept with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test Start-of-Frame-Timestamp of a received Frame");
+
+    uint32_t ID;
+    bool Frame;
+    bool RTR;
+    uint8_t DLC;
+    uint8_t DataBuffer[8];
+    uint32_t Timestamp = 0;
+    uint32_t Count = Module.getStartOfFrameCount();
+
+    Module.captureStartOfFrame(1000);
+    Module.latchStartOfFrame(0);
+    Module.captureStartOfFrame(2000);
+
+    if ((Module.getStartOfFrameCount() - Count != 2) ||
+        !Module.getAllFromReceiveBuffer(0, ID, Frame, RTR, DLC, DataBuffer) ||
+        !Module.getStartOfFrameTimestamp(Timestamp) ||
+        (Timestamp != 1000) ||
+        !Module.getAllFromReceiveBuffer(0, ID, Frame, RTR, DLC, DataBuffer) ||
+        Module.getStartOfFrameTimestamp(Timestamp))
+    {
+        Serial.print("\t- Failed. Start-of-Frame-Timestamp not assigned to the Frame. Timestamp = ");
+        Serial.println(Timestamp, DEC);
+        Errors++;
+    } else {
+        // The second Latch has no new Start-of-Frame
+        Module.latchStartOfFrame(0);
+        Module.latchStartOfFrame(1);
+
+        if (!Module.getAllFromReceiveBuffer(0, ID, Frame, RTR, DLC, DataBuffer) ||
+            !Module.getStartOfFrameTimestamp(Timestamp) ||
+            (Timestamp != 2000) ||
+            !Module.getAllFromReceiveBuffer(1, ID, Frame, RTR, DLC, DataBuffer) ||
+            Module.getStartOfFrameTimestamp(Timestamp))
+        {
+            Serial.print("\t- Failed. Start-of-Frame-Timestamp assigned twice. Timestamp = ");
+            Serial.println(Timestamp, DEC);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".6: Test setClockOutput-Function with Clock and disabled");
+
+    if (!Module.setClockOutput(MCP2515_CLKOUT_CLOCK, 4) ||
+        (Module.getClockOutput() != MCP2515_CLKOUT_CLOCK) ||
+        !Module.setClockOutput(MCP2515_CLKOUT_DISABLED) ||
+        (Module.getClockOutput() != MCP2515_CLKOUT_DISABLED) ||
+        (Module.getOperationMode() != MCP2515_OP_NORMAL))
+    {
+        Serial.print("\t- Failed. Setting the CLKOUT-Pin not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(500);
+    Module.setClockOutput(MCP2515_CLKOUT_CLOCK, 8);
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+uint8_t testEnableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test enableFilterMask-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test enableFilterMask-Function when not initialized");
+
+    if (Module.enableFilterMask(0)){
+        Serial.println("\t- Failed. Enable FilterMask successfull");
+        Module.disableFilterMask(0);
+        Errors++;    
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Enable FilterMask failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test enableFilterMask-Function when initialized");
+    
+    if (!Module.enableFilterMask(0))
+    {
+        Serial.print("\t- Failed. Enable FilterMask not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+        Module.disableFilterMask(0);
+    }
+
+    delay(1000);
+    
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test enableFilterMask-Function with defined Values");
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".3.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Enable FilterMask of Buffer ");
+        Serial.println(i, DEC);
+
+        if (!Module.enableFilterMask(i))
+        {
+            Serial.print("\t- Failed. Enable FilterMask failed with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+            
+        } else {
+            Serial.println("\t- passed");
+            Module.disableFilterMask(i);
+        }
+
+        delay(500);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test enableFilterMask-Function with undefined Values");
+
+    for (size_t i = 2; i < 4; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".4.");
+        Serial.print((i-1), DEC);
+        Serial.print(": Enable FilterMask of Buffer ");
+        Serial.println(i, DEC);
+
+        if (Module.enableFilterMask(i))
+        {
+            Serial.println("\t- Failed. Enable FilterMask successfull");
+            Module.disableFilterMask(i);
+            Errors++;
+            
+        } else {
+            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
+            {
+                Serial.print("\t- Failed. Enable FilterMask failed with wrong Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
+                Errors++;
+            } else {
+                Serial.println("\t- passed");
+            }
+        }
+
+        delay(500);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+uint8_t testDisableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test disableFilterMask-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test disableFilterMask-Function when not initialized");
+
+    if (Module.disableFilterMask(0)){
+        Serial.println("\t- Failed. Disnable FilterMask successfull");
+        Errors++;    
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Disable FilterMask failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test disableFilterMask-Function when initialized");
+    
+    if (!Module.disableFilterMask(0))
+    {
+        Serial.print("\t- Failed. Disable FilterMask not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+    
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test disableFilterMask-Function with defined Values");
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".3.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Disable FilterMask of Buffer ");
+        Serial.println(i, DEC);
+
+        if (!Module.disableFilterMask(i))
+        {
+            Serial.print("\t- Failed. Disable FilterMask failed with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+            
+        } else {
+            Serial.println("\t- passed");
+        }
+
+        delay(500);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test disableFilterMask-Function with undefined Values");
+
+    for (size_t i = 2; i < 4; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".4.");
+        Serial.print((i-1), DEC);
+        Serial.print(": Disable FilterMask of Buffer ");
+        Serial.println(i, DEC);
+
+        if (Module.disableFilterMask(i))
+        {
+            Serial.println("\t- Failed. Disnable FilterMask successfull");
+            Errors++;
+            
+        } else {
+            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
+            {
+                Serial.print("\t- Failed. Disable FilterMask failed with wrong Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
+                Errors++;
+            } else {
+                Serial.println("\t- passed");
+            }
+        }
+
+        delay(500);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+
+uint8_t testAcceptanceFilter(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    uint32_t Ids[8] = {0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107};
+    bool Extended[8] = {false, false, false, false, false, false, false, false};
+    uint32_t MixedIds[4] = {0x123, 0x18FF0102, 0x7FF, 0x18FF0103};
+    bool MixedExtended[4] = {false, true, false, true};
+    MCP2515FilterConfig Config;
+    uint32_t OffBusTime = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test Acceptance-Filter-Functions");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test setAcceptedIds-Function when not initialized");
+
+    if (Module.setAcceptedIds(Ids, Extended, 8, Config)){
+        Serial.println("\t- Failed. Set accepted IDs successfull");
+        Errors++;
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Set accepted IDs failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test compileFilters-Function with undefined Values");
+
+    MixedIds[2] = 0x800;
+
+    if (Module.compileFilters(Ids, Extended, 0, Config) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.compileFilters(Ids, Extended, MCP2515_MAX_FILTER_IDS + 1, Config) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.compileFilters(MixedIds, MixedExtended, 4, Config) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
+    {
+        Serial.print("\t- Failed. Compile Filters with undefined Values not detected, Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    MixedIds[2] = 0x7FF;
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test compileFilters-Function with up to 6 IDs (exact Filters)");
+
+    if (!Module.compileFilters(MixedIds, MixedExtended, 4, Config) ||
+        (Config.falseAccepts != 0) ||
+        (Config.falseAcceptRate != 0))
+    {
+        Serial.print("\t- Failed. Compile Filters not exact, ");
+        Serial.print(Config.falseAccepts, DEC);
+        Serial.print(" false Accepts, Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test compileFilters-Function with more than 6 IDs");
+
+    // 0x100 - 0x107 fits into one Filter with the Mask 0x7F8
+    if (!Module.compileFilters(Ids, Extended, 8, Config) ||
+        (Config.falseAccepts != 0))
+    {
+        Serial.print("\t- Failed. Compile Filters with ");
+        Serial.print(Config.falseAccepts, DEC);
+        Serial.print(" false Accepts, Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test setAcceptedIds-Function when initialized");
+
+    if (!Module.setAcceptedIds(MixedIds, MixedExtended, 4, Config) ||
+        (Module.getOperationMode() != MCP2515_OP_NORMAL))
+    {
+        Serial.print("\t- Failed. Set accepted IDs not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".6: Test setFilters-Function with undefined Values");
+
+    Config.masks[1] = 0x20000000;
+
+    if (Module.setFilters(Config))
+    {
+        Serial.println("\t- Failed. Set Filters successfull");
+        Errors++;
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
+        {
+            Serial.print("\t- Failed. Set Filters failed with wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".7: Test reprogramFilters-Function with unchanged Masks and Filters");
+
+    Module.compileFilters(MixedIds, MixedExtended, 4, Config);
+
+    if (!Module.reprogramFilters(Config, OffBusTime) ||
+        (OffBusTime != 0))
+    {
+        Serial.print("\t- Failed. Reprogram Filters not successfull with Error 0x");
+        Serial.print(Module.getLastMCPError(), HEX);
+        Serial.print(" after ");
+        Serial.print(OffBusTime, DEC);
+        Serial.println("us off Bus");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".8: Test reprogramFilters-Function with changed Filters");
+
+    MixedIds[0] = 0x124;
+    Module.compileFilters(MixedIds, MixedExtended, 4, Config);
+
+    if (!Module.reprogramFilters(Config, OffBusTime) ||
+        (OffBusTime == 0) ||
+        (Module.getOperationMode() != MCP2515_OP_NORMAL))
+    {
+        Serial.print("\t- Failed. Reprogram Filters not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.print("\t- passed (");
+        Serial.print(OffBusTime, DEC);
+        Serial.println("us off Bus)");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+
+uint8_t testCheck4FreeTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test check4FreeTransmitBuffer-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test check4FreeTransmitBuffer-Function when not initialized");
+
+    if (Module.check4FreeTransmitBuffer() != 0xFF){
+        Serial.println("\t- Failed. Check for a free Transmit-Buffer successfull");
+        Errors++;    
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Check for a free Transmit-Buffer failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test check4FreeTransmitBuffer-Function when initialized");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+    
+    if (Module.check4FreeTransmitBuffer() == 0xFF)
+    {
+        Serial.print("\t- Failed. Check for a free Transmit-Buffer not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+    
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test check4FreeTransmitBuffer-Function for each TX-Buffer");
+
+    Serial.println("\t- Reset all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.resetInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".3.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Check for a free Transmit-Buffer ");
+        Serial.println(i, DEC);
+
+        Serial.print("\t- Set \"Transmit-Buffer free\"-Flag for Buffer ");
+        Serial.println(i, DEC);
+
+        Module.setInterruptFlag((i + 2));
+
+        delay(500);
+
+        if (Module.check4FreeTransmitBuffer() != i)
+        {
+            Serial.print("\t\t- Failed. Check for a free Transmit-Buffer failed with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+            
+        } else {
+            Serial.println("\t\t- passed");
+        }
+
+        delay(500);
+
+        Module.resetInterruptFlag((i + 2));
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+uint8_t testFillTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Data[8] = {
+        1,
+        1,
+        1,
+        1
+    };
+
+    uint8_t Errors = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test fillTransmitBuffer-Function");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test fillTransmitBuffer-Function when not initialized");
+
+    if (Module.fillTransmitBuffer(0, 1, true, false, 4, Data)){
+        Serial.println("\t- Failed. Fill Transmit-Buffer successfull");
+        Errors++;    
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Fill Transmit-Buffer failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test fillTransmitBuffer-Function when initialized");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+    
+    if (!Module.fillTransmitBuffer(0, 1, true, false, 4, Data))
+    {
+        Serial.print("\t- Failed. Fill Transmit-Buffer not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+        Module.setInterruptFlag(2);
+    }
+
+    delay(1000);
+    
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test fillTransmitBuffer-Function for each TX-Buffer");
+
+    Serial.println("\t- Reset all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.resetInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        Serial.print(Teststep, DEC);
         Serial.print(".3.");
         Serial.print((i+1), DEC);
-        Serial.print(": Set Baudrate ");
-        Serial.print(possibleBaudRates[i]/1000, DEC);
-        Serial.println("kB");
+        Serial.print(": Fill Transmit-Buffer ");
+        Serial.println(i, DEC);
+
+        Serial.print("\t- Set \"Transmit-Buffer free\"-Flag for Buffer ");
+        Serial.println(i, DEC);
+
+        Module.setInterruptFlag((i + 2));
+
+        delay(500);
+
+        if (!Module.fillTransmitBuffer(i, 1, true, false, 4, Data))
+        {
+            Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+            
+        } else {
+            Serial.println("\t\t- passed");
+        }
+
+        delay(500);
+
+        Module.resetInterruptFlag((i + 2));
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test fillTransmitBuffer-Function for undefined TX-Buffer");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    for (size_t i = 3; i < 5; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".4.");
+        Serial.print((i-2), DEC);
+        Serial.print(": Fill Transmit-Buffer ");
+        Serial.println(i, DEC);
+
+        delay(500);
+
+        if (Module.fillTransmitBuffer(i, 1, true, false, 4, Data))
+        {
+            Serial.println("\t\t- Failed. Fill Transmit-Buffer successfull");
+            Module.setInterruptFlag((i + 2));
+            Errors++;
+            
+        } else {
+            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
+            {
+                Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with wrong Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
+                Errors++;
+            } else {
+                Serial.println("\t\t- passed");
+            }
+        }
+
+        delay(500);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test fillTransmitBuffer-Function for defined IDs");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        uint32_t ID = 150000000 * (i + 1);
+        Serial.print(Teststep, DEC);
+        Serial.print(".5.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Fill Transmit-Buffer with ID ");
+        Serial.println(ID, HEX);
+
+        delay(500);
+
+        if (!Module.fillTransmitBuffer(0, ID, true, false, 4, Data))
+        {
+            Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+            
+        } else {
+            Serial.println("\t\t- passed");
+        }
+
+        delay(500);
+
+        Module.setInterruptFlag(2);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".6: Test fillTransmitBuffer-Function for undefined IDs");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    for (size_t i = 3; i < 5; i++)
+    {
+        uint32_t ID = 540000000 + (i * 2);
+        Serial.print(Teststep, DEC);
+        Serial.print(".6.");
+        Serial.print((i-2), DEC);
+        Serial.print(": Fill Transmit-Buffer with ID ");
+        Serial.println(ID, HEX);
+
+        delay(500);
+
+        if (Module.fillTransmitBuffer(0, ID, true, false, 4, Data))
+        {
+            Serial.println("\t\t- Failed. Fill Transmit-Buffer successfull");
+            Module.setInterruptFlag(2);
+            Errors++;
+            
+        } else {
+            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
+            {
+                Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with wrong Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
+                Errors++;
+            } else {
+                Serial.println("\t\t- passed");
+            }
+        }
+
+        delay(500);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".7: Test fillTransmitBuffer-Function for Extended Enabler");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(".7.1: Fill Transmit-Buffer with Extended True");
+
+    if (!Module.fillTransmitBuffer(0, 1, true, false, 4, Data))
+    {
+        Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+        
+    } else {
+        Serial.println("\t\t- passed");
+    }
+
+    delay(500);
+
+    Module.setInterruptFlag(2);
+    
+    Serial.print(Teststep, DEC);
+    Serial.println(".7.2: Fill Transmit-Buffer with Extended False");
+
+    if (!Module.fillTransmitBuffer(0, 1, false, false, 4, Data))
+    {
+        Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+        
+    } else {
+        Serial.println("\t\t- passed");
+    }
+
+    Module.setInterruptFlag(2);
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".8: Test fillTransmitBuffer-Function for RTR Enabler");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(".8.1: Fill Transmit-Buffer with RTR True");
+
+    if (!Module.fillTransmitBuffer(0, 1, true, true, 4, Data))
+    {
+        Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+        
+    } else {
+        Serial.println("\t\t- passed");
+    }
+
+    delay(500);
+
+    Module.setInterruptFlag(2);
+    
+    Serial.print(Teststep, DEC);
+    Serial.println(".8.2: Fill Transmit-Buffer with Extended False");
+
+    if (!Module.fillTransmitBuffer(0, 1, true, false, 4, Data))
+    {
+        Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+        
+    } else {
+        Serial.println("\t\t- passed");
+    }
+
+    Module.setInterruptFlag(2);
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".9: Test fillTransmitBuffer-Function for defined DLCs");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    for (size_t i = 0; i < 9; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".9.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Fill Transmit-Buffer with DLC ");
+        Serial.println(i, DEC);
+
+        if (!Module.fillTransmitBuffer(0, 1, true, false, i, Data))
+        {
+            Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+            
+        } else {
+            Serial.println("\t\t- passed");
+        }
+
+        delay(500);
+
+        Module.setInterruptFlag(2);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".10: Test fillTransmitBuffer-Function for undefined DLCs");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    for (size_t i = 9; i < 12; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".10.");
+        Serial.print((i-8), DEC);
+        Serial.print(": Fill Transmit-Buffer with DLC ");
+        Serial.println(i, DEC);
+
+        if (Module.fillTransmitBuffer(0, 1, true, false, i, Data))
+        {
+            Serial.print("\t\t- Failed. Fill Transmit-Buffer successfull");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+            
+        } else {
+            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
+            {
+                Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with wrong Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
+                Errors++;
+            } else {
+                Serial.println("\t\t- passed");
+            }
+        }
+
+        delay(500);
+
+        Module.setInterruptFlag(2);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".11: Test fillTransmitBuffer-Function with no free Transmit-Buffer");
+
+    Serial.println("\t- Reset all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.resetInterruptFlag((i + 2));
+    }
+    
+    delay(500);
+
+    if (Module.fillTransmitBuffer(0, 1, true, false, 4, Data))
+    {
+        Serial.println("\t- Failed. Fill Transmit-Buffer successfull");
+        Errors++;
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE) != ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE)
+        {
+            Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t\t- passed");
+        }
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+uint8_t testSendMessage(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint32_t ID = 1;
+    bool Extended = false;
+    bool RTR = false;
+    uint8_t DLC = 2;
+    uint8_t Data[2] = {
+        1,
+        1
+    };
 
-        if (!Module.changeBaudRate(possibleBaudRates[i])){
-            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
-                Serial.print("\t- Failed with Error 0x");
-                Serial.print(Module.getLastMCPError(), HEX);
-                Serial.println(".");
-                Errors++;
-            } else {
-                Serial.print("\t- Baudrate for choosen ClockFrequency ");
-                Serial.print(defaultClockFrequency/1000000, DEC);
-                Serial.println("MHz not defined. No Error!");
-            }
-        } else {
-            Serial.println("\t- passed");
-        }
+    uint8_t Errors = 0;
 
-        delay(500);
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
     }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test sendMessage-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".4: Test undefined Baudrates in changeBaudRate-Function");
-    uint32_t undefinedBaudrates[4] = {
-        (uint32_t)0,
-        (uint32_t)6e3,
-        (uint32_t)110e3,
-        (uint32_t)1100e3,
-    };
-
-    for (size_t i = 0; i < 4; i++)
-    {
-        Serial.print(Teststep, DEC);
-        Serial.print(".4.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Baudrate ");
-        Serial.print(undefinedBaudrates[i]/1000, DEC);
-        Serial.println("kB");
+    Serial.println(".1: Test sendMessage-Function when not initialized");
 
-        if (!Module.changeBaudRate(undefinedBaudrates[i])){
-            if ((Module.getLastMCPError() & ERROR_MCP2515_BAUDRATE_NOT_VALID) != ERROR_MCP2515_BAUDRATE_NOT_VALID){
-                Serial.print("\t- Failed. False Error during changeBaudRate with undefined Baudrate ");
-                Serial.print(undefinedBaudrates[i]/1000, DEC);
-                Serial.println("kB");
-                Serial.print("\t- Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            } else {
-                Serial.println("\t- passed");
-            }
-        } else {
-            Serial.print("\t- Failed. No Error during changeBaudRate with undefined Baudrate ");
-            Serial.print(undefinedBaudrates[i]/1000, DEC);
-            Serial.println("kB");
+    if (Module.sendMessage(0, 0)){
+        Serial.println("\t- Failed. Send Message successfull");
+        Errors++;    
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        {
+            Serial.print("\t- Failed. Send Message failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
+        } else {
+            Serial.println("\t- passed");
         }
-        
-        delay(500);
     }
-
+    
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".5: Test changeBaudRate from OperationMode ListenOnly");
-
-    for (size_t i = 0; i < 12; i++){
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
 
-        while (!Module.setListenOnlyMode()){
-            delay(100);
-        }
-        delay(500);
+    Serial.println("- Set OperationMode Loopback");
+    while (!Module.setLoopbackMode()){
+        delay(100);
+    }
 
-        Serial.print(Teststep, DEC);
-        Serial.print(".5.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Set Baudrate ");
-        Serial.print(possibleBaudRates[i]/1000, DEC);
-        Serial.println("kB");
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test sendMessage-Function when initialized");
 
-        if (!Module.changeBaudRate(possibleBaudRates[i])){
-            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
-                Serial.print("\t- Failed with Error 0x");
-                Serial.print(Module.getLastMCPError(), HEX);
-                Serial.println(".");
-                Errors++;
-            } else {
-                Serial.print("\t- Baudrate ");
-                Serial.print(possibleBaudRates[i]/1000, DEC);
-                Serial.print("kB for choosen ClockFrequency ");
-                Serial.print(defaultClockFrequency/1000000, DEC);
-                Serial.println("MHz not defined. No Error!");
-            }
-        } else {
-            if (Module.getOperationMode() != MCP2515_OP_LISTEN)
-            {
-                Serial.println("\t- failed. ChangeBaudrate didn't finish in ListenOnly-Mode.");
-                Errors++;
-            } else {
-                Serial.println("\t- passed");
-            }            
-        }
-        delay(500);
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
     }
+    
+    delay(500);
 
-    while (!Module.setNormalMode()){
+    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+    while (!Module.fillTransmitBuffer(0, ID, Extended, RTR, DLC, Data)){
         delay(100);
     }
+    
+    delay(500);
+    
+    Serial.println("\t- send Message");
+    if (!Module.sendMessage(0, 0))
+    {
+        Serial.print("\t\t- Failed. Send Message not successfull in initialized Mode with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t\t- passed");
+    }
 
     delay(1000);
-
+    
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".6: Test changeBaudRate from OperationMode Loopback");
+    Serial.println(".3: Test sendMessage-Function with each TX-Buffer");
 
-    for (size_t i = 0; i < 12; i++){
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
 
-        while (!Module.setLoopbackMode()){
+    for (size_t i = 0; i < 3; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".3.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Send Message from Transmit-Buffer ");
+        Serial.println(i, DEC);
+
+        Serial.print("\t- Fill Transmit-Buffer ");
+        Serial.print(i, DEC);
+        Serial.println(" with Data");
+        while (!Module.fillTransmitBuffer(i, ID, Extended, RTR, DLC, Data)){
             delay(100);
         }
-        delay(500);
 
-        Serial.print(Teststep, DEC);
-        Serial.print(".6.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Set Baudrate ");
-        Serial.print(possibleBaudRates[i]/1000, DEC);
-        Serial.println("kB");
+        delay(500);
 
-        if (!Module.changeBaudRate(possibleBaudRates[i])){
-            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
-                Serial.print("\t- Failed with Error 0x");
-                Serial.print(Module.getLastMCPError(), HEX);
-                Serial.println(".");
-                Errors++;
-            } else {
-                Serial.print("\t- Baudrate ");
-                Serial.print(possibleBaudRates[i]/1000, DEC);
-                Serial.print("kB for choosen ClockFrequency ");
-                Serial.print(defaultClockFrequency/1000000, DEC);
-                Serial.println("MHz not defined. No Error!");
-            }
+        if (!Module.sendMessage(i, 0))
+        {
+            Serial.print("\t\t- Failed. Send Message failed with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+            
         } else {
-            if (Module.getOperationMode() != MCP2515_OP_LOOPBACK)
-            {
-                Serial.println("\t- failed. ChangeBaudrate didn't finish in Loopback-Mode.");
-                Errors++;
-            } else {
-                Serial.println("\t- passed");
-            }            
+            Serial.println("\t\t- passed");
         }
-        delay(500);
-    }
 
-    while (!Module.setNormalMode()){
-        delay(100);
+        delay(500);
     }
-
+    
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".7: Test changeBaudRate from OperationMode Configuration");
-
-    for (size_t i = 0; i < 12; i++){
+    Serial.println(".4: Test sendMessage-Function with undefined TX-Buffer");
 
-        while (!Module.setConfigurationMode()){
-            delay(100);
-        }
-        delay(500);
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
 
+    for (size_t i = 3; i < 6; i++)
+    {
         Serial.print(Teststep, DEC);
-        Serial.print(".7.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Set Baudrate ");
-        Serial.print(possibleBaudRates[i]/1000, DEC);
-        Serial.println("kB");
+        Serial.print(".4.");
+        Serial.print((i-2), DEC);
+        Serial.print(": Send Message from Transmit-Buffer ");
+        Serial.println(i, DEC);
 
-        if (!Module.changeBaudRate(possibleBaudRates[i])){
-            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
-                Serial.print("\t- Failed with Error 0x");
-                Serial.print(Module.getLastMCPError(), HEX);
-                Serial.println(".");
-                Errors++;
-            } else {
-                Serial.print("\t- Baudrate ");
-                Serial.print(possibleBaudRates[i]/1000, DEC);
-                Serial.print("kB for choosen ClockFrequency ");
-                Serial.print(defaultClockFrequency/1000000, DEC);
-                Serial.println("MHz not defined. No Error!");
-            }
+        delay(500);
+
+        if (Module.sendMessage(i, 0))
+        {
+            Serial.println("\t\t- Failed. Send Message successfull");
+            Errors++;
+            
         } else {
-            if (Module.getOperationMode() != MCP2515_OP_CONFIGURATION)
+            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
             {
-                Serial.println("\t- failed. ChangeBaudrate didn't finish in Configuration-Mode.");
+                Serial.print("\t\t- Failed. Send Message failed with wrong Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
                 Errors++;
             } else {
-                Serial.println("\t- passed");
-            }            
+                Serial.println("\t\t- passed");
+            }
         }
-        delay(500);
-    }
 
-    while (!Module.setNormalMode()){
-        delay(100);
+        delay(500);
     }
-
+    
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".8: Test changeBaudRate from OperationMode Normal");
+    Serial.println(".5: Test sendMessage-Function with defined Priority");
 
-    for (size_t i = 0; i < 12; i++){
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
 
-        while (!Module.setNormalMode()){
+    for (size_t i = 0; i < 4; i++)
+    {
+        Serial.print(Teststep, DEC);
+        Serial.print(".5.");
+        Serial.print((i+1), DEC);
+        Serial.print(": Send Message with Priority ");
+        Serial.println(i, DEC);
+
+        Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+        while (!Module.fillTransmitBuffer(0, ID, Extended, RTR, DLC, Data)){
             delay(100);
         }
+
+        delay(500);
+
+        if (!Module.sendMessage(0, i))
+        {
+            Serial.print("\t\t- Failed. Send Message failed with Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+            
+        } else {
+            Serial.println("\t\t- passed");
+        }
+
         delay(500);
+    }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".6: Test sendMessage-Function with undefined Priority");
+
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
 
+    for (size_t i = 5; i < 7; i++)
+    {
         Serial.print(Teststep, DEC);
-        Serial.print(".8.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Set Baudrate ");
-        Serial.print(possibleBaudRates[i]/1000, DEC);
-        Serial.println("kB");
+        Serial.print(".6.");
+        Serial.print((i-4), DEC);
+        Serial.print(": Send Message with Priority ");
+        Serial.println(i, DEC);
 
-        if (!Module.changeBaudRate(possibleBaudRates[i])){
-            if ((Module.getLastMCPError() & ERROR_MCP2515_CNF_NOT_FOUND) != ERROR_MCP2515_CNF_NOT_FOUND){
-                Serial.print("\t- Failed with Error 0x");
-                Serial.print(Module.getLastMCPError(), HEX);
-                Serial.println(".");
-                Errors++;
-            } else {
-                Serial.print("\t- Baudrate ");
-                Serial.print(possibleBaudRates[i]/1000, DEC);
-                Serial.print("kB for choosen ClockFrequency ");
-                Serial.print(defaultClockFrequency/1000000, DEC);
-                Serial.println("MHz not defined. No Error!");
-            }
+        delay(500);
+
+        if (Module.sendMessage(i, 0))
+        {
+            Serial.println("\t\t- Failed. Send Message successfull");
+            Errors++;
+            
         } else {
-            if (Module.getOperationMode() != MCP2515_OP_NORMAL)
+            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
             {
-                Serial.println("\t- failed. ChangeBaudrate didn't finish in Normal-Mode.");
+                Serial.print("\t\t- Failed. Send Message failed with wrong Error 0x");
+                Serial.println(Module.getLastMCPError(), HEX);
                 Errors++;
             } else {
-                Serial.println("\t- passed");
-            }            
+                Serial.println("\t\t- passed");
+            }
         }
         delay(500);
     }
+    
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".7: Test sendMessage-Function without CAN-Bus");
 
+    Serial.println("\t- Set OperationMode Normal");
     while (!Module.setNormalMode()){
         delay(100);
     }
 
-    delay(1000);
+    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
+    for (size_t i = 0; i < 3; i++)
+    {
+        Module.setInterruptFlag((i + 2));
+    }
+    
+    delay(500);
 
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".9: Test changeBaudRate from OperationMode Sleep");
-    Serial.println("\t- Makes no sense!");
+    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+    while (!Module.fillTransmitBuffer(0, ID, Extended, RTR, DLC, Data)){
+        delay(100);
+    }
 
+    Serial.println("\t- Send Message");
+    if (Module.sendMessage(0, 0))
+    {
+        Serial.println("\t\t- Failed. Send Message successfull");
+        Errors++;
+        
+    } else {
+        if (((Module.getLastMCPError() & 0x0010) != 0x0010) && ((Module.getLastMCPError() & 0x0020) != 0x0020))
+        {
+            Serial.print("\t\t- Failed. Send Message failed with wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t\t- passed");
+        }
+    }
+    
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    delay(500);
-    Module.changeBaudRate(defaultBaudrate);
-    delay(500);
+    delay(1000);
     Serial.print(Teststep, DEC);
     Serial.print(": Tests executed with ");
     Serial.print(Errors, DEC);
@@ -1820,16 +4957,18 @@ uint8_t testChangeBaudRate(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSe
     delay(1000);
 
     return Errors;
-};
+}
 
-uint8_t testChangeInterruptSetting(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+uint8_t testSendMessageOneShot(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
-    uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
     uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
     uint8_t Errors = 0;
+    uint32_t ID = 0x123;
+    uint8_t Data[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
 
     delay(500);
     if (Module.getIsInitialized())
@@ -1839,24 +4978,21 @@ uint8_t testChangeInterruptSetting(uint8_t Teststep, MCP2515 &Module, uint32_t d
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test changeInterruptSetting-Function");
-    Serial.println();
-    Serial.println("Please be sure that the Interrupt-Pin is connected correctly!");
+    Serial.println(": Test sendMessageOneShot-Function");
 
-    delay(5000);
+    delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test changeInterruptSetting-Function when not initialized");
+    Serial.println(".1: Test sendMessageOneShot-Function when not initialized");
 
-    if (Module.changeInterruptSetting(true, 1)){
-        Serial.println("\t- Failed. Change InterruptSetting successfull");
-        Module.changeInterruptSetting(false, 1);
-        Errors++;    
+    if (Module.sendMessageOneShot(0, 0) != MCP2515_TX_RESULT_FAILED){
+        Serial.println("\t- Failed. Send Message successfull");
+        Errors++;
     } else {
         if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
         {
-            Serial.print("\t- Failed. Change InterruptSetting failed with the wrong Error 0x");
+            Serial.print("\t- Failed. Send Message failed with the wrong Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
         } else {
@@ -1869,145 +5005,166 @@ uint8_t testChangeInterruptSetting(uint8_t Teststep, MCP2515 &Module, uint32_t d
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
         delay(100);
-    }   
-    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".2: Test changeInterruptSetting-Function when initialized");
-
-    if (!Module.changeInterruptSetting(true, 1))
-    {
-        Serial.print("\t- Failed. Change InterruptSetting not successfull in initialized Mode with Error 0x");
-        Serial.println(Module.getLastMCPError(), HEX);
-        Errors++;
-    } else {
-        Serial.println("\t- passed");
-        Module.changeInterruptSetting(false, 1);
     }
 
-    delay(1000);
-    
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test changeInterruptSetting-Function with defined Values");
+    Serial.println(".2: Test sendMessageOneShot-Function with undefined Buffer and Priority");
 
-    for (size_t i = 0; i < 8; i++)
+    if (Module.sendMessageOneShot(3, 0) != MCP2515_TX_RESULT_FAILED ||
+        Module.sendMessageOneShot(0, 4) != MCP2515_TX_RESULT_FAILED)
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".3.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Change Interrupt ");
-        Serial.print(i, DEC);
-        Serial.println(" to true");
-
-        if (!Module.changeInterruptSetting(true, i))
+        Serial.println("\t- Failed. Send Message successfull");
+        Errors++;
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
         {
-            Serial.print("\t- Failed. Change InterruptSetting failed with Error 0x");
+            Serial.print("\t- Failed. Send Message failed with the wrong Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
-
         } else {
             Serial.println("\t- passed");
-            Module.changeInterruptSetting(false, i);
         }
-
-        delay(500);
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".4: Test changeInterruptSetting-Function with undefined Values");
+    Serial.println(".3: Test sendMessageOneShot-Function in Loopback-Mode");
 
-    for (size_t i = 8; i < 14; i++)
+    Serial.println("\t- Set OperationMode Loopback");
+    while (!Module.setLoopbackMode()){
+        delay(100);
+    }
+
+    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+    while (!Module.fillTransmitBuffer(0, ID, false, false, 8, Data)){
+        delay(100);
+    }
+
+    if (Module.sendMessageOneShot(0, 0) != MCP2515_TX_RESULT_SUCCESS)
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".4.");
-        Serial.print((i-8), DEC);
-        Serial.print(": Change Interrupt ");
-        Serial.print(i, DEC);
-        Serial.println(" to true");
+        Serial.print("\t- Failed. Send Message not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if (Module.getOneShotMode())
+    {
+        Serial.println("\t- Failed. One-Shot-Mode is still enabled");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
 
-        if (Module.changeInterruptSetting(true, i))
-        {
-            Serial.println("\t- Failed. Change InterruptSetting successfull");
-            Errors++;
+    delay(1000);
 
-        } else {
-            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
-            {
-                Serial.print("\t- Failed. Change InterruptSetting failed with wrong Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            } else {
-                Serial.println("\t- passed");
-            }
-        }
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test sendMessageOneShot-Function without CAN-Bus");
 
-        delay(500);
+    Serial.println("\t- Set OperationMode Normal");
+    while (!Module.setNormalMode()){
+        delay(100);
+    }
+
+    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+    while (!Module.fillTransmitBuffer(0, ID, false, false, 8, Data)){
+        delay(100);
+    }
+
+    uint8_t Result = Module.sendMessageOneShot(0, 0);
+
+    if (Result == MCP2515_TX_RESULT_SUCCESS || Result == MCP2515_TX_RESULT_FAILED)
+    {
+        Serial.print("\t- Failed. Send Message returned 0x");
+        Serial.println(Result, HEX);
+        Errors++;
+    } else if (Module.check4FreeTransmitBuffer() != 0)
+    {
+        Serial.println("\t- Failed. Transmit-Buffer 0 was not released");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".5: Test if Interrupts occurs on INT-Pin");
+    Serial.println(".5: Test sendMessage-Function with enabled One-Shot-Mode without CAN-Bus");
 
-    for (size_t i = 0; i < 8; i++)
+    if (!Module.setOneShotMode(true) || !Module.getOneShotMode())
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".5.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Test Interrupt ");
-        Serial.println(i, DEC);
-
-        while (!Module.resetInterruptFlag(i))
-        {
+        Serial.print("\t- Failed. Enable One-Shot-Mode failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+        while (!Module.fillTransmitBuffer(0, ID, false, false, 8, Data)){
             delay(100);
         }
 
-        Serial.println("\t- set Interrupt-Enabler true");
-
-        while (!Module.changeInterruptSetting(true, i))
+        if (Module.sendMessage(0, 0))
         {
-            delay(100);
+            Serial.println("\t- Failed. Send Message successfull");
+            Errors++;
+        } else if ((Module.getLastMCPError() & ERROR_MCP2515_ONE_SHOT_NOT_TRANSMITTED) != ERROR_MCP2515_ONE_SHOT_NOT_TRANSMITTED)
+        {
+            Serial.print("\t- Failed. Send Message failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
         }
 
-        delay(500);
-        Serial.print("\t\t- corresponding Flag-Value ");
-        Serial.println((((Module.check4InterruptFlags() & (0x01 << i)) > 0) ? 1 : 0), DEC);
+        Module.setOneShotMode(false);
+    }
 
-        Serial.println("\t- set corresponding Flag");
-        while (!Module.setInterruptFlag(i))
-        {
-            delay(100);
-        }
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".6: Test sendMessageOneShot-Function while another Transmit-Buffer is pending");
 
+    Serial.println("\t- Fill Transmit-Buffer 0 and 1 with Data");
+    while (!Module.fillTransmitBuffer(0, ID, false, false, 8, Data) ||
+           !Module.fillTransmitBuffer(1, ID, false, false, 8, Data)){
         delay(100);
+    }
 
-        Serial.println("\t- Check Value of the INT-Pin");
+    if (!Module.sendMessageTimeout(1, 0, 10000, true))
+    {
+        Serial.print("\t- Failed. Send Message Timeout not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Result = Module.sendMessageOneShot(0, 0);
 
-        if (digitalRead(INT_Pin) == 0)
+        if (Result != MCP2515_TX_RESULT_FAILED)
         {
-            Serial.println("\t\t- passed");
-        } else {
-            Serial.println("\t\t- no Interrupt occured");
+            Serial.print("\t- Failed. Send Message returned 0x");
+            Serial.println(Result, HEX);
             Errors++;
-        }
-
-        while (!Module.resetInterruptFlag(i))
+        } else if ((Module.getLastMCPError() & ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE) != ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE)
         {
-            delay(100);
-        }
-
-        while (!Module.changeInterruptSetting(false, i))
+            Serial.print("\t- Failed. Send Message failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else if (Module.getOneShotMode())
         {
-            delay(100);
+            Serial.println("\t- Failed. One-Shot-Mode is enabled");
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
         }
 
-        delay(500);
+        uint32_t Start = millis();
+
+        while ((Module.getPendingTransmissions() != 0x00) && ((millis() - Start) < 100)){
+            Module.handleInterrupt();
+        }
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2022,8 +5179,7 @@ uint8_t testChangeInterruptSetting(uint8_t Teststep, MCP2515 &Module, uint32_t d
     return Errors;
 }
 
-
-uint8_t testEnableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+uint8_t testSendBuffers(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
@@ -2031,6 +5187,12 @@ uint8_t testEnableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t default
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
     uint8_t Errors = 0;
+    uint8_t Data[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    MCP2515Frame Frames[3] = {
+        {0x100, false, false, 8, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}},
+        {0x12345678, true, false, 4, {0x11, 0x12, 0x13, 0x14, 0x00, 0x00, 0x00, 0x00}},
+        {0x300, false, true, 0, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+    };
 
     delay(500);
     if (Module.getIsInitialized())
@@ -2040,112 +5202,174 @@ uint8_t testEnableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t default
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test enableFilterMask-Function");
+    Serial.println(": Test sendBuffers-/sendFrames-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test enableFilterMask-Function when not initialized");
+    Serial.println(".1: Test sendBuffers-/sendFrames-Function when not initialized");
 
-    if (Module.enableFilterMask(0)){
-        Serial.println("\t- Failed. Enable FilterMask successfull");
-        Module.disableFilterMask(0);
-        Errors++;    
+    if (Module.sendBuffers(0x07) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED) ||
+        Module.sendFrames(Frames, 3) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED))
+    {
+        Serial.print("\t- Failed. Send Buffers successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test sendBuffers-/sendFrames-Function with undefined Mask and Count");
+
+    uint8_t InvalidMasks[2] = {0x00, 0x08};
+    uint8_t InvalidCounts[2] = {0, 4};
+    bool StepFailed = false;
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        if (Module.sendBuffers(InvalidMasks[i]) ||
+            ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+            Module.sendFrames(Frames, InvalidCounts[i]) ||
+            ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
         {
-            Serial.print("\t- Failed. Enable FilterMask failed with the wrong Error 0x");
+            Serial.print("\t- Failed. Send Buffers successfull or failed with the wrong Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
+            StepFailed = true;
         }
     }
-    
+
+    if (StepFailed)
+    {
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test sendBuffers-Function with all TX-Buffers in Loopback-Mode");
+
+    Serial.println("\t- Set OperationMode Loopback");
+    while (!Module.setLoopbackMode()){
         delay(100);
     }
 
+    Serial.println("\t- Fill Transmit-Buffer 0 - 2 with Data");
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        while (!Module.fillTransmitBuffer(i, (0x200 + i), false, false, 8, Data)){
+            delay(100);
+        }
+    }
+
+    if (!Module.sendBuffers(0x07))
+    {
+        Serial.print("\t- Failed. Send Buffers not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test enableFilterMask-Function when initialized");
-    
-    if (!Module.enableFilterMask(0))
+    Serial.println(".4: Test sendFrames-Function in Loopback-Mode");
+
+    if (!Module.sendFrames(Frames, 3))
     {
-        Serial.print("\t- Failed. Enable FilterMask not successfull in initialized Mode with Error 0x");
+        Serial.print("\t- Failed. Send Frames not successfull with Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
     } else {
         Serial.println("\t- passed");
-        Module.disableFilterMask(0);
     }
 
     delay(1000);
-    
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test enableFilterMask-Function with defined Values");
+    Serial.println(".5: Test sendFrames-Function without CAN-Bus");
 
-    for (size_t i = 0; i < 2; i++)
+    Serial.println("\t- Set OperationMode Normal");
+    while (!Module.setNormalMode()){
+        delay(100);
+    }
+
+    if (Module.sendFrames(Frames, 3))
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".3.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Enable FilterMask of Buffer ");
-        Serial.println(i, DEC);
+        Serial.println("\t- Failed. Send Frames successfull");
+        Errors++;
+    } else if ((Module.getLastMCPError() & ERROR_MCP2515_MESSAGE_SENDING_ABORTED) != ERROR_MCP2515_MESSAGE_SENDING_ABORTED)
+    {
+        Serial.print("\t- Failed. Send Frames failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        StepFailed = false;
 
-        if (!Module.enableFilterMask(i))
+        for (uint8_t i = 0; i < 3; i++)
         {
-            Serial.print("\t- Failed. Enable FilterMask failed with Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
+            if (!Module.fillTransmitBuffer(i, (0x200 + i), false, false, 8, Data))
+            {
+                StepFailed = true;
+            }
+        }
+
+        if (StepFailed)
+        {
+            Serial.println("\t- Failed. Transmit-Buffers were not released");
             Errors++;
-            
         } else {
             Serial.println("\t- passed");
-            Module.disableFilterMask(i);
         }
-
-        delay(500);
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".4: Test enableFilterMask-Function with undefined Values");
+    Serial.println(".6: Test sendBuffers-Function in One-Shot-Mode without CAN-Bus");
 
-    for (size_t i = 2; i < 4; i++)
+    Serial.println("\t- Set One-Shot-Mode");
+    while (!Module.setOneShotMode(true)){
+        delay(100);
+    }
+
+    if (Module.sendBuffers(0x07))
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".4.");
-        Serial.print((i-1), DEC);
-        Serial.print(": Enable FilterMask of Buffer ");
-        Serial.println(i, DEC);
+        Serial.println("\t- Failed. Send Buffers successfull");
+        Errors++;
+    } else if ((Module.getLastMCPError() & ERROR_MCP2515_ONE_SHOT_NOT_TRANSMITTED) != ERROR_MCP2515_ONE_SHOT_NOT_TRANSMITTED)
+    {
+        Serial.print("\t- Failed. Send Buffers failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if (!Module.fillTransmitBuffer(0, 0x200, false, false, 8, Data))
+    {
+        Serial.println("\t- Failed. Transmit-Buffers were not released");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
 
-        if (Module.enableFilterMask(i))
-        {
-            Serial.println("\t- Failed. Enable FilterMask successfull");
-            Module.disableFilterMask(i);
-            Errors++;
-            
-        } else {
-            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
-            {
-                Serial.print("\t- Failed. Enable FilterMask failed with wrong Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            } else {
-                Serial.println("\t- passed");
-            }
-        }
+    Module.setOneShotMode(false);
 
-        delay(500);
-    }
-    
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2160,7 +5384,30 @@ uint8_t testEnableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t default
     return Errors;
 }
 
-uint8_t testDisableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+// Values of the last call of the Transmit-Callback
+volatile uint8_t _transmitCallbackCount = 0;
+volatile uint8_t _transmitCallbackBuffer = 0xFF;
+volatile uint32_t _transmitCallbackTag = 0;
+volatile uint8_t _transmitCallbackFlags = 0;
+
+void _onTransmit(uint8_t BufferNumber, uint32_t Tag, uint32_t Timestamp, uint8_t Flags){
+    _transmitCallbackCount++;
+    _transmitCallbackBuffer = BufferNumber;
+    _transmitCallbackTag = Tag;
+    _transmitCallbackFlags = Flags;
+}
+
+bool _waitForTransmitCallback(MCP2515 &Module, uint32_t Timeout){
+    uint32_t Start = millis();
+
+    while ((Module.getPendingTransmissions() != 0x00) && ((millis() - Start) < Timeout)){
+        Module.handleInterrupt();
+    }
+
+    return (Module.getPendingTransmissions() == 0x00);
+}
+
+uint8_t testStartTransmission(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
@@ -2168,6 +5415,8 @@ uint8_t testDisableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
     uint8_t Errors = 0;
+    uint32_t ID = 0x123;
+    uint8_t Data[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
 
     delay(500);
     if (Module.getIsInitialized())
@@ -2177,108 +5426,157 @@ uint8_t testDisableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test disableFilterMask-Function");
+    Serial.println(": Test startTransmission-/handleInterrupt-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test disableFilterMask-Function when not initialized");
+    Serial.println(".1: Test startTransmission-/handleInterrupt-Function when not initialized");
 
-    if (Module.disableFilterMask(0)){
-        Serial.println("\t- Failed. Disnable FilterMask successfull");
-        Errors++;    
+    if (Module.startTransmission(0, 0, 1) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED) ||
+        (Module.handleInterrupt() != EMPTY_VALUE_8_BIT) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED))
+    {
+        Serial.print("\t- Failed. Start Transmission successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    Module.setTransmitCallback(_onTransmit);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test startTransmission-Function with undefined Buffer and Priority");
+
+    if (Module.startTransmission(3, 0, 1) ||
+        Module.startTransmission(0, 4, 1))
+    {
+        Serial.println("\t- Failed. Start Transmission successfull");
+        Errors++;
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
         {
-            Serial.print("\t- Failed. Disable FilterMask failed with the wrong Error 0x");
+            Serial.print("\t- Failed. Start Transmission failed with the wrong Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
         } else {
             Serial.println("\t- passed");
         }
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test startTransmission-Function in Loopback-Mode");
+
+    Serial.println("\t- Set OperationMode Loopback");
+    while (!Module.setLoopbackMode()){
         delay(100);
     }
 
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".2: Test disableFilterMask-Function when initialized");
-    
-    if (!Module.disableFilterMask(0))
+    Serial.println("\t- Fill Transmit-Buffer 1 with Data");
+    while (!Module.fillTransmitBuffer(1, ID, false, false, 8, Data)){
+        delay(100);
+    }
+
+    _transmitCallbackCount = 0;
+
+    if (!Module.startTransmission(1, 0, 0xCAFE))
     {
-        Serial.print("\t- Failed. Disable FilterMask not successfull in initialized Mode with Error 0x");
+        Serial.print("\t- Failed. Start Transmission not successfull with Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
+    } else if (Module.startTransmission(1, 0, 0xBEEF) ||
+               ((Module.getLastMCPError() & ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE) != ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE))
+    {
+        Serial.println("\t- Failed. Second Start Transmission of a pending Buffer not rejected");
+        Errors++;
+    } else if (!_waitForTransmitCallback(Module, 100))
+    {
+        Serial.println("\t- Failed. Transmission not completed");
+        Errors++;
+    } else if ((_transmitCallbackCount != 1) ||
+               (_transmitCallbackBuffer != 1) ||
+               (_transmitCallbackTag != 0xCAFE) ||
+               (_transmitCallbackFlags != 0x00))
+    {
+        Serial.print("\t- Failed. Transmit-Callback called with Buffer ");
+        Serial.print(_transmitCallbackBuffer, DEC);
+        Serial.print(" Tag 0x");
+        Serial.print(_transmitCallbackTag, HEX);
+        Serial.print(" Flags 0x");
+        Serial.println(_transmitCallbackFlags, HEX);
+        Errors++;
     } else {
         Serial.println("\t- passed");
     }
 
     delay(1000);
-    
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test disableFilterMask-Function with defined Values");
+    Serial.println(".4: Test startTransmission-Function with enabled One-Shot-Mode without CAN-Bus");
 
-    for (size_t i = 0; i < 2; i++)
-    {
-        Serial.print(Teststep, DEC);
-        Serial.print(".3.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Disable FilterMask of Buffer ");
-        Serial.println(i, DEC);
+    Serial.println("\t- Set OperationMode Normal");
+    while (!Module.setNormalMode()){
+        delay(100);
+    }
 
-        if (!Module.disableFilterMask(i))
-        {
-            Serial.print("\t- Failed. Disable FilterMask failed with Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-            
-        } else {
-            Serial.println("\t- passed");
-        }
+    while (!Module.setOneShotMode(true)){
+        delay(100);
+    }
 
-        delay(500);
+    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+    while (!Module.fillTransmitBuffer(0, ID, false, false, 8, Data)){
+        delay(100);
     }
-    
-    delay(1000);
 
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".4: Test disableFilterMask-Function with undefined Values");
+    _transmitCallbackCount = 0;
 
-    for (size_t i = 2; i < 4; i++)
+    if (!Module.startTransmission(0, 0, 0x1234))
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".4.");
-        Serial.print((i-1), DEC);
-        Serial.print(": Disable FilterMask of Buffer ");
-        Serial.println(i, DEC);
+        Serial.print("\t- Failed. Start Transmission not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if (!_waitForTransmitCallback(Module, 100))
+    {
+        Serial.println("\t- Failed. Transmission not completed");
+        Errors++;
+    } else if ((_transmitCallbackCount != 1) ||
+               (_transmitCallbackBuffer != 0) ||
+               (_transmitCallbackTag != 0x1234) ||
+               ((_transmitCallbackFlags & MCP2515_TX_FLAG_NOT_TRANSMITTED) != MCP2515_TX_FLAG_NOT_TRANSMITTED))
+    {
+        Serial.print("\t- Failed. Transmit-Callback called with Buffer ");
+        Serial.print(_transmitCallbackBuffer, DEC);
+        Serial.print(" Tag 0x");
+        Serial.print(_transmitCallbackTag, HEX);
+        Serial.print(" Flags 0x");
+        Serial.println(_transmitCallbackFlags, HEX);
+        Errors++;
+    } else if (Module.check4FreeTransmitBuffer() != 0)
+    {
+        Serial.println("\t- Failed. Transmit-Buffer 0 was not released");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
 
-        if (Module.disableFilterMask(i))
-        {
-            Serial.println("\t- Failed. Disnable FilterMask successfull");
-            Errors++;
-            
-        } else {
-            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
-            {
-                Serial.print("\t- Failed. Disable FilterMask failed with wrong Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            } else {
-                Serial.println("\t- passed");
-            }
-        }
+    Module.setOneShotMode(false);
+    Module.setTransmitCallback(NULL);
 
-        delay(500);
-    }
-    
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2293,8 +5591,7 @@ uint8_t testDisableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t defaul
     return Errors;
 }
 
-
-uint8_t testCheck4FreeTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+uint8_t testSendMessageTimeout(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
@@ -2302,6 +5599,8 @@ uint8_t testCheck4FreeTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
     uint8_t Errors = 0;
+    uint32_t ID = 0x123;
+    uint8_t Data[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
 
     delay(500);
     if (Module.getIsInitialized())
@@ -2311,28 +5610,28 @@ uint8_t testCheck4FreeTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test check4FreeTransmitBuffer-Function");
+    Serial.println(": Test sendMessageTimeout-Function");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test check4FreeTransmitBuffer-Function when not initialized");
+    Serial.println(".1: Test sendMessageTimeout-Function when not initialized");
 
-    if (Module.check4FreeTransmitBuffer() != 0xFF){
-        Serial.println("\t- Failed. Check for a free Transmit-Buffer successfull");
-        Errors++;    
+    if (Module.sendMessageTimeout(0, 0, 10000)){
+        Serial.println("\t- Failed. Send Message successfull");
+        Errors++;
     } else {
         if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
         {
-            Serial.print("\t- Failed. Check for a free Transmit-Buffer failed with the wrong Error 0x");
+            Serial.print("\t- Failed. Send Message failed with the wrong Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
         } else {
             Serial.println("\t- passed");
         }
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2342,19 +5641,44 @@ uint8_t testCheck4FreeTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test check4FreeTransmitBuffer-Function when initialized");
+    Serial.println(".2: Test sendMessageTimeout-Function with undefined Buffer, Priority and Timeout");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    if (Module.sendMessageTimeout(3, 0, 10000) ||
+        Module.sendMessageTimeout(0, 4, 10000) ||
+        Module.sendMessageTimeout(0, 0, 0))
     {
-        Module.setInterruptFlag((i + 2));
+        Serial.println("\t- Failed. Send Message successfull");
+        Errors++;
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
+        {
+            Serial.print("\t- Failed. Send Message failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
     }
-    
-    delay(500);
-    
-    if (Module.check4FreeTransmitBuffer() == 0xFF)
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test sendMessageTimeout-Function in Loopback-Mode");
+
+    Serial.println("\t- Set OperationMode Loopback");
+    while (!Module.setLoopbackMode()){
+        delay(100);
+    }
+
+    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+    while (!Module.fillTransmitBuffer(0, ID, false, false, 8, Data)){
+        delay(100);
+    }
+
+    if (!Module.sendMessageTimeout(0, 0, 10000))
     {
-        Serial.print("\t- Failed. Check for a free Transmit-Buffer not successfull in initialized Mode with Error 0x");
+        Serial.print("\t- Failed. Send Message not successfull with Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
     } else {
@@ -2362,49 +5686,95 @@ uint8_t testCheck4FreeTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t
     }
 
     delay(1000);
-    
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test check4FreeTransmitBuffer-Function for each TX-Buffer");
+    Serial.println(".4: Test sendMessageTimeout-Function without CAN-Bus");
 
-    Serial.println("\t- Reset all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
-    {
-        Module.resetInterruptFlag((i + 2));
+    Serial.println("\t- Set OperationMode Normal");
+    while (!Module.setNormalMode()){
+        delay(100);
     }
-    
-    delay(500);
 
-    for (size_t i = 0; i < 3; i++)
+    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+    while (!Module.fillTransmitBuffer(0, ID, false, false, 8, Data)){
+        delay(100);
+    }
+
+    Module.getMaxSendTime(true);
+    uint32_t Start = millis();
+
+    if (Module.sendMessageTimeout(0, 0, 10000))
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".3.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Check for a free Transmit-Buffer ");
-        Serial.println(i, DEC);
+        Serial.println("\t- Failed. Send Message successfull");
+        Errors++;
+    } else if ((Module.getLastMCPError() & ERROR_MCP2515_TRANSMIT_TIMEOUT) != ERROR_MCP2515_TRANSMIT_TIMEOUT)
+    {
+        Serial.print("\t- Failed. Send Message failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if ((millis() - Start) > 100)
+    {
+        Serial.print("\t- Failed. Send Message returned after ");
+        Serial.print(millis() - Start, DEC);
+        Serial.println("ms");
+        Errors++;
+    } else if (Module.check4FreeTransmitBuffer() != 0)
+    {
+        Serial.println("\t- Failed. Transmit-Buffer 0 was not released");
+        Errors++;
+    } else {
+        Serial.print("\t- passed (max. CPU-Time ");
+        Serial.print(Module.getMaxSendTime(), DEC);
+        Serial.println("us)");
+    }
 
-        Serial.print("\t- Set \"Transmit-Buffer free\"-Flag for Buffer ");
-        Serial.println(i, DEC);
+    delay(1000);
 
-        Module.setInterruptFlag((i + 2));
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".5: Test sendMessageTimeout-Function asynchronous without CAN-Bus");
 
-        delay(500);
+    Module.setTransmitCallback(_onTransmit);
 
-        if (Module.check4FreeTransmitBuffer() != i)
-        {
-            Serial.print("\t\t- Failed. Check for a free Transmit-Buffer failed with Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-            
-        } else {
-            Serial.println("\t\t- passed");
-        }
+    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
+    while (!Module.fillTransmitBuffer(0, ID, false, false, 8, Data)){
+        delay(100);
+    }
 
-        delay(500);
+    _transmitCallbackCount = 0;
+    Module.getMaxSendTime(true);
 
-        Module.resetInterruptFlag((i + 2));
+    if (!Module.sendMessageTimeout(0, 0, 10000, true, 0x55))
+    {
+        Serial.print("\t- Failed. Send Message not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if (Module.getMaxSendTime() > 5000)
+    {
+        Serial.print("\t- Failed. Asynchronous call took ");
+        Serial.print(Module.getMaxSendTime(), DEC);
+        Serial.println("us");
+        Errors++;
+    } else if (!_waitForTransmitCallback(Module, 100))
+    {
+        Serial.println("\t- Failed. Transmission not aborted");
+        Errors++;
+    } else if ((_transmitCallbackCount != 1) ||
+               (_transmitCallbackTag != 0x55) ||
+               ((_transmitCallbackFlags & MCP2515_TX_FLAG_NOT_TRANSMITTED) != MCP2515_TX_FLAG_NOT_TRANSMITTED))
+    {
+        Serial.print("\t- Failed. Transmit-Callback called with Tag 0x");
+        Serial.print(_transmitCallbackTag, HEX);
+        Serial.print(" Flags 0x");
+        Serial.println(_transmitCallbackFlags, HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
-    
+
+    Module.setTransmitCallback(NULL);
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2419,21 +5789,16 @@ uint8_t testCheck4FreeTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t
     return Errors;
 }
 
-uint8_t testFillTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+uint8_t testTransmitQueue(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
     uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
-    uint8_t Data[8] = {
-        1,
-        1,
-        1,
-        1
-    };
-
     uint8_t Errors = 0;
+    MCP2515Frame Frame = {0x123, false, false, 8, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}};
 
     delay(500);
     if (Module.getIsInitialized())
@@ -2443,28 +5808,26 @@ uint8_t testFillTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defau
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test fillTransmitBuffer-Function");
+    Serial.println(": Test Transmit-Queue-Functions");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test fillTransmitBuffer-Function when not initialized");
+    Serial.println(".1: Test queueMessage-/processTransmitQueue-Function when not initialized");
 
-    if (Module.fillTransmitBuffer(0, 1, true, false, 4, Data)){
-        Serial.println("\t- Failed. Fill Transmit-Buffer successfull");
-        Errors++;    
+    if (Module.queueMessage(Frame) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED) ||
+        (Module.processTransmitQueue() != 0) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED))
+    {
+        Serial.print("\t- Failed. Queue Message successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
-        {
-            Serial.print("\t- Failed. Fill Transmit-Buffer failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2474,401 +5837,550 @@ uint8_t testFillTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defau
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test fillTransmitBuffer-Function when initialized");
+    Serial.println(".2: Test queueMessage-Function with invalid Frames");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
-    {
-        Module.setInterruptFlag((i + 2));
-    }
-    
-    delay(500);
-    
-    if (!Module.fillTransmitBuffer(0, 1, true, false, 4, Data))
+    MCP2515Frame InvalidFrames[3] = {
+        {0x800, false, false, 8, {0}},
+        {0x20000000, true, false, 8, {0}},
+        {0x123, false, false, 9, {0}},
+    };
+    bool StepFailed = false;
+
+    for (uint8_t i = 0; i < 3; i++)
     {
-        Serial.print("\t- Failed. Fill Transmit-Buffer not successfull in initialized Mode with Error 0x");
-        Serial.println(Module.getLastMCPError(), HEX);
-        Errors++;
-    } else {
-        Serial.println("\t- passed");
-        Module.setInterruptFlag(2);
+        if (Module.queueMessage(InvalidFrames[i]) ||
+            ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
+        {
+            Serial.print("\t- Failed. Queue Message successfull or failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
+            StepFailed = true;
+        }
     }
 
-    delay(1000);
-    
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".3: Test fillTransmitBuffer-Function for each TX-Buffer");
-
-    Serial.println("\t- Reset all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    if (Module.queueMessage(Frame, 0x80000000) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
     {
-        Module.resetInterruptFlag((i + 2));
+        Serial.print("\t- Failed. Queue Message with invalid Deadline successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        StepFailed = true;
     }
-    
-    delay(500);
 
-    for (size_t i = 0; i < 3; i++)
-    {
-        Serial.print(Teststep, DEC);
-        Serial.print(".3.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Fill Transmit-Buffer ");
-        Serial.println(i, DEC);
+    if (StepFailed || (Module.getTransmitQueueCount() != 0))
+    {
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
 
-        Serial.print("\t- Set \"Transmit-Buffer free\"-Flag for Buffer ");
-        Serial.println(i, DEC);
+    delay(1000);
 
-        Module.setInterruptFlag((i + 2));
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test queueMessage-Function until the Queue is full");
 
-        delay(500);
+    StepFailed = false;
 
-        if (!Module.fillTransmitBuffer(i, 1, true, false, 4, Data))
+    for (uint16_t i = 0; i < MCP2515_TX_QUEUE_SIZE; i++)
+    {
+        Frame.data[0] = (uint8_t)i;
+
+        if (!Module.queueMessage(Frame))
         {
-            Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+            Serial.print("\t- Failed. Queue Message ");
+            Serial.print(i, DEC);
+            Serial.print(" not successfull with Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-            
-        } else {
-            Serial.println("\t\t- passed");
+            StepFailed = true;
+            break;
         }
+    }
 
-        delay(500);
-
-        Module.resetInterruptFlag((i + 2));
+    if (StepFailed)
+    {
+        Errors++;
+    } else if (Module.queueMessage(Frame) ||
+               ((Module.getLastMCPError() & ERROR_MCP2515_TX_QUEUE_FULL) != ERROR_MCP2515_TX_QUEUE_FULL))
+    {
+        Serial.print("\t- Failed. Queue Message into a full Queue successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if (Module.getTransmitQueueCount() != MCP2515_TX_QUEUE_SIZE)
+    {
+        Serial.print("\t- Failed. Wrong Number of queued Frames ");
+        Serial.println(Module.getTransmitQueueCount(), DEC);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".4: Test fillTransmitBuffer-Function for undefined TX-Buffer");
+    Serial.println(".4: Test processTransmitQueue-Function in Loopback-Mode");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
-    {
-        Module.setInterruptFlag((i + 2));
+    Serial.println("\t- Set OperationMode Loopback");
+    while (!Module.setLoopbackMode()){
+        delay(100);
     }
-    
-    delay(500);
 
-    for (size_t i = 3; i < 5; i++)
-    {
-        Serial.print(Teststep, DEC);
-        Serial.print(".4.");
-        Serial.print((i-2), DEC);
-        Serial.print(": Fill Transmit-Buffer ");
-        Serial.println(i, DEC);
+    uint32_t Start = millis();
 
-        delay(500);
+    while ((Module.getTransmitQueueCount() > 0) && ((millis() - Start) < 1000))
+    {
+        Module.processTransmitQueue();
 
-        if (Module.fillTransmitBuffer(i, 1, true, false, 4, Data))
+        if (Module.getLastMCPError() != EMPTY_VALUE_16_BIT)
         {
-            Serial.println("\t\t- Failed. Fill Transmit-Buffer successfull");
-            Module.setInterruptFlag((i + 2));
-            Errors++;
-            
-        } else {
-            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
-            {
-                Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with wrong Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            } else {
-                Serial.println("\t\t- passed");
-            }
+            break;
         }
+    }
 
-        delay(500);
+    if (Module.getLastMCPError() != EMPTY_VALUE_16_BIT)
+    {
+        Serial.print("\t- Failed. Process Transmit-Queue failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if (Module.getTransmitQueueCount() != 0)
+    {
+        Serial.print("\t- Failed. Frames not transmitted ");
+        Serial.println(Module.getTransmitQueueCount(), DEC);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".5: Test fillTransmitBuffer-Function for defined IDs");
+    Serial.println(".5: Test processTransmitQueue-Function with Deadlines in Loopback-Mode");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    MCP2515TransmitQueueStatistic Statistic;
+    Module.resetTransmitQueueStatistic();
+
+    // Best effort Frames, one Frame with an impossible Deadline and one Frame with a Deadline of 100ms
+    MCP2515Frame UrgentFrame = {0x010, false, false, 8, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}};
+    StepFailed = false;
+
+    for (uint8_t i = 0; i < 4; i++)
     {
-        Module.setInterruptFlag((i + 2));
+        StepFailed = StepFailed || !Module.queueMessage(Frame);
     }
-    
-    delay(500);
 
-    for (size_t i = 0; i < 3; i++)
-    {
-        uint32_t ID = 150000000 * (i + 1);
-        Serial.print(Teststep, DEC);
-        Serial.print(".5.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Fill Transmit-Buffer with ID ");
-        Serial.println(ID, HEX);
+    StepFailed = StepFailed || !Module.queueMessage(UrgentFrame, 1);
+    StepFailed = StepFailed || !Module.queueMessage(UrgentFrame, 100000);
 
-        delay(500);
+    delay(1);
+    Start = millis();
 
-        if (!Module.fillTransmitBuffer(0, ID, true, false, 4, Data))
-        {
-            Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-            
-        } else {
-            Serial.println("\t\t- passed");
-        }
+    while ((Module.getTransmitQueueCount() > 0) && ((millis() - Start) < 1000))
+    {
+        Module.processTransmitQueue();
+    }
 
-        delay(500);
+    Module.getTransmitQueueStatistic(Statistic);
 
-        Module.setInterruptFlag(2);
+    if (StepFailed)
+    {
+        Serial.print("\t- Failed. Queue Message failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if ((Module.getTransmitQueueCount() != 0) ||
+               (Statistic.transmitted != 5) ||
+               (Statistic.deadlineMisses != 1))
+    {
+        Serial.print("\t- Failed. Transmitted: ");
+        Serial.print(Statistic.transmitted, DEC);
+        Serial.print(" Deadline-Misses: ");
+        Serial.println(Statistic.deadlineMisses, DEC);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".6: Test fillTransmitBuffer-Function for undefined IDs");
+    Serial.println(".6: Test processTransmitQueue-Function together with processCyclicMessages in Loopback-Mode");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    Module.resetTransmitQueueStatistic();
+    StepFailed = false;
+
+    for (uint8_t i = 0; i < 3; i++)
     {
-        Module.setInterruptFlag((i + 2));
+        StepFailed = StepFailed || !Module.queueMessage(Frame);
     }
-    
-    delay(500);
 
-    for (size_t i = 3; i < 5; i++)
-    {
-        uint32_t ID = 540000000 + (i * 2);
-        Serial.print(Teststep, DEC);
-        Serial.print(".6.");
-        Serial.print((i-2), DEC);
-        Serial.print(": Fill Transmit-Buffer with ID ");
-        Serial.println(ID, HEX);
+    // All TX-Buffers are loaded by the Transmit-Queue, their Completion is handled at the next processTransmitQueue()
+    uint8_t Loaded = Module.processTransmitQueue();
+    uint8_t Handle = Module.addCyclicMessage(0x7FF, false, 8, Frame.data, 10);
 
-        delay(500);
+    delay(1);
 
-        if (Module.fillTransmitBuffer(0, ID, true, false, 4, Data))
-        {
-            Serial.println("\t\t- Failed. Fill Transmit-Buffer successfull");
-            Module.setInterruptFlag(2);
-            Errors++;
-            
-        } else {
-            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
-            {
-                Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with wrong Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            } else {
-                Serial.println("\t\t- passed");
-            }
-        }
+    uint8_t CyclicSentBefore = Module.processCyclicMessages();
+    Module.processTransmitQueue();
+    Module.getTransmitQueueStatistic(Statistic);
+    uint8_t CyclicSentAfter = Module.processCyclicMessages();
+    Module.removeCyclicMessage(Handle);
 
-        delay(500);
+    if (StepFailed || (Handle == MCP2515_CYCLIC_MESSAGE_INVALID))
+    {
+        Serial.print("\t- Failed. Queue Message or Register the cyclic Message failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if ((Loaded != 3) ||
+               (CyclicSentBefore != 0) ||
+               (CyclicSentAfter != 1) ||
+               (Statistic.transmitted != 3) ||
+               (Module.getTransmitQueueCount() != 0))
+    {
+        Serial.print("\t- Failed. Loaded: ");
+        Serial.print(Loaded, DEC);
+        Serial.print(" Cyclic before/after Completion: ");
+        Serial.print(CyclicSentBefore, DEC);
+        Serial.print("/");
+        Serial.print(CyclicSentAfter, DEC);
+        Serial.print(" Transmitted: ");
+        Serial.println(Statistic.transmitted, DEC);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
+#endif
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".7: Test fillTransmitBuffer-Function for Extended Enabler");
+    Serial.println(".7: Test processTransmitQueue-Function with a Deadline shorter than the Frame in Loopback-Mode");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    Module.resetTransmitQueueStatistic();
+
+    // The Deadline ends while the Frame is loaded or on the Bus: it is either transmitted or a Deadline-Miss
+    StepFailed = !Module.queueMessage(Frame, 100);
+    Start = millis();
+
+    while ((Module.getTransmitQueueCount() > 0) && ((millis() - Start) < 1000))
     {
-        Module.setInterruptFlag((i + 2));
+        Module.processTransmitQueue();
     }
-    
-    delay(500);
 
-    Serial.print(Teststep, DEC);
-    Serial.println(".7.1: Fill Transmit-Buffer with Extended True");
+    Module.getTransmitQueueStatistic(Statistic);
 
-    if (!Module.fillTransmitBuffer(0, 1, true, false, 4, Data))
+    if (StepFailed)
     {
-        Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+        Serial.print("\t- Failed. Queue Message failed with Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
-        
+    } else if ((Module.getTransmitQueueCount() != 0) ||
+               ((Statistic.transmitted + Statistic.deadlineMisses) != 1))
+    {
+        Serial.print("\t- Failed. Transmitted: ");
+        Serial.print(Statistic.transmitted, DEC);
+        Serial.print(" Deadline-Misses: ");
+        Serial.println(Statistic.deadlineMisses, DEC);
+        Errors++;
     } else {
-        Serial.println("\t\t- passed");
+        Serial.println("\t- passed");
     }
 
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(1000);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
+
+uint8_t testTransmitRateLimit(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+    MCP2515Frame ControlFrame = {0x100, false, false, 8, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}};
+    MCP2515Frame DiagnosticFrame = {0x7DF, false, false, 8, {0x02, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00}};
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
     delay(500);
 
-    Module.setInterruptFlag(2);
-    
     Serial.print(Teststep, DEC);
-    Serial.println(".7.2: Fill Transmit-Buffer with Extended False");
+    Serial.println(": Test Transmit-Rate-Limit-Functions");
 
-    if (!Module.fillTransmitBuffer(0, 1, false, false, 4, Data))
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test setTransmitRateLimit-/setTransmitBusLoadLimit-Function when not initialized");
+
+    if (Module.setTransmitRateLimit(0, false, 0x700, 0x7FF, 10) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED) ||
+        Module.setTransmitBusLoadLimit(500) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED))
     {
-        Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+        Serial.print("\t- Failed. Set Rate-Limit successfull or failed with the wrong Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
-        
     } else {
-        Serial.println("\t\t- passed");
+        Serial.println("\t- passed");
     }
 
-    Module.setInterruptFlag(2);
-
     delay(1000);
 
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".8: Test fillTransmitBuffer-Function for RTR Enabler");
+    Serial.println(".2: Test setTransmitRateLimit-/setTransmitBusLoadLimit-Function with invalid Values");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    bool StepFailed = false;
+
+    if (Module.setTransmitRateLimit(MCP2515_MAX_RATE_LIMITS, false, 0x700, 0x7FF, 10) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.setTransmitRateLimit(0, false, 0x7FF, 0x700, 10) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.setTransmitRateLimit(0, false, 0x700, 0x800, 10) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.setTransmitRateLimit(0, true, 0x00, 0x20000000, 10) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.setTransmitRateLimit(0, false, 0x700, 0x7FF, 1001) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.setTransmitRateLimit(0, false, 0x700, 0x7FF, 10, MCP2515_MAX_FRAME_BITS - 1) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
     {
-        Module.setInterruptFlag((i + 2));
+        Serial.print("\t- Failed. Set Rate-Limit with invalid Values successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        StepFailed = true;
     }
-    
-    delay(500);
 
-    Serial.print(Teststep, DEC);
-    Serial.println(".8.1: Fill Transmit-Buffer with RTR True");
-
-    if (!Module.fillTransmitBuffer(0, 1, true, true, 4, Data))
+    if (Module.setTransmitBusLoadLimit(1001) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE) ||
+        Module.setTransmitBusLoadLimit(10, 2000001) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
     {
-        Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
+        Serial.print("\t- Failed. Set Bus-Load-Limit with invalid Values successfull or failed with the wrong Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
+        StepFailed = true;
+    }
+
+    if (StepFailed)
+    {
         Errors++;
-        
     } else {
-        Serial.println("\t\t- passed");
+        Serial.println("\t- passed");
     }
 
-    delay(500);
+    delay(1000);
 
-    Module.setInterruptFlag(2);
-    
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".8.2: Fill Transmit-Buffer with Extended False");
+    Serial.println(".3: Test calculateFrameBitLength-Function");
 
-    if (!Module.fillTransmitBuffer(0, 1, true, false, 4, Data))
+    MCP2515Frame InvalidFrame = {0x123, false, false, 9, {0}};
+
+    // 0x100 with the Data 0x01 - 0x08: 98 Bits SOF till CRC, 11 Stuff-Bits, 13 Bits Delimiter, ACK, EOF and IFS
+    if ((Module.calculateFrameBitLength(ControlFrame) != 122) ||
+        (Module.calculateFrameBitLength(InvalidFrame) != 0) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
     {
-        Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
-        Serial.println(Module.getLastMCPError(), HEX);
+        Serial.print("\t- Failed. Wrong Length ");
+        Serial.println(Module.calculateFrameBitLength(ControlFrame), DEC);
         Errors++;
-        
     } else {
-        Serial.println("\t\t- passed");
+        Serial.println("\t- passed");
     }
 
-    Module.setInterruptFlag(2);
-
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".9: Test fillTransmitBuffer-Function for defined DLCs");
+    Serial.println(".4: Test Rate-Limit of an ID-Range in Loopback-Mode");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    Serial.println("\t- Set OperationMode Loopback");
+    while (!Module.setLoopbackMode()){
+        delay(100);
+    }
+
+    MCP2515TransmitQueueStatistic Statistic;
+    Module.resetTransmitQueueStatistic();
+
+    // Diagnostic-Frames with max. 2‰ of the Bus-Load, the Control-Frames are not limited
+    StepFailed = !Module.setTransmitRateLimit(0, false, 0x700, 0x7FF, 2);
+
+    for (uint8_t i = 0; i < 5; i++)
     {
-        Module.setInterruptFlag((i + 2));
+        StepFailed = StepFailed || !Module.queueMessage(DiagnosticFrame);
     }
-    
-    delay(500);
 
-    for (size_t i = 0; i < 9; i++)
+    for (uint8_t i = 0; i < 3; i++)
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".9.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Fill Transmit-Buffer with DLC ");
-        Serial.println(i, DEC);
+        StepFailed = StepFailed || !Module.queueMessage(ControlFrame);
+    }
 
-        if (!Module.fillTransmitBuffer(0, 1, true, false, i, Data))
+    uint16_t Utilization = 0;
+    uint32_t Start = millis();
+
+    while ((millis() - Start) < 250)
+    {
+        Module.processTransmitQueue();
+
+        if (Module.getTransmitUtilization() > Utilization)
         {
-            Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-            
-        } else {
-            Serial.println("\t\t- passed");
+            Utilization = Module.getTransmitUtilization();
         }
+    }
 
-        delay(500);
+    Module.getTransmitQueueStatistic(Statistic);
 
-        Module.setInterruptFlag(2);
+    if (StepFailed)
+    {
+        Serial.print("\t- Failed. Queue Message failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if ((Statistic.transmitted < 3) ||
+               (Module.getTransmitQueueCount() == 0) ||
+               (Utilization == 0) ||
+               (Utilization > 100))
+    {
+        Serial.print("\t- Failed. Transmitted: ");
+        Serial.print(Statistic.transmitted, DEC);
+        Serial.print(" Queued: ");
+        Serial.print(Module.getTransmitQueueCount(), DEC);
+        Serial.print(" Utilization: ");
+        Serial.println(Utilization, DEC);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".10: Test fillTransmitBuffer-Function for undefined DLCs");
+    Serial.println(".5: Test Bus-Load-Limit in Loopback-Mode");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    // The Control-Frames are also limited by the Bus-Load-Limit
+    StepFailed = !Module.setTransmitRateLimit(0, false, 0x700, 0x7FF, 0);
+    StepFailed = StepFailed || !Module.setTransmitBusLoadLimit(2);
+
+    for (uint8_t i = 0; i < 3; i++)
     {
-        Module.setInterruptFlag((i + 2));
+        StepFailed = StepFailed || !Module.queueMessage(ControlFrame);
     }
-    
-    delay(500);
 
-    for (size_t i = 9; i < 12; i++)
+    Start = millis();
+
+    while ((millis() - Start) < 250)
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".10.");
-        Serial.print((i-8), DEC);
-        Serial.print(": Fill Transmit-Buffer with DLC ");
-        Serial.println(i, DEC);
+        Module.processTransmitQueue();
+    }
 
-        if (Module.fillTransmitBuffer(0, 1, true, false, i, Data))
-        {
-            Serial.print("\t\t- Failed. Fill Transmit-Buffer successfull");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-            
-        } else {
-            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
-            {
-                Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with wrong Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            } else {
-                Serial.println("\t\t- passed");
-            }
-        }
+    uint8_t Queued = Module.getTransmitQueueCount();
 
-        delay(500);
+    // Without Limit all Frames are transmitted
+    StepFailed = StepFailed || !Module.setTransmitBusLoadLimit(0);
+    Start = millis();
 
-        Module.setInterruptFlag(2);
+    while ((Module.getTransmitQueueCount() > 0) && ((millis() - Start) < 1000))
+    {
+        Module.processTransmitQueue();
     }
-    
+
+    if (StepFailed)
+    {
+        Serial.print("\t- Failed. Set Limit or Queue Message failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if ((Queued == 0) ||
+               (Module.getTransmitQueueCount() != 0))
+    {
+        Serial.print("\t- Failed. Queued with Limit: ");
+        Serial.print(Queued, DEC);
+        Serial.print(" Queued without Limit: ");
+        Serial.println(Module.getTransmitQueueCount(), DEC);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".11: Test fillTransmitBuffer-Function with no free Transmit-Buffer");
+    Serial.println(".6: Test Rate-Limit when an older Frame with the same ID is transmitted first in Loopback-Mode");
 
-    Serial.println("\t- Reset all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    MCP2515Frame FirstFrame = {0x7E0, false, false, 8, {0x02, 0x01, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00}};
+    MCP2515Frame ShortFrame = {0x7DF, false, false, 0, {0}};
+    Module.resetTransmitQueueStatistic();
+
+    // After the first Frame the Bucket contains exactly the Length of the short Frame, the long Frame with the same ID
+    // is older and has to be transmitted first, but it does not fit into the Bucket
+    StepFailed = !Module.setTransmitRateLimit(0, false, 0x700, 0x7FF, 1,
+                                              Module.calculateFrameBitLength(FirstFrame) + Module.calculateFrameBitLength(ShortFrame));
+    StepFailed = StepFailed || !Module.queueMessage(FirstFrame);
+    Start = millis();
+
+    while ((Module.getTransmitQueueCount() > 0) && ((millis() - Start) < 100))
     {
-        Module.resetInterruptFlag((i + 2));
+        Module.processTransmitQueue();
     }
-    
-    delay(500);
 
-    if (Module.fillTransmitBuffer(0, 1, true, false, 4, Data))
+    StepFailed = StepFailed || !Module.queueMessage(DiagnosticFrame);
+    StepFailed = StepFailed || !Module.queueMessage(ShortFrame, 100000);
+    Start = millis();
+
+    while ((millis() - Start) < 20)
     {
-        Serial.println("\t- Failed. Fill Transmit-Buffer successfull");
+        Module.processTransmitQueue();
+    }
+
+    Module.getTransmitQueueStatistic(Statistic);
+    Queued = Module.getTransmitQueueCount();
+
+    // Remove the Limit and transmit the remaining Frames
+    StepFailed = StepFailed || !Module.setTransmitRateLimit(0, false, 0x700, 0x7FF, 0);
+    Start = millis();
+
+    while ((Module.getTransmitQueueCount() > 0) && ((millis() - Start) < 1000))
+    {
+        Module.processTransmitQueue();
+    }
+
+    if (StepFailed)
+    {
+        Serial.print("\t- Failed. Set Limit or Queue Message failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if ((Statistic.transmitted != 1) ||
+               (Queued != 2))
+    {
+        Serial.print("\t- Failed. Transmitted: ");
+        Serial.print(Statistic.transmitted, DEC);
+        Serial.print(" Queued: ");
+        Serial.println(Queued, DEC);
         Errors++;
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE) != ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE)
-        {
-            Serial.print("\t\t- Failed. Fill Transmit-Buffer failed with wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t\t- passed");
-        }
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2882,24 +6394,29 @@ uint8_t testFillTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defau
 
     return Errors;
 }
+#endif
 
-uint8_t testSendMessage(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+#ifdef MCP2515_ENABLE_BUS_LOAD
+uint8_t testBusLoad(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
     //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
     uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
     uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
     uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
 
-    uint32_t ID = 1;
-    bool Extended = false;
-    bool RTR = false;
-    uint8_t DLC = 2;
-    uint8_t Data[2] = {
-        1,
-        1
-    };
-
     uint8_t Errors = 0;
+    uint8_t Data[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    MCP2515Frame ControlFrame = {0x100, false, false, 8, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}};
+    MCP2515Frame RecessiveFrame = {0x7FF, false, false, 8, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+    MCP2515BusLoadStatistic Statistic;
+    uint8_t StuffBits = 0;
+    uint8_t RecessiveStuffBits = 0;
+
+    uint32_t ID_Receive = 0;
+    bool Extended_Receive = false;
+    bool RTR_Receive = false;
+    uint8_t DLC_Receive = 0;
+    uint8_t Data_Receive[8];
 
     delay(500);
     if (Module.getIsInitialized())
@@ -2909,28 +6426,29 @@ uint8_t testSendMessage(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSetti
     delay(500);
 
     Serial.print(Teststep, DEC);
-    Serial.println(": Test sendMessage-Function");
+    Serial.println(": Test Bus-Load");
 
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".1: Test sendMessage-Function when not initialized");
+    Serial.println(".1: Test calculateFrameBitLength-Function with Stuff-Bits");
 
-    if (Module.sendMessage(0, 0)){
-        Serial.println("\t- Failed. Send Message successfull");
-        Errors++;    
+    // 0x100 with the Data 0x01 - 0x08: 11 Stuff-Bits; 0x7FF with the Data 0xFF: 15 Stuff-Bits
+    if ((Module.calculateFrameBitLength(ControlFrame, StuffBits) != 122) ||
+        (StuffBits != 11) ||
+        (Module.calculateFrameBitLength(RecessiveFrame, RecessiveStuffBits) != 126) ||
+        (RecessiveStuffBits != 15))
+    {
+        Serial.print("\t- Failed. Wrong Stuff-Bits ");
+        Serial.print(StuffBits, DEC);
+        Serial.print(" / ");
+        Serial.println(RecessiveStuffBits, DEC);
+        Errors++;
     } else {
-        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
-        {
-            Serial.print("\t- Failed. Send Message failed with the wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t- passed");
-        }
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2938,252 +6456,311 @@ uint8_t testSendMessage(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSetti
         delay(100);
     }
 
-    Serial.println("- Set OperationMode Loopback");
-    while (!Module.setLoopbackMode()){
-        delay(100);
-    }
-
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".2: Test sendMessage-Function when initialized");
+    Serial.println(".2: Test resetBusLoad-Function");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    Module.resetBusLoad();
+    Module.getBusLoadStatistic(Statistic);
+
+    if ((Module.getBusLoad() != 0) ||
+        (Statistic.transmittedFrames != 0) ||
+        (Statistic.receivedFrames != 0) ||
+        (Statistic.stuffBits != 0))
     {
-        Module.setInterruptFlag((i + 2));
+        Serial.println("\t- Failed. Bus-Load not reset");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
-    
-    delay(500);
 
-    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
-    while (!Module.fillTransmitBuffer(0, ID, Extended, RTR, DLC, Data)){
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test Bus-Load of a transmitted Frame in Loopback-Mode");
+
+    Serial.println("\t- Set OperationMode Loopback");
+    while (!Module.setLoopbackMode()){
         delay(100);
     }
-    
-    delay(500);
-    
-    Serial.println("\t- send Message");
-    if (!Module.sendMessage(0, 0))
+
+    Module.resetBusLoad();
+
+    if (!Module.fillTransmitBuffer(0, 0x100, false, false, 8, Data) ||
+        !Module.sendMessage(0))
     {
-        Serial.print("\t\t- Failed. Send Message not successfull in initialized Mode with Error 0x");
+        Serial.print("\t- Failed. Send Message not successfull with Error 0x");
         Serial.println(Module.getLastMCPError(), HEX);
         Errors++;
     } else {
-        Serial.println("\t\t- passed");
+        Module.getBusLoadStatistic(Statistic);
+
+        if ((Statistic.transmittedFrames != 1) ||
+            (Statistic.transmittedBits != 122) ||
+            (Statistic.stuffBits != 11) ||
+            (Module.getBusLoad() == 0))
+        {
+            Serial.print("\t- Failed. Transmitted Bits = ");
+            Serial.println(Statistic.transmittedBits, DEC);
+            Errors++;
+        } else {
+            Serial.print("\t- passed (Bus-Load ");
+            Serial.print(Module.getBusLoad(), DEC);
+            Serial.println(" permille)");
+        }
     }
 
     delay(1000);
-    
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".3: Test sendMessage-Function with each TX-Buffer");
+    Serial.println(".4: Test Bus-Load of a received Frame in Loopback-Mode");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    if (!Module.getAllFromReceiveBuffer(0, ID_Receive, Extended_Receive, RTR_Receive, DLC_Receive, Data_Receive))
     {
-        Module.setInterruptFlag((i + 2));
+        Serial.print("\t- Failed. getAllFromReceiveBuffer not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Module.getBusLoadStatistic(Statistic);
+
+        if ((Statistic.receivedFrames != 1) ||
+            (Statistic.receivedBits != 122) ||
+            (Statistic.stuffBits != 22))
+        {
+            Serial.print("\t- Failed. Received Bits = ");
+            Serial.println(Statistic.receivedBits, DEC);
+            Errors++;
+        } else {
+            Serial.println("\t- passed");
+        }
     }
-    
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
 
-    for (size_t i = 0; i < 3; i++)
+    return Errors;
+}
+#endif
+
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+uint8_t testCyclicMessages(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+    uint8_t Data[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    uint8_t Handles[MCP2515_MAX_CYCLIC_MESSAGES];
+
+    delay(500);
+    if (Module.getIsInitialized())
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".3.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Send Message from Transmit-Buffer ");
-        Serial.println(i, DEC);
+        Module.deinit();
+    }
+    delay(500);
 
-        Serial.print("\t- Fill Transmit-Buffer ");
-        Serial.print(i, DEC);
-        Serial.println(" with Data");
-        while (!Module.fillTransmitBuffer(i, ID, Extended, RTR, DLC, Data)){
-            delay(100);
-        }
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test Cyclic-Message-Functions");
 
-        delay(500);
+    delay(1000);
 
-        if (!Module.sendMessage(i, 0))
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test addCyclicMessage-Function when not initialized");
+
+    if (Module.addCyclicMessage(0x123, false, 8, Data, 100) != MCP2515_CYCLIC_MESSAGE_INVALID){
+        Serial.println("\t- Failed. Register a cyclic Message successfull");
+        Errors++;
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED)
         {
-            Serial.print("\t\t- Failed. Send Message failed with Error 0x");
+            Serial.print("\t- Failed. Register a cyclic Message failed with the wrong Error 0x");
             Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
-            
         } else {
-            Serial.println("\t\t- passed");
+            Serial.println("\t- passed");
         }
-
-        delay(500);
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    Serial.print(Teststep, DEC);
-    Serial.println(".4: Test sendMessage-Function with undefined TX-Buffer");
-
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
-    {
-        Module.setInterruptFlag((i + 2));
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
     }
-    
-    delay(500);
 
-    for (size_t i = 3; i < 6; i++)
-    {
-        Serial.print(Teststep, DEC);
-        Serial.print(".4.");
-        Serial.print((i-2), DEC);
-        Serial.print(": Send Message from Transmit-Buffer ");
-        Serial.println(i, DEC);
+    // In Loopback-Mode each Message is transmitted without a CAN-Bus
+    Module.setLoopbackMode();
 
-        delay(500);
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test addCyclicMessage-Function with invalid Values");
 
-        if (Module.sendMessage(i, 0))
+    if (Module.addCyclicMessage(0x123, false, 8, Data, 0) != MCP2515_CYCLIC_MESSAGE_INVALID ||
+        Module.addCyclicMessage(0x123, false, 8, Data, 100, 100) != MCP2515_CYCLIC_MESSAGE_INVALID ||
+        Module.addCyclicMessage(0x800, false, 8, Data, 100) != MCP2515_CYCLIC_MESSAGE_INVALID ||
+        Module.addCyclicMessage(0x123, false, 9, Data, 100) != MCP2515_CYCLIC_MESSAGE_INVALID ||
+        Module.addCyclicMessage(0x123, false, 8, Data, MCP2515_MAX_CYCLIC_PERIOD + 1) != MCP2515_CYCLIC_MESSAGE_INVALID)
+    {
+        Serial.println("\t- Failed. Register a cyclic Message with invalid Values successfull");
+        Errors++;
+    } else {
+        if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
         {
-            Serial.println("\t\t- Failed. Send Message successfull");
+            Serial.print("\t- Failed. Register a cyclic Message failed with the wrong Error 0x");
+            Serial.println(Module.getLastMCPError(), HEX);
             Errors++;
-            
         } else {
-            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
-            {
-                Serial.print("\t\t- Failed. Send Message failed with wrong Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            } else {
-                Serial.println("\t\t- passed");
-            }
+            Serial.println("\t- passed");
         }
-
-        delay(500);
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".5: Test sendMessage-Function with defined Priority");
+    Serial.println(".3: Test addCyclicMessage-Function with the maximum Period");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
-    {
-        Module.setInterruptFlag((i + 2));
-    }
-    
-    delay(500);
+    Handles[0] = Module.addCyclicMessage(0x123, false, 8, Data, MCP2515_MAX_CYCLIC_PERIOD);
 
-    for (size_t i = 0; i < 4; i++)
+    if (Handles[0] == MCP2515_CYCLIC_MESSAGE_INVALID)
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".5.");
-        Serial.print((i+1), DEC);
-        Serial.print(": Send Message with Priority ");
-        Serial.println(i, DEC);
-
-        Serial.println("\t- Fill Transmit-Buffer 0 with Data");
-        while (!Module.fillTransmitBuffer(0, ID, Extended, RTR, DLC, Data)){
-            delay(100);
-        }
+        Serial.print("\t- Failed. Register a cyclic Message with the maximum Period failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        MCP2515CyclicStatistic Statistic;
 
-        delay(500);
+        // Released once at the Epoch, the next Release is MCP2515_MAX_CYCLIC_PERIOD later
+        Module.processCyclicMessages();
+        delay(100);
+        Module.processCyclicMessages();
+        Module.getCyclicMessageStatistic(Handles[0], Statistic);
+        Module.removeCyclicMessage(Handles[0]);
 
-        if (!Module.sendMessage(0, i))
+        if (Statistic.sendCount != 1)
         {
-            Serial.print("\t\t- Failed. Send Message failed with Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
+            Serial.print("\t- Failed. Cyclic Message with the maximum Period send ");
+            Serial.print(Statistic.sendCount, DEC);
+            Serial.println(" times");
             Errors++;
-            
         } else {
-            Serial.println("\t\t- passed");
+            Serial.println("\t- passed");
         }
-
-        delay(500);
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".6: Test sendMessage-Function with undefined Priority");
+    Serial.println(".4: Test addCyclicMessage-Function until all Slots are used");
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    bool AllRegistered = true;
+    for (size_t i = 0; i < MCP2515_MAX_CYCLIC_MESSAGES; i++)
     {
-        Module.setInterruptFlag((i + 2));
+        Handles[i] = Module.addCyclicMessage(0x100 + i, false, 8, Data, 100, i);
+        if (Handles[i] == MCP2515_CYCLIC_MESSAGE_INVALID)
+        {
+            AllRegistered = false;
+        }
     }
-    
-    delay(500);
 
-    for (size_t i = 5; i < 7; i++)
+    if (!AllRegistered)
     {
-        Serial.print(Teststep, DEC);
-        Serial.print(".6.");
-        Serial.print((i-4), DEC);
-        Serial.print(": Send Message with Priority ");
-        Serial.println(i, DEC);
-
-        delay(500);
-
-        if (Module.sendMessage(i, 0))
-        {
-            Serial.println("\t\t- Failed. Send Message successfull");
-            Errors++;
-            
-        } else {
-            if ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
-            {
-                Serial.print("\t\t- Failed. Send Message failed with wrong Error 0x");
-                Serial.println(Module.getLastMCPError(), HEX);
-                Errors++;
-            } else {
-                Serial.println("\t\t- passed");
-            }
-        }
-        delay(500);
+        Serial.print("\t- Failed. Register the cyclic Messages failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if (Module.addCyclicMessage(0x7FF, false, 8, Data, 100) != MCP2515_CYCLIC_MESSAGE_INVALID ||
+              (Module.getLastMCPError() & ERROR_MCP2515_NO_CYCLIC_SLOT_FREE) != ERROR_MCP2515_NO_CYCLIC_SLOT_FREE)
+    {
+        Serial.print("\t- Failed. Register a cyclic Message without free Slot not failed correctly 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     Serial.print(Teststep, DEC);
-    Serial.println(".7: Test sendMessage-Function without CAN-Bus");
+    Serial.println(".5: Test processCyclicMessages-Function for 1s with two cyclic Messages (10ms and 100ms)");
 
-    Serial.println("\t- Set OperationMode Normal");
-    while (!Module.setNormalMode()){
-        delay(100);
+    for (size_t i = 0; i < MCP2515_MAX_CYCLIC_MESSAGES; i++)
+    {
+        Module.removeCyclicMessage(Handles[i]);
     }
 
-    Serial.println("\t- Set all \"Transmit-Buffer free\"-Flags");
-    for (size_t i = 0; i < 3; i++)
+    Handles[0] = Module.addCyclicMessage(0x123, false, 8, Data, 10);
+    Handles[1] = Module.addCyclicMessage(0x1234567, true, 8, Data, 100, 5);
+
+    uint32_t Start = millis();
+    while (millis() - Start < 1000)
     {
-        Module.setInterruptFlag((i + 2));
+        Module.processCyclicMessages();
     }
-    
-    delay(500);
 
-    Serial.println("\t- Fill Transmit-Buffer 0 with Data");
-    while (!Module.fillTransmitBuffer(0, ID, Extended, RTR, DLC, Data)){
-        delay(100);
+    MCP2515CyclicStatistic Statistic[2];
+    Module.getCyclicMessageStatistic(Handles[0], Statistic[0]);
+    Module.getCyclicMessageStatistic(Handles[1], Statistic[1]);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        Serial.print("\t- Message ");
+        Serial.print(i, DEC);
+        Serial.print(" send: ");
+        Serial.print(Statistic[i].sendCount, DEC);
+        Serial.print(" max. Jitter: ");
+        Serial.print(Statistic[i].maxJitter, DEC);
+        Serial.print("us avg. Jitter: ");
+        Serial.print(Statistic[i].averageJitter, DEC);
+        Serial.print("us Deadline-Misses: ");
+        Serial.println(Statistic[i].deadlineMisses, DEC);
+    }
+
+    if (Statistic[0].sendCount < 99 || Statistic[0].sendCount > 101 ||
+        Statistic[1].sendCount < 9 || Statistic[1].sendCount > 11 ||
+        Statistic[0].deadlineMisses != 0 || Statistic[1].deadlineMisses != 0 ||
+        Statistic[0].maxJitter >= 1000 || Statistic[1].maxJitter >= 1000)
+    {
+        Serial.println("\t- Failed. Cyclic Messages not transmitted on time");
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
     }
 
-    Serial.println("\t- Send Message");
-    if (Module.sendMessage(0, 0))
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".6: Test removeCyclicMessage-Function");
+
+    if (!Module.removeCyclicMessage(Handles[0]) || !Module.removeCyclicMessage(Handles[1]))
     {
-        Serial.println("\t\t- Failed. Send Message successfull");
+        Serial.print("\t- Failed. Remove the cyclic Messages failed with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else if (Module.removeCyclicMessage(Handles[0]) ||
+              (Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE)
+    {
+        Serial.println("\t- Failed. Remove an already removed cyclic Message not failed correctly");
         Errors++;
-        
     } else {
-        if (((Module.getLastMCPError() & 0x0010) != 0x0010) && ((Module.getLastMCPError() & 0x0020) != 0x0020))
-        {
-            Serial.print("\t\t- Failed. Send Message failed with wrong Error 0x");
-            Serial.println(Module.getLastMCPError(), HEX);
-            Errors++;
-        } else {
-            Serial.println("\t\t- passed");
-        }
+        Serial.println("\t- passed");
     }
-    
+
     delay(1000);
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -3197,6 +6774,7 @@ uint8_t testSendMessage(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSetti
 
     return Errors;
 }
+#endif
 
 uint8_t testCheck4Rtr(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
     uint8_t CS_Pin = (uint8_t)defaultSettings[0];
@@ -5718,4 +9296,128 @@ uint8_t testSetInterruptFlag(uint8_t Teststep, MCP2515 &Module, uint32_t default
     delay(1000);
 
     return Errors;
-}
\ No newline at end of file
+}
+// Values of the last call of the Bus-State-Callback
+volatile uint8_t _busStateCallbackCount = 0;
+volatile uint8_t _busStateCallbackState = 0xFF;
+
+void _onBusState(uint8_t State, uint8_t PreviousState, uint8_t TransmitErrorCounter, uint8_t ReceiveErrorCounter){
+    _busStateCallbackCount++;
+    _busStateCallbackState = State;
+}
+
+uint8_t testBusStateMonitoring(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]){
+    uint8_t CS_Pin = (uint8_t)defaultSettings[0];
+    //uint8_t INT_Pin = (uint8_t)defaultSettings[1];
+    uint32_t defaultSPIFrequency = (uint32_t)defaultSettings[2];
+    uint32_t defaultClockFrequency = (uint32_t)defaultSettings[3];
+    uint32_t defaultBaudrate = (uint32_t)defaultSettings[4];
+
+    uint8_t Errors = 0;
+    uint8_t TransmitErrorCounter = 0;
+    uint8_t ReceiveErrorCounter = 0;
+
+    delay(500);
+    if (Module.getIsInitialized())
+    {
+        Module.deinit();
+    }
+    delay(500);
+
+    Serial.print(Teststep, DEC);
+    Serial.println(": Test Bus-State-Monitoring");
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".1: Test Bus-State-Monitoring when not initialized");
+
+    if (Module.enableBusStateMonitoring(_onBusState) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED) ||
+        Module.getErrorCounters(TransmitErrorCounter, ReceiveErrorCounter) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_NOT_INITIALIZED) != ERROR_MCP2515_NOT_INITIALIZED) ||
+        (Module.processBusState() != 0xFF))
+    {
+        Serial.print("\t- Failed. Bus-State-Monitoring successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    while (!_initialize_Module(Module, CS_Pin, defaultSPIFrequency, defaultClockFrequency, defaultBaudrate)){
+        delay(100);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".2: Test enableBusStateMonitoring-Function with invalid Backoff");
+
+    if (Module.enableBusStateMonitoring(_onBusState, MCP2515_MAX_BUS_OFF_BACKOFF + 1) ||
+        ((Module.getLastMCPError() & ERROR_MCP2515_VALUE_OUTA_RANGE) != ERROR_MCP2515_VALUE_OUTA_RANGE))
+    {
+        Serial.print("\t- Failed. Bus-State-Monitoring successfull or failed with the wrong Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".3: Test Bus-State-Monitoring when initialized");
+
+    uint8_t State = 0xFF;
+
+    if (!Module.enableBusStateMonitoring(_onBusState, 100) ||
+        ((State = Module.processBusState()) == 0xFF) ||
+        (State != Module.getBusState()) ||
+        !Module.getErrorCounters(TransmitErrorCounter, ReceiveErrorCounter) ||
+        ((State == MCP2515_BUS_STATE_ERROR_ACTIVE) && ((TransmitErrorCounter >= 96) || (ReceiveErrorCounter >= 96))))
+    {
+        Serial.print("\t- Failed. Bus-State-Monitoring not successfull with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.print("\t- passed. Bus-State = ");
+        Serial.print(State, DEC);
+        Serial.print(", TEC = ");
+        Serial.print(TransmitErrorCounter, DEC);
+        Serial.print(", REC = ");
+        Serial.println(ReceiveErrorCounter, DEC);
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    Serial.print(Teststep, DEC);
+    Serial.println(".4: Test disableBusStateMonitoring-Function");
+
+    if (!Module.disableBusStateMonitoring())
+    {
+        Serial.print("\t- Failed. Bus-State-Monitoring not disabled with Error 0x");
+        Serial.println(Module.getLastMCPError(), HEX);
+        Errors++;
+    } else {
+        Serial.println("\t- passed");
+    }
+
+    delay(1000);
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    delay(500);
+    Serial.print(Teststep, DEC);
+    Serial.print(": Tests executed with ");
+    Serial.print(Errors, DEC);
+    Serial.println(" error.");
+    Serial.println();
+    delay(1000);
+
+    return Errors;
+}
@@ -17,6 +17,16 @@
 bool _initialize_Module(MCP2515 &Module, uint8_t CS_Pin, uint32_t SPIFrequency, uint32_t ClockFrequency, uint32_t Baudrate);
 
 uint8_t testInit(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testInitConfig(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+#ifdef MCP2515_ENABLE_ERROR_LOG
+uint8_t testErrorLog(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+#endif
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+uint8_t testPerformanceCounters(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+#endif
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+uint8_t testLatencyHistograms(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+#endif
 uint8_t testSetSpiPins(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testSetSpiMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testSetDataOrder(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
@@ -27,14 +37,35 @@ uint8_t testSetNormalMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSet
 uint8_t testSetListenOnlyMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testSetLoopbackMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testSetSleepMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testEnterSleepMode(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testSetReCheckEnabler(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testRegisterCache(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testSnapshot(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testChangeBaudRate(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testCalculateBitTiming(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testDetectBaudRate(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testChangeInterruptSetting(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testClockOutput(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testEnableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testDisableFilterMask(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testAcceptanceFilter(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testCheck4FreeTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testFillTransmitBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testSendMessage(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testSendMessageOneShot(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testSendBuffers(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testStartTransmission(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testSendMessageTimeout(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+uint8_t testTransmitQueue(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testTransmitRateLimit(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+#endif
+#ifdef MCP2515_ENABLE_BUS_LOAD
+uint8_t testBusLoad(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+#endif
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+uint8_t testCyclicMessages(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+#endif
 uint8_t testCheck4Rtr(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testCheck4Receive(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testGetIdFromReceiveBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
@@ -47,5 +78,6 @@ uint8_t testReleaseReceiveBuffer(uint8_t Teststep, MCP2515 &Module, uint32_t def
 uint8_t testCheck4InterruptFlags(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testResetInterruptFlag(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 uint8_t testSetInterruptFlag(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
+uint8_t testBusStateMonitoring(uint8_t Teststep, MCP2515 &Module, uint32_t defaultSettings[]);
 
 #endif
\ No newline at end of file
@@ -49,6 +49,14 @@ void setup() {
   //TestCaseNumber++;
   //Errors = Errors + testInit(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
+  //Errors = Errors + testInitConfig(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testErrorLog(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testPerformanceCounters(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testLatencyHistograms(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
   //Errors = Errors + testSetSpiPins(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
   //Errors = Errors + testSetSpiMode(TestCaseNumber, MCP2515Module, defaultSettings);
@@ -69,22 +77,52 @@ void setup() {
   //TestCaseNumber++;
   //Errors = Errors + testSetSleepMode(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
+  //Errors = Errors + testEnterSleepMode(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
   //Errors = Errors + testSetReCheckEnabler(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
+  //Errors = Errors + testRegisterCache(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testSnapshot(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
   //Errors = Errors + testChangeBaudRate(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
+  //Errors = Errors + testCalculateBitTiming(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testDetectBaudRate(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
   //Errors = Errors + testChangeInterruptSetting(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
+  //Errors = Errors + testClockOutput(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
   //Errors = Errors + testEnableFilterMask(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
   //Errors = Errors + testDisableFilterMask(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
+  //Errors = Errors + testAcceptanceFilter(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
   //Errors = Errors + testCheck4FreeTransmitBuffer(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
   //Errors = Errors + testFillTransmitBuffer(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
   //Errors = Errors + testSendMessage(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
+  //Errors = Errors + testSendMessageOneShot(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testSendBuffers(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testStartTransmission(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testSendMessageTimeout(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testTransmitQueue(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testTransmitRateLimit(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testBusLoad(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testCyclicMessages(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
   //Errors = Errors + testCheck4Rtr(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
   //Errors = Errors + testCheck4Receive(TestCaseNumber, MCP2515Module, defaultSettings);
@@ -108,6 +146,8 @@ void setup() {
   //Errors = Errors + testResetInterruptFlag(TestCaseNumber, MCP2515Module, defaultSettings);
   //TestCaseNumber++;
   //Errors = Errors + testSetInterruptFlag(TestCaseNumber, MCP2515Module, defaultSettings);
+  //TestCaseNumber++;
+  //Errors = Errors + testBusStateMonitoring(TestCaseNumber, MCP2515Module, defaultSettings);
 
   Serial.println();
   Serial.println();
@@ -9,20 +9,24 @@ MCP2515 MCP2515Module;
 uint8_t CS_Pin = 17;  // for Micro
 //uint8_t CS_Pin = 53;  // for Mega
 
-// Define possible BaudRate-Array
-uint64_t possibleBaudRates[12] = {
-    (uint64_t)5E3,      // Not allowed for ClockRate 25MHz and 40MHz
-    (uint64_t)10E3,     // Not allowed for ClockRate 40MHz
-    (uint64_t)20E3,
-    (uint64_t)40E3,
-    (uint64_t)50E3,
-    (uint64_t)80E3,
-    (uint64_t)100E3,
-    (uint64_t)125E3,
-    (uint64_t)200E3,
-    (uint64_t)250E3,
-    (uint64_t)500E3,
-    (uint64_t)1000E3,   // Not allowed for ClockRate 8MHz
+// Define possible BaudRate-Array ordered by their Likelihood
+// Baudrates which are not possible with the ClockRate are skipped (e.g. 1000kB for ClockRate 8MHz)
+// Also non-standard Baudrates like 83.3kB or 33.3kB are possible
+uint32_t possibleBaudRates[14] = {
+    (uint32_t)500E3,
+    (uint32_t)250E3,
+    (uint32_t)125E3,
+    (uint32_t)1000E3,
+    (uint32_t)100E3,
+    (uint32_t)50E3,
+    (uint32_t)20E3,
+    (uint32_t)10E3,
+    (uint32_t)83333,
+    (uint32_t)33333,
+    (uint32_t)800E3,
+    (uint32_t)200E3,
+    (uint32_t)80E3,
+    (uint32_t)40E3,
 };
 
 bool baudRateRecognized = false;
@@ -148,68 +152,34 @@ void loop() {
   // Iterate through each BaudRate till plausible Messages are received
   if (!baudRateRecognized)
   {
-    for (size_t i = 0; i < 12; i++)
-    {
-      if (!MCP2515Module.changeBaudRate(possibleBaudRates[i]))
-      {
-        // When Baudrate could not been set (check MCP2515Error.h)
-        Serial.print("Baudrate ");
-        Serial.print((uint16_t)(possibleBaudRates[i]/1000), DEC);
-        Serial.print("kB couldn't be set with Error 0x");
-        Serial.println(MCP2515Module.getLastMCPError(), HEX);
-      } else {
-        Serial.print("Baudrate ");
-        Serial.print((uint16_t)(possibleBaudRates[i]/1000), DEC);
-        Serial.println("kB set.");
-
-        // Check if Message-Error-Flag occurs.
-        uint16_t trys=100;  // try this 100 times
-        uint16_t Messages_Received = 0;
-        uint16_t Errors_occured = 0;
-        while (trys > 0)
-        {
-          // Check for Message-Error-Flags and Receive-Buffer-Full Flags
-          if ((MCP2515Module.check4InterruptFlags() & 0x83) > 0x00)
-          {
-            if ((MCP2515Module.check4InterruptFlags() & 0x80) > 0x00)
-            {
-              Errors_occured++;
-              MCP2515Module.resetInterruptFlag(7);
-            }
-            if ((MCP2515Module.check4InterruptFlags() & 0x03) > 0x00)
-            {
-              Messages_Received++;
-              MCP2515Module.resetInterruptFlag(0);
-              MCP2515Module.resetInterruptFlag(1);
-            }
-          }
-          delay(10);
-          trys--;
-        }
-        Serial.print(Messages_Received, DEC);
-        Serial.println(" Messages Received.");
+    uint32_t detectedBaudRate = 0;
+    uint32_t detectionTime = 0;
 
-        Serial.print(Errors_occured, DEC);
-        Serial.println(" Errors occured.");
+    // Try each Baudrate in the Listen-Only-Mode till valid Messages are received
+    // A Baudrate is rejected after a few Errors and accepted after a few valid Messages
+    if (!MCP2515Module.detectBaudRate(possibleBaudRates, 14, detectedBaudRate, detectionTime))
+    {
+      // When no Baudrate could be detected, e.g. because the Bus is idle (check MCP2515Error.h)
+      Serial.print("Baudrate not detected with Error 0x");
+      Serial.print(MCP2515Module.getLastMCPError(), HEX);
+    } else {
+      Serial.print("Baudrate ");
+      Serial.print(detectedBaudRate, DEC);
+      Serial.print("B detected");
+      baudRateRecognized = true;
+    }
 
-        delay(1000);
+    Serial.print(" after ");
+    Serial.print(detectionTime / 1000, DEC);
+    Serial.println("ms.");
 
-        if ((Errors_occured > 10) || (Messages_Received < 50))
-        {
-          Serial.println("Baudrate not plausible. Try with next Baudrate.");
-        } else {
-          Serial.println("Baudrate plausible.");
-          baudRateRecognized = true;
-          break;
-        }
-      }
+    // When no Baudrate was detected, wait for manual Input of the Baudrate to set.
+    if (!baudRateRecognized) {
+      delay(1000);
+      Serial.println("Set Baudrate manually:");
+      delay(5000);
     }
-
-    // After each iteration, wait for manual Input of the Baudrate to set.
-    delay(1000);
-    Serial.println("Set Baudrate manually:");
-    delay(5000);
-    if (Serial.available() > 0) {
+    if (!baudRateRecognized && (Serial.available() > 0)) {
 
       String receivedBaudrate;
 
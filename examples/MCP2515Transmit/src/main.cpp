@@ -1,6 +1,9 @@
 #include <Arduino.h>
 #include <MCP2515.h>
 
+// With the cyclic Messages enabled for the whole Build (e.g. build_flags = -D MCP2515_ENABLE_CYCLIC_MESSAGES)
+// the Scheduler of the Library releases the Messages, otherwise they are sent directly in the loop.
+
 // Create Instances of the CAN-Controller
 MCP2515 MCP2515Module;
 
@@ -15,12 +18,45 @@ uint16_t counter_up_overflow=0;
 uint16_t counter_down=4095;
 uint16_t counter_down_overflow=0;
 
-// Initialize booleans for Message-Handling
-bool Message_1_Filled=false;
-bool Message_2_Filled=false;
-bool Send_Message_1 = false;
-bool Send_Message_2 = false;
+// Definition of Message_1 (each 100ms)
+uint32_t ID_1 = 0xA74BF55;
+bool Extended_1 = true;
+uint8_t DLC_1 = 8;
+uint8_t DataBuffer_1[8];
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+uint8_t Handle_1 = MCP2515_CYCLIC_MESSAGE_INVALID;
+#endif
+
+// Definition of Message_2 (each 1000ms, 50ms after Message_1)
+uint32_t ID_2 = 0x1AB;
+bool Extended_2 = false;
+uint8_t DLC_2 = 8;
+uint8_t DataBuffer_2[8];
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+uint8_t Handle_2 = MCP2515_CYCLIC_MESSAGE_INVALID;
+#endif
+
+// Time of the last Data-Update and Statistic-Output
+uint32_t last_update_1 = 0;
+uint32_t last_update_2 = 0;
+uint32_t last_statistic = 0;
 
+#ifndef MCP2515_ENABLE_CYCLIC_MESSAGES
+// Without the Scheduler the Message is sent directly in a free Transmit-Buffer
+void sendDirect(const char *Name, uint32_t ID, bool Extended, uint8_t DLC, uint8_t Data[])
+{
+  uint8_t Buffer = MCP2515Module.check4FreeTransmitBuffer();
+
+  if (Buffer == 0xFF ||
+      !MCP2515Module.fillTransmitBuffer(Buffer, ID, Extended, false, DLC, Data) ||
+      !MCP2515Module.sendMessage(Buffer, 0))
+  {
+    Serial.print(Name);
+    Serial.print(" send-Error: 0x");
+    Serial.println(MCP2515Module.getLastMCPError(), HEX);
+  }
+}
+#endif
 
 void setup() {
   // Initialize Serial for Debug
@@ -116,29 +152,47 @@ void setup() {
     delay(1000);
   }
 
+  memset(DataBuffer_1, 0, sizeof(DataBuffer_1));
+  memset(DataBuffer_2, 0, sizeof(DataBuffer_2));
+
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+  Serial.println("Register cyclic Messages.");
+  // Register the cyclic Messages. From now on the Scheduler releases them on time,
+  // processCyclicMessages() has to be called in the loop to transmit them.
+  Handle_1 = MCP2515Module.addCyclicMessage(ID_1, Extended_1, DLC_1, DataBuffer_1, 100, 0);
+  Handle_2 = MCP2515Module.addCyclicMessage(ID_2, Extended_2, DLC_2, DataBuffer_2, 1000, 50);
+
+  if (Handle_1 == MCP2515_CYCLIC_MESSAGE_INVALID || Handle_2 == MCP2515_CYCLIC_MESSAGE_INVALID)
+  {
+    // When Register the cyclic Messages failed (check MCP2515Error.h)
+    Serial.print("Register cyclic Message-Error: 0x");
+    Serial.println(MCP2515Module.getLastMCPError(), HEX);
+  }
+#endif
+
   delay(2000);
 }
 
 void loop() {
-  // Definition of Message_1
-  uint32_t ID_1 = 0xA74BF55;
-  bool Extended_1 = true;
-  uint8_t DLC_1 = 8;
-  uint8_t DataBuffer_1[8];
-
-  // Definition of Message_2
-  uint32_t ID_2 = 0x1AB;
-  bool Extended_2 = false;
-  uint8_t DLC_2 = 8;
-  uint8_t DataBuffer_2[8];
-
-  // Initialize the Timer
-  uint32_t time_ms = millis() % 1000;
-  uint32_t time_s = millis()/1000;
-
-  // Each 100ms (when Buffer of Message_1 is not filled)
-  if ((millis() % 100) == 0 && Message_1_Filled == false)
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+  // Transmit all released cyclic Messages
+  MCP2515Module.processCyclicMessages();
+
+  if (MCP2515Module.getLastMCPError() != 0)
   {
+    Serial.print("Cyclic Message send-Error: 0x");
+    Serial.println(MCP2515Module.getLastMCPError(), HEX);
+  }
+#endif
+
+  // Update the Data of Message_1 (the new Data is used at the next Release)
+  if (millis() - last_update_1 >= 100)
+  {
+    last_update_1 += 100;
+
+    uint32_t time_ms = millis() % 1000;
+    uint32_t time_s = millis()/1000;
+
     // fill the DataBuffer of the Message_1 with the calculated Data.
     DataBuffer_1[0] = (uint8_t)((((time_s >> 8) >> 8) >> 8) & 0xFF);
     DataBuffer_1[1] = (uint8_t)(((time_s >> 8) >> 8) & 0xFF);
@@ -149,17 +203,19 @@ void loop() {
     DataBuffer_1[5] = (uint8_t)(((time_ms >> 8) >> 8) & 0xFF);
     DataBuffer_1[6] = (uint8_t)((time_ms >> 8) & 0xFF);
     DataBuffer_1[7] = (uint8_t)(time_ms & 0xFF);
-    Message_1_Filled = true;
 
-  } else if ((millis() % 100) != 0 && Message_1_Filled == true)
-  {
-    Message_1_Filled = false;
-    Send_Message_1 = true;
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+    MCP2515Module.updateCyclicMessage(Handle_1, DLC_1, DataBuffer_1);
+#else
+    sendDirect("Message_1", ID_1, Extended_1, DLC_1, DataBuffer_1);
+#endif
   }
 
-  // Each 1000ms (when Buffer of Message_2 is not filled)
-  if ((millis() % 1000) == 0 && Message_2_Filled == false)
+  // Update the Data of Message_2
+  if (millis() - last_update_2 >= 1000)
   {
+    last_update_2 += 1000;
+
     // Calculate the Data
     if (counter_up > 4094)
     {
@@ -187,41 +243,38 @@ void loop() {
     DataBuffer_2[6] = (uint8_t)((counter_down_overflow >> 8) & 0xFF);
     DataBuffer_2[7] = (uint8_t)(counter_down_overflow & 0xFF);
 
-    Message_2_Filled = true;
-
-  } else if ((millis() % 1000) != 0 && Message_2_Filled == true)
-  {
-    Message_2_Filled = false;
-    Send_Message_2 = true;
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+    MCP2515Module.updateCyclicMessage(Handle_2, DLC_2, DataBuffer_2);
+#else
+    sendDirect("Message_2", ID_2, Extended_2, DLC_2, DataBuffer_2);
+#endif
   }
 
-  // Check if Message_1 is Ready to send
-  if (MCP2515Module.check4FreeTransmitBuffer() != 0xFF && Send_Message_1)
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+  // Show the Statistic of the cyclic Messages each 10s
+  if (millis() - last_statistic >= 10000)
   {
-    uint8_t Buffer = MCP2515Module.check4FreeTransmitBuffer();
-    MCP2515Module.fillTransmitBuffer(Buffer, ID_1, Extended_1, false, DLC_1, DataBuffer_1);
-    if (!MCP2515Module.sendMessage(Buffer, 0))
-    {
-      Serial.print("Message_1 send-Error: 0x");
-      Serial.println(MCP2515Module.getLastMCPError(), HEX);
-    } else {
-      Serial.println("Message_1 send.");
-      Send_Message_1 = false;
-    }
-  }
+    last_statistic += 10000;
 
-  // Check if Message_2 is Ready to send
-  if (MCP2515Module.check4FreeTransmitBuffer() != 0xFF && Send_Message_2)
-  {
-    uint8_t Buffer = MCP2515Module.check4FreeTransmitBuffer();
-    MCP2515Module.fillTransmitBuffer(Buffer, ID_2, Extended_2, false, DLC_2, DataBuffer_2);
-    if (!MCP2515Module.sendMessage(Buffer, 0))
+    MCP2515CyclicStatistic Statistic;
+    uint8_t Handles[2] = {Handle_1, Handle_2};
+
+    for (size_t i = 0; i < 2; i++)
     {
-      Serial.print("Message_2 send-Error: 0x");
-      Serial.println(MCP2515Module.getLastMCPError(), HEX);
-    } else {
-      Serial.println("Message_2 send.");
-      Send_Message_2 = false;
+      if (MCP2515Module.getCyclicMessageStatistic(Handles[i], Statistic))
+      {
+        Serial.print("Message_");
+        Serial.print(i + 1);
+        Serial.print(" send: ");
+        Serial.print(Statistic.sendCount);
+        Serial.print(" max. Jitter: ");
+        Serial.print(Statistic.maxJitter);
+        Serial.print("us avg. Jitter: ");
+        Serial.print(Statistic.averageJitter);
+        Serial.print("us Deadline-Misses: ");
+        Serial.println(Statistic.deadlineMisses);
+      }
     }
   }
+#endif
 }
@@ -0,0 +1,157 @@
+#include <Arduino.h>
+#include <MCP2515.h>
+
+// With the Transmit-Queue enabled for the whole Build (e.g. build_flags = -D MCP2515_ENABLE_TRANSMIT_QUEUE)
+// the Streaming-Transmission uses processTransmitQueue(), otherwise sendFrames() with all three TX-Buffers.
+
+// Create Instances of the CAN-Controller
+MCP2515 MCP2515Module;
+
+// Definition of Chip-Select-Pin for the SPI-Communication
+// Choose the Pin of the Arduino (or similar) which is connected with the CS-Pin of the MCP2515
+uint8_t CS_Pin = 17;  // for Micro
+//uint8_t CS_Pin = 53;  // for Mega
+
+// Settings of the Benchmark
+const uint32_t BaudRate = 500E3;
+const uint16_t FrameCount = 1000;
+
+// The Benchmark-Frame
+MCP2515Frame Frame = {0x1AB, false, false, 8, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}};
+
+
+void printResult(const char *Name, uint16_t Frames, uint32_t BusBits, uint32_t Duration)
+{
+  // Utilization = Time on the Bus / elapsed Time
+  uint32_t BusTime = (uint32_t)(((uint64_t)BusBits * 1000000UL) / BaudRate);
+
+  Serial.print(Name);
+  Serial.print(": ");
+  Serial.print(Frames);
+  Serial.print(" Frames in ");
+  Serial.print(Duration);
+  Serial.print("us -> ");
+  Serial.print((uint32_t)(((uint64_t)Frames * 1000000UL) / Duration));
+  Serial.print(" Frames/s, Bus-Utilization: ");
+  Serial.print((uint32_t)(((uint64_t)BusTime * 100UL) / Duration));
+  Serial.println("%");
+}
+
+void setup() {
+  // Initialize Serial for Debug
+  Serial.begin(115200);
+
+  delay(5000);
+
+  Serial.println("Initialize MCP2515.");
+  while (!MCP2515Module.setSpiPins(CS_Pin) ||
+         !MCP2515Module.setClockFrequency((uint32_t)8E6) ||
+         !MCP2515Module.setSpiFrequency(10e6) ||
+         !MCP2515Module.init(BaudRate, true))
+  {
+    // When Initialize the MCP2515 failed (check MCP2515Error.h)
+    Serial.print("Init-Error: 0x");
+    Serial.println(MCP2515Module.getLastMCPError(), HEX);
+    delay(1000);
+  }
+
+  // In Loopback-Mode the Frames are transmitted with the Bit-Timing of the Bus but without a Bus,
+  // so the Benchmark shows the Limit of the MCU/SPI-Side.
+  while (!MCP2515Module.setLoopbackMode())
+  {
+    Serial.print("Set Loopback-Mode-Error: 0x");
+    Serial.println(MCP2515Module.getLastMCPError(), HEX);
+    delay(1000);
+  }
+
+  delay(1000);
+}
+
+void loop() {
+  // On-wire Bits of the sent Frames incl. Stuff-Bits and Interframe-Space (the Stuff-Bits depend on the Data)
+  uint32_t BusBits = 0;
+
+  // 1. Blocking Transmission: load a Buffer, wait till the Frame is transmitted and load the next one
+  uint16_t Sent = 0;
+  uint32_t Start = micros();
+
+  for (uint16_t i = 0; i < FrameCount; i++)
+  {
+    Frame.data[0] = (uint8_t)i;
+
+    if (!MCP2515Module.fillTransmitBuffer(0, Frame.id, Frame.extended, Frame.rtr, Frame.dlc, Frame.data) ||
+        !MCP2515Module.sendMessage(0))
+    {
+      Serial.print("Send-Error: 0x");
+      Serial.println(MCP2515Module.getLastMCPError(), HEX);
+      break;
+    }
+
+    BusBits += MCP2515Module.calculateFrameBitLength(Frame);
+    Sent++;
+  }
+
+  printResult("sendMessage", Sent, BusBits, micros() - Start);
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+  // 2. Streaming Transmission: the next Frames are already loaded while one Frame is on the Bus
+  uint16_t Queued = 0;
+  BusBits = 0;
+  Start = micros();
+
+  while (Queued < FrameCount || MCP2515Module.getTransmitQueueCount() > 0)
+  {
+    while (Queued < FrameCount)
+    {
+      Frame.data[0] = (uint8_t)Queued;
+
+      if (!MCP2515Module.queueMessage(Frame))
+      {
+        break;
+      }
+
+      BusBits += MCP2515Module.calculateFrameBitLength(Frame);
+      Queued++;
+    }
+
+    MCP2515Module.processTransmitQueue();
+  }
+
+  printResult("processTransmitQueue", FrameCount, BusBits, micros() - Start);
+#else
+  // 2. Batch Transmission: three Frames are released with one RTS-Instruction
+  MCP2515Frame Frames[3] = {Frame, Frame, Frame};
+  Sent = 0;
+  BusBits = 0;
+  Start = micros();
+
+  while (Sent < FrameCount)
+  {
+    uint8_t Count = ((FrameCount - Sent) < 3) ? (FrameCount - Sent) : 3;
+
+    for (uint8_t i = 0; i < Count; i++)
+    {
+      Frames[i].data[0] = (uint8_t)(Sent + i);
+    }
+
+    if (!MCP2515Module.sendFrames(Frames, Count))
+    {
+      Serial.print("Send-Error: 0x");
+      Serial.println(MCP2515Module.getLastMCPError(), HEX);
+      break;
+    }
+
+    for (uint8_t i = 0; i < Count; i++)
+    {
+      BusBits += MCP2515Module.calculateFrameBitLength(Frames[i]);
+    }
+
+    Sent = Sent + Count;
+  }
+
+  printResult("sendFrames", Sent, BusBits, micros() - Start);
+#endif
+
+  Serial.println();
+  delay(5000);
+}
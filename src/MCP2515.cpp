@@ -1,5 +1,66 @@
 #include "MCP2515.h"
 
+// Register-Cache: Address, read-only Bits (always read from the MCP2515) and Value after the Reset of the cached Registers
+static const uint8_t CachedRegisterAddress[MCP2515_CACHED_REGISTERS] = {REG_BFPCTRL, REG_TXRTSCTRL, REG_CANCTRL, REG_CNF3, REG_CNF2, REG_CNF1, REG_CANINTE, REG_RXBnCTRL(0), REG_RXBnCTRL(1)};
+static const uint8_t CachedRegisterReadOnly[MCP2515_CACHED_REGISTERS] = {0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0F};
+static const uint8_t CachedRegisterReset[MCP2515_CACHED_REGISTERS] = {0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// Baudrate-Detection: Candidates ordered by their Use in the Field (incl. the non-standard Baudrates 83.3k, 33.3k and 666.6k)
+static const uint32_t AutoBaudCandidates[] = {500000, 250000, 125000, 1000000, 100000, 50000, 20000, 10000, 83333, 33333, 800000, 666666, 200000, 5000};
+
+// Frame-Length (see getFrameBitLength()): CRC-15 (x^15 + x^14 + x^10 + x^8 + x^7 + x^4 + x^3 + 1) of a Nibble
+static const uint16_t FrameCrcTable[16] PROGMEM = {
+  0x0000, 0x4599, 0x4EAB, 0x0B32, 0x58CF, 0x1D56, 0x1664, 0x53FD, 0x7407, 0x319E, 0x3AAC, 0x7F35, 0x2CC8, 0x6951, 0x6263, 0x27FA
+};
+
+// Frame-Length: Bit-Stuffing of a Nibble, Index = State * 16 + Nibble, State = (last Bit << 2) | (Run - 1), Value = (Stuff-Bit << 3) | next State
+static const uint8_t FrameStuffTable[128] PROGMEM = {
+  0x0C, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x06, 0x02, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x07,
+  0x08, 0x0D, 0x00, 0x05, 0x01, 0x04, 0x00, 0x06, 0x02, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x07,
+  0x09, 0x0C, 0x08, 0x0E, 0x01, 0x04, 0x00, 0x06, 0x02, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x07,
+  0x0A, 0x0C, 0x08, 0x0D, 0x09, 0x0C, 0x08, 0x0F, 0x02, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x07,
+  0x03, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x06, 0x02, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x08,
+  0x03, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x06, 0x02, 0x04, 0x00, 0x05, 0x01, 0x04, 0x09, 0x0C,
+  0x03, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x06, 0x02, 0x04, 0x00, 0x05, 0x0A, 0x0C, 0x08, 0x0D,
+  0x03, 0x04, 0x00, 0x05, 0x01, 0x04, 0x00, 0x06, 0x0B, 0x0C, 0x08, 0x0D, 0x09, 0x0C, 0x08, 0x0E
+};
+
+// Performance-Counters (see getPerformanceCounters()): without MCP2515_ENABLE_PERFORMANCE_COUNTERS the Macros are empty
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+  #define MCP2515_COUNT_SPI(Bytes)        (this->_performanceCounters.spiTransactions++, this->_performanceCounters.spiBytes += (Bytes))
+  #define MCP2515_COUNT_READBACK()        (this->_performanceCounters.readbacks++)
+  #define MCP2515_COUNT_BUSY_WAIT(Time)   (this->_performanceCounters.busyWaitTime += (Time))
+  #define MCP2515_BUSY_WAIT_BEGIN()       uint32_t BusyWaitStart = micros()
+  #define MCP2515_BUSY_WAIT_END()         (this->_performanceCounters.busyWaitTime += micros() - BusyWaitStart)
+#else
+  #define MCP2515_COUNT_SPI(Bytes)
+  #define MCP2515_COUNT_READBACK()
+  #define MCP2515_COUNT_BUSY_WAIT(Time)
+  #define MCP2515_BUSY_WAIT_BEGIN()
+  #define MCP2515_BUSY_WAIT_END()
+#endif
+
+// Latency-Histograms (see getLatencyHistogram()): without MCP2515_ENABLE_LATENCY_HISTOGRAMS the Macros are empty
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+  #define MCP2515_LATENCY_RX_AVAILABLE(Flags)             noteReceiveAvailable(Flags)
+  #define MCP2515_LATENCY_RX_CONSUMED(BufferNumber)       noteReceiveConsumed(BufferNumber)
+  #define MCP2515_LATENCY_TX_ENQUEUED(BufferNumber, Time) noteTransmitEnqueued((BufferNumber), (Time))
+  #define MCP2515_LATENCY_TX_STARTED(Mask)                noteTransmitStarted(Mask)
+  #define MCP2515_LATENCY_TX_COMPLETED(BufferNumber)      noteTransmitCompleted(BufferNumber)
+#else
+  #define MCP2515_LATENCY_RX_AVAILABLE(Flags)
+  #define MCP2515_LATENCY_RX_CONSUMED(BufferNumber)
+  #define MCP2515_LATENCY_TX_ENQUEUED(BufferNumber, Time)
+  #define MCP2515_LATENCY_TX_STARTED(Mask)
+  #define MCP2515_LATENCY_TX_COMPLETED(BufferNumber)
+#endif
+
+// Bus-Load (see getBusLoad()): without MCP2515_ENABLE_BUS_LOAD the Macro is empty
+#ifdef MCP2515_ENABLE_BUS_LOAD
+  #define MCP2515_BUS_LOAD_TX_COMPLETED(BufferNumber)     addTransmittedBuffer(BufferNumber)
+#else
+  #define MCP2515_BUS_LOAD_TX_COMPLETED(BufferNumber)
+#endif
 
 /***********************************************************************************************************************
  * 									Private Methods
@@ -60,6 +121,7 @@ bool MCP2515::setFilterStandardIdentifierHigh(uint8_t FilterNumber, uint8_t Stan
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getFilterStandardIdentifierHigh(FilterNumber) != StandardId_10_3)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -143,6 +205,7 @@ bool MCP2515::setFilterStandardIdentifierLow(uint8_t FilterNumber, uint8_t Stand
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getFilterStandardIdentifierLow(FilterNumber) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -205,6 +268,7 @@ bool MCP2515::setFilterExtendedIdentifierHigh(uint8_t FilterNumber, uint8_t Exte
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getFilterExtendedIdentifierHigh(FilterNumber) != ExtendedId_15_8)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -267,6 +331,7 @@ bool MCP2515::setFilterExtendedIdentifierLow(uint8_t FilterNumber, uint8_t Exten
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getFilterExtendedIdentifierLow(FilterNumber) != ExtendedId_7_0)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -329,6 +394,7 @@ bool MCP2515::setMaskStandardIdentifierHigh(uint8_t MaskNumber, uint8_t Standard
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getMaskStandardIdentifierHigh(MaskNumber) != StandardId_10_3)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -401,6 +467,7 @@ bool MCP2515::setMaskStandardIdentifierLow(uint8_t MaskNumber, uint8_t StandardI
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getMaskStandardIdentifierLow(MaskNumber) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -463,6 +530,7 @@ bool MCP2515::setMaskExtendedIdentifierHigh(uint8_t MaskNumber, uint8_t Extended
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getMaskExtendedIdentifierHigh(MaskNumber) != ExtendedId_15_8)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -525,6 +593,7 @@ bool MCP2515::setMaskExtendedIdentifierLow(uint8_t MaskNumber, uint8_t ExtendedI
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getMaskExtendedIdentifierLow(MaskNumber) != ExtendedId_7_0)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -630,6 +699,7 @@ bool MCP2515::setRXnBFPinControl(bool B1BFS, bool B0BFS, bool B1BFE, bool B0BFE,
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getRXnBFPinControl() != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -700,6 +770,7 @@ bool MCP2515::modifyRXnBFPinControl(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getRXnBFPinControl() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -802,6 +873,7 @@ bool MCP2515::setTXnRTSPinControl(bool B2RTSM, bool B1RTSM, bool B0RTSM)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getTXnRTSPinControl() & (TXRTSCTRL_BIT_BnRTSM(0) | TXRTSCTRL_BIT_BnRTSM(1) | TXRTSCTRL_BIT_BnRTSM(2))) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -863,6 +935,7 @@ bool MCP2515::modifyTXnRTSPinControl(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getTXnRTSPinControl() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1024,6 +1097,7 @@ bool MCP2515::setCanControl(uint8_t REQOP, bool ABAT, bool OSM, bool CLKEN, uint
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getCanControl() != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1103,9 +1177,11 @@ bool MCP2515::modifyCanControl(uint8_t Mask, uint8_t Value)
   }
 
   delayMicroseconds(100);
+  MCP2515_COUNT_BUSY_WAIT(100);
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getCanControl() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1220,6 +1296,7 @@ bool MCP2515::setConfigurationRegister3(bool SOF, bool WAKFIL, uint8_t PHSEG2)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getConfigurationRegister3() != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1285,6 +1362,7 @@ bool MCP2515::modifyConfigurationRegister3(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getConfigurationRegister3() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1373,6 +1451,7 @@ bool MCP2515::setConfigurationRegister2(bool BTLMODE, bool SAM, uint8_t PHSEG1,
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getConfigurationRegister2() != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1430,6 +1509,7 @@ bool MCP2515::modifyConfigurationRegister2(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getConfigurationRegister2() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1506,6 +1586,7 @@ bool MCP2515::setConfigurationRegister1(uint8_t SJW, uint8_t BRP)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getConfigurationRegister1() != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1557,6 +1638,7 @@ bool MCP2515::modifyConfigurationRegister1(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getConfigurationRegister1() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1694,6 +1776,7 @@ bool MCP2515::setCanInterruptEnable(bool MERRE, bool WAKIE, bool ERRIE, bool TX2
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getCanInterruptEnable() != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1772,6 +1855,7 @@ bool MCP2515::modifyCanInterruptEnable(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getCanInterruptEnable() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1916,6 +2000,7 @@ bool MCP2515::setCanInterruptFlag(bool MERRF, bool WAKIF, bool ERRIF, bool TX2IF
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getCanInterruptFlag() != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -1994,6 +2079,7 @@ bool MCP2515::modifyCanInterruptFlag(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getCanInterruptFlag() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2096,6 +2182,7 @@ bool MCP2515::setErrorFlag(bool RX1OVR, bool RX0OVR)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getErrorFlag() & (EFLG_BIT_RXnOVR(0) | EFLG_BIT_RXnOVR(1))) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2144,6 +2231,7 @@ bool MCP2515::modifyErrorFlag(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getErrorFlag() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2244,6 +2332,7 @@ bool MCP2515::setTransmitBufferControl(uint8_t BufferNumber, bool TXREQ, uint8_t
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getTransmitBufferControl(BufferNumber) & (TXBnCTRL_BIT_TXREQ | TXBnCTRL_BIT_TXP)) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2302,6 +2391,7 @@ bool MCP2515::modifyTransmitBufferControl(uint8_t BufferNumber, uint8_t Mask, ui
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getTransmitBufferControl(BufferNumber) & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2355,6 +2445,7 @@ bool MCP2515::setTransmitBufferStandardIdentifierHigh(uint8_t BufferNumber, uint
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getTransmitBufferStandardIdentifierHigh(BufferNumber) != StandardId_10_3)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2431,6 +2522,7 @@ bool MCP2515::setTransmitBufferStandardIdentifierLow(uint8_t BufferNumber, uint8
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getTransmitBufferStandardIdentifierLow(BufferNumber) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2484,6 +2576,7 @@ bool MCP2515::setTransmitBufferExtendedIdentifierHigh(uint8_t BufferNumber, uint
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getTransmitBufferExtendedIdentifierHigh(BufferNumber) != ExtendedId_15_8)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2537,6 +2630,7 @@ bool MCP2515::setTransmitBufferExtendedIdentifierLow(uint8_t BufferNumber, uint8
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getTransmitBufferExtendedIdentifierLow(BufferNumber) != ExtendedId_7_0)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2603,6 +2697,7 @@ bool MCP2515::setTransmitBufferDataLengthCode(uint8_t BufferNumber, bool RTR, ui
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getTransmitBufferDataLengthCode(BufferNumber) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2715,6 +2810,7 @@ bool MCP2515::setTransmitBufferDataByte(uint8_t BufferNumber, uint8_t ByteNumber
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (getTransmitBufferDataByte(BufferNumber, ByteNumber) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2808,6 +2904,7 @@ bool MCP2515::setReceiveBuffer0Control(uint8_t RXM, bool BUKT)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getReceiveBuffer0Control() & (RXBnCTRL_BIT_RXM | RXBnCTRL_BIT_BUFFER0_BUKT)) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2862,6 +2959,7 @@ bool MCP2515::modifyReceiveBuffer0Control(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getReceiveBuffer0Control() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2944,6 +3042,7 @@ bool MCP2515::setReceiveBuffer1Control(uint8_t RXM)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getReceiveBuffer1Control() & RXBnCTRL_BIT_RXM) != Data)
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -2990,6 +3089,7 @@ bool MCP2515::modifyReceiveBuffer1Control(uint8_t Mask, uint8_t Value)
 
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if ((getReceiveBuffer1Control() & Mask) != (Value & Mask))
     {
       this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
@@ -3173,6 +3273,7 @@ uint8_t MCP2515::getReceiveBufferDataByte(uint8_t BufferNumber, uint8_t ByteNumb
  */
 bool MCP2515::resetInstruction()
 {
+  MCP2515_COUNT_SPI(1);
   SPI.beginTransaction(_spiSettings);
   digitalWrite(_csPin, LOW);
   SPI.transfer(MCP2515_SPI_INSTRUCTION_RESET);
@@ -3180,10 +3281,14 @@ bool MCP2515::resetInstruction()
   SPI.endTransaction();
 
   delayMicroseconds(10);
+  MCP2515_COUNT_BUSY_WAIT(10);
+
+  resetRegisterCache();
 
   // Check if Configuration-Mode is set
   if (_reCheckEnabled)
   {
+    MCP2515_COUNT_READBACK();
     if (((getCanStatus() & CANSTAT_BIT_OPMOD) >> 5) != MCP2515_OP_CONFIGURATION) {
       this->_lastMcpError = ERROR_SPI_CONFIGURATION_MODE_NOT_SET;
       return false;
@@ -3203,6 +3308,34 @@ bool MCP2515::resetInstruction()
  */
 bool MCP2515::writeInstruction(uint8_t Address, uint8_t Value)
 {
+  uint8_t Index = getCachedRegisterIndex(Address);
+  uint8_t FilterIndex = getFilterRegisterIndex(Address);
+
+  if (_registerCacheEnabled && (Index != 0xFF))
+  {
+    // Unchanged Values are not written again (a Request of an Operation-Mode always)
+    if ((Address != REG_CANCTRL) &&
+        (_registerCacheValid & (1 << Index)) &&
+        (((_registerCache[Index] ^ Value) & ~CachedRegisterReadOnly[Index]) == 0x00))
+    {
+      return true;
+    }
+
+    this->_registerCache[Index] = Value;
+    this->_registerCacheValid = _registerCacheValid | (1 << Index);
+  }
+
+  if (_filterRegistersValid && (FilterIndex != 0xFF))
+  {
+    if (_registerCacheEnabled && (_filterRegisters[FilterIndex] == Value))
+    {
+      return true;
+    }
+
+    this->_filterRegisters[FilterIndex] = Value;
+  }
+
+  MCP2515_COUNT_SPI(3);
   SPI.beginTransaction(_spiSettings);
   digitalWrite(_csPin, LOW);
   SPI.transfer(MCP2515_SPI_INSTRUCTION_WRITE);
@@ -3211,6 +3344,54 @@ bool MCP2515::writeInstruction(uint8_t Address, uint8_t Value)
   digitalWrite(_csPin, HIGH);
   SPI.endTransaction();
   delayMicroseconds(10);
+  MCP2515_COUNT_BUSY_WAIT(10);
+
+  return true;
+}
+
+/**
+ * @brief Writes the given Values sequentially into the Registers, starting at Address.
+ *
+ * The Address-Pointer is incremented by the MCP2515 after each Byte, so a whole Register-Block is written with one Instruction.
+ * @note Doc p. 65; Kap. 12.5
+ * @param Address Register-Adress of the first Value
+ * @param Values Values
+ * @param Length Number of Bytes to write (1 - 128, Address + Length <= 0x80)
+ * @return true on success, false when not (Check _lastMcpError)
+ */
+bool MCP2515::writeInstruction(uint8_t Address, const uint8_t Values[], uint8_t Length)
+{
+  if ((Length == 0) || ((uint16_t)Address + Length > 0x80))
+  {
+    this->_lastMcpError = ERROR_SPI_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  MCP2515_COUNT_SPI(2 + Length);
+  SPI.beginTransaction(_spiSettings);
+  digitalWrite(_csPin, LOW);
+  SPI.transfer(MCP2515_SPI_INSTRUCTION_WRITE);
+  SPI.transfer(Address);
+  for (uint8_t i = 0; i < Length; i++)
+  {
+    SPI.transfer(Values[i]);
+
+    uint8_t Index = getCachedRegisterIndex(Address + i);
+    uint8_t FilterIndex = getFilterRegisterIndex(Address + i);
+
+    if (_registerCacheEnabled && (Index != 0xFF))
+    {
+      this->_registerCache[Index] = Values[i];
+      this->_registerCacheValid = _registerCacheValid | (1 << Index);
+    }
+
+    if (_filterRegistersValid && (FilterIndex != 0xFF))
+    {
+      this->_filterRegisters[FilterIndex] = Values[i];
+    }
+  }
+  digitalWrite(_csPin, HIGH);
+  SPI.endTransaction();
 
   return true;
 }
@@ -3234,6 +3415,23 @@ bool MCP2515::bitModifyInstruction(uint8_t Address, uint8_t Mask, uint8_t Value)
       Address==REG_EFLG or Address==REG_TXBnCTRL(0) or Address==REG_TXBnCTRL(1) or Address==REG_TXBnCTRL(2) or
       Address==REG_RXBnCTRL(0) or Address==REG_RXBnCTRL(1))
   {
+    uint8_t Index = getCachedRegisterIndex(Address);
+
+    if (_registerCacheEnabled && (Index != 0xFF) && (_registerCacheValid & (1 << Index)))
+    {
+      uint8_t Data = (_registerCache[Index] & ~Mask) | (Value & Mask);
+
+      // Unchanged Values are not written again (a Request of an Operation-Mode or an Abort always)
+      if (!((Address == REG_CANCTRL) && (Mask & (CANCTRL_BIT_REQOP | CANCTRL_BIT_ABAT))) &&
+          (((_registerCache[Index] ^ Data) & ~CachedRegisterReadOnly[Index]) == 0x00))
+      {
+        return true;
+      }
+
+      this->_registerCache[Index] = Data;
+    }
+
+    MCP2515_COUNT_SPI(4);
     SPI.beginTransaction(_spiSettings);
     digitalWrite(_csPin, LOW);
     SPI.transfer(MCP2515_SPI_INSTRUCTION_BIT_MODIFY);
@@ -3285,6 +3483,7 @@ bool MCP2515::loadTxBufferInstruction(uint8_t Value, bool a, bool b, bool c)
 
   uint8_t Instruction = MCP2515_SPI_INSTRUCTION_LOAD_TX_BUFFER | a << 2 | b << 1 | c;
 
+  MCP2515_COUNT_SPI(2);
   SPI.beginTransaction(_spiSettings);
   digitalWrite(_csPin, LOW);
   SPI.transfer(Instruction);
@@ -3295,6 +3494,45 @@ bool MCP2515::loadTxBufferInstruction(uint8_t Value, bool a, bool b, bool c)
   return true;
 }
 
+/**
+ * @brief Writes the given Values sequentially into a transmit buffer, starting at the Address-Pointer selected with a, b and c.
+ *
+ * The Address-Pointer is incremented by the MCP2515 after each Byte (see loadTxBufferInstruction(Value, a, b, c)).
+ * @note Doc p. 65; Kap. 12.6
+ * @param Values Data
+ * @param Length Number of Bytes to write (1 - 13)
+ * @param a TX-Buffer Adress-Pointer (false or true)
+ * @param b TX-Buffer Adress-Pointer (false or true)
+ * @param c TX-Buffer Adress-Pointer (false or true)
+ * @return true on success, false when not (Check _lastMcpError)
+ */
+bool MCP2515::loadTxBufferInstruction(const uint8_t Values[], uint8_t Length, bool a, bool b, bool c)
+{
+  if ((a != false && a != true) ||
+      (b != false && b != true) ||
+      (c != false && c != true) ||
+      (Length == 0) || (Length > 13))
+  {
+    this->_lastMcpError = ERROR_SPI_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  uint8_t Instruction = MCP2515_SPI_INSTRUCTION_LOAD_TX_BUFFER | a << 2 | b << 1 | c;
+
+  MCP2515_COUNT_SPI(1 + Length);
+  SPI.beginTransaction(_spiSettings);
+  digitalWrite(_csPin, LOW);
+  SPI.transfer(Instruction);
+  for (uint8_t i = 0; i < Length; i++)
+  {
+    SPI.transfer(Values[i]);
+  }
+  digitalWrite(_csPin, HIGH);
+  SPI.endTransaction();
+
+  return true;
+}
+
 /**
  * @brief Initiate message transmission for one or more of the transmit buffers.
  * @note Doc p. 65; Kap. 12.7
@@ -3314,6 +3552,7 @@ bool MCP2515::rtsInstruction(bool TXBuffer_0, bool TXBuffer_1, bool TXBuffer_2)
   } else if (TXBuffer_0 || TXBuffer_1 || TXBuffer_2)
   {
     uint8_t Instruction = MCP2515_SPI_INSTRUCTION_RTS | TXBuffer_2 << 2 | TXBuffer_1 << 1 | TXBuffer_0;
+    MCP2515_COUNT_SPI(1);
     SPI.beginTransaction(_spiSettings);
     digitalWrite(_csPin, LOW);
     SPI.transfer(Instruction);
@@ -3356,6 +3595,7 @@ bool MCP2515::rtsInstruction(bool TXBuffer_0, bool TXBuffer_1, bool TXBuffer_2)
 uint8_t MCP2515::rxStatusInstruction()
 {
   uint8_t value;
+  MCP2515_COUNT_SPI(2);
   SPI.beginTransaction(_spiSettings);
   digitalWrite(_csPin, LOW);
   SPI.transfer(MCP2515_SPI_INSTRUCTION_RX_STATUS);
@@ -3377,7 +3617,22 @@ uint8_t MCP2515::rxStatusInstruction()
 uint8_t MCP2515::readInstruction(uint8_t Address)
 {
   uint8_t value;
+  uint8_t Index = getCachedRegisterIndex(Address);
+
+  if (_registerCacheEnabled)
+  {
+    if ((Index != 0xFF) && (_registerCacheValid & (1 << Index)) && (CachedRegisterReadOnly[Index] == 0x00))
+    {
+      return _registerCache[Index];
+    }
+
+    if (_filterRegistersValid && (getFilterRegisterIndex(Address) != 0xFF))
+    {
+      return _filterRegisters[getFilterRegisterIndex(Address)];
+    }
+  }
 
+  MCP2515_COUNT_SPI(3);
   SPI.beginTransaction(_spiSettings);
   digitalWrite(_csPin, LOW);
   SPI.transfer(MCP2515_SPI_INSTRUCTION_READ);
@@ -3386,9 +3641,56 @@ uint8_t MCP2515::readInstruction(uint8_t Address)
   digitalWrite(_csPin, HIGH);
   SPI.endTransaction();
 
+  if (_registerCacheEnabled && (Index != 0xFF))
+  {
+    this->_registerCache[Index] = value;
+    this->_registerCacheValid = _registerCacheValid | (1 << Index);
+  }
+
   return value;
 }
 
+/**
+ * @brief Reads the Registers sequentially, starting at Address.
+ *
+ * The Address-Pointer is incremented by the MCP2515 after each Byte, so a whole Register-Block is read with one Instruction.
+ * @note Doc p. 65; Kap. 12.3
+ * @param Address Register-Adress of the first Value
+ * @param Values read Values
+ * @param Length Number of Bytes to read (1 - 128, Address + Length <= 0x80)
+ * @return true on success, false when not (Check _lastMcpError)
+ */
+bool MCP2515::readInstruction(uint8_t Address, uint8_t Values[], uint8_t Length)
+{
+  if ((Length == 0) || ((uint16_t)Address + Length > 0x80))
+  {
+    this->_lastMcpError = ERROR_SPI_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  MCP2515_COUNT_SPI(2 + Length);
+  SPI.beginTransaction(_spiSettings);
+  digitalWrite(_csPin, LOW);
+  SPI.transfer(MCP2515_SPI_INSTRUCTION_READ);
+  SPI.transfer(Address);
+  for (uint8_t i = 0; i < Length; i++)
+  {
+    Values[i] = SPI.transfer(0x00);
+
+    uint8_t Index = getCachedRegisterIndex(Address + i);
+
+    if (_registerCacheEnabled && (Index != 0xFF))
+    {
+      this->_registerCache[Index] = Values[i];
+      this->_registerCacheValid = _registerCacheValid | (1 << Index);
+    }
+  }
+  digitalWrite(_csPin, HIGH);
+  SPI.endTransaction();
+
+  return true;
+}
+
 /**
  * @brief Single instruction access to some of the often used status bits for message reception and transmission.
  * @note Doc p. 66; Kap. 12.8
@@ -3415,6 +3717,7 @@ uint8_t MCP2515::readStatusInstruction()
 {
   uint8_t value;
 
+  MCP2515_COUNT_SPI(2);
   SPI.beginTransaction(_spiSettings);
   digitalWrite(_csPin, LOW);
   SPI.transfer(MCP2515_SPI_INSTRUCTION_READ_STATUS);
@@ -3459,6 +3762,7 @@ uint8_t MCP2515::readRxBufferInstruction(bool n, bool m)
 
   uint8_t Instruction = MCP2515_SPI_INSTRUCTION_READ_RX_BUFFER | n << 2 | m << 1;
 
+  MCP2515_COUNT_SPI(2);
   SPI.beginTransaction(_spiSettings);
   digitalWrite(_csPin, LOW);
   SPI.transfer(Instruction);
@@ -3470,103 +3774,163 @@ uint8_t MCP2515::readRxBufferInstruction(bool n, bool m)
 }
 
 /**
- * @brief Changing the Bit-Timing according to the Baudrate and ClockFrequency.
- * @param targetBaudrate possible Baudrates= (5E3, 10E3, 20E3, 40E3, 50E3, 80E3, 100E3, 125E3, 200E3, 250E3, 500E3, 1000E3)
- * @param targetClockFrequency possible ClockFrequencys= (8E6, 16E6, 25E6, 40E6)
+ * @brief Calculates the Bit-Timing (CNF1 - CNF3) for any Baudrate and ClockFrequency.
+ *
+ * Searches the Prescaler (1 - 64) and the Number of Time-Quanta per Bit (5 - 25) with the smallest Deviation of the Bitrate
+ * and the Sample-Point next to the configured Sample-Point (see setSamplePoint()). With the same Deviation more Time-Quanta are preferred.
+ *
+ * PHSEG2 is at least 2 TQ (IPT), PRSEG + PHSEG1 >= PHSEG2 and SJW = min(4, PHSEG2 - 1).
+ * @note Doc p. 41; Kap. 5.0
+ * @param BaudRate Baudrate (1E3 - 1000E3)
+ * @param ClockFrequency ClockFrequency of the MCP2515 (1E6 - 40E6)
+ * @param Cnf calculated Values of CNF1, CNF2 and CNF3
+ * @param BitRateError Deviation of the Bitrate in ppm (positive = faster than the Baudrate)
+ * @param SamplePoint reached Sample-Point in ‰ of the Bittime
  * @return true when success, false on any error (Check _lastMcpError)
  */
-bool MCP2515::changeBitTiming(uint32_t targetBaudRate, uint32_t targetClockFrequency)
+bool MCP2515::calculateBitTiming(uint32_t BaudRate, uint32_t ClockFrequency, uint8_t Cnf[3], int32_t &BitRateError, uint16_t &SamplePoint)
 {
-  uint8_t OperationMode = _operationMode;
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
 
-  if (targetBaudRate != 5E3 && targetBaudRate != 10E3 && targetBaudRate != 20E3 &&
-      targetBaudRate != 40E3 && targetBaudRate != 50E3 && targetBaudRate != 80E3 &&
-      targetBaudRate != 100E3 && targetBaudRate != 125E3 && targetBaudRate != 200E3 &&
-      targetBaudRate != 250E3 && targetBaudRate != 500E3 && targetBaudRate != 1000E3)
+  if ((BaudRate < (uint32_t)MCP2515_MIN_BAUDRATE) || (BaudRate > (uint32_t)MCP2515_MAX_BAUDRATE))
   {
     this->_lastMcpError = ERROR_MCP2515_BAUDRATE_NOT_VALID;
     return false;
   }
 
-  if (targetClockFrequency != (uint32_t)8E6 && targetClockFrequency != 16E6 && targetClockFrequency != 25E6 && targetClockFrequency != 40E6)
+  if ((ClockFrequency < (uint32_t)MCP2515_MIN_CLOCK_FREQUENCY) || (ClockFrequency > (uint32_t)MCP2515_MAX_CLOCK_FREQUENCY))
   {
     this->_lastMcpError = ERROR_MCP2515_CLOCKFREQUENCY_NOT_VALID;
     return false;
   }
 
-  // Values calculated with the BitTimeCalculator (see ..\docs\BitTimeCalculator.xlsx)
-  const struct {
-    uint32_t clockFrequency;
-    uint32_t baudRate;
-    uint8_t cnf[3];
-  } CNF_MAPPER[] = {
-    //{  (uint32_t)8E6, (uint32_t)1000E3, { 0x00, 0x80, 0x01 } }, // not possible, Prescaler out of range
-    {  (uint32_t)8E6,  (uint32_t)500E3, { 0x40, 0x89, 0x02 } },
-    {  (uint32_t)8E6,  (uint32_t)250E3, { 0xc0, 0xa4, 0x04 } },
-    {  (uint32_t)8E6,  (uint32_t)200E3, { 0xc0, 0xad, 0x06 } },
-    {  (uint32_t)8E6,  (uint32_t)125E3, { 0xc1, 0xa4, 0x04 } },
-    {  (uint32_t)8E6,  (uint32_t)100E3, { 0xc1, 0xad, 0x06 } },
-    {  (uint32_t)8E6,   (uint32_t)80E3, { 0xc1, 0xbf, 0x07 } },
-    {  (uint32_t)8E6,   (uint32_t)50E3, { 0xc3, 0xad, 0x06 } },
-    {  (uint32_t)8E6,   (uint32_t)40E3, { 0xc3, 0xbf, 0x07 } },
-    {  (uint32_t)8E6,   (uint32_t)20E3, { 0xc7, 0xbf, 0x07 } },
-    {  (uint32_t)8E6,   (uint32_t)10E3, { 0xcf, 0xbf, 0x07 } },
-    {  (uint32_t)8E6,    (uint32_t)5E3, { 0xdf, 0xbf, 0x07 } },
-
-    { (uint32_t)16E6, (uint32_t)1000E3, { 0x40, 0x89, 0x02 } },
-    { (uint32_t)16E6,  (uint32_t)500E3, { 0xc0, 0xa4, 0x04 } },
-    { (uint32_t)16E6,  (uint32_t)250E3, { 0xc1, 0xa4, 0x04 } },
-    { (uint32_t)16E6,  (uint32_t)200E3, { 0xc1, 0xad, 0x06 } },
-    { (uint32_t)16E6,  (uint32_t)125E3, { 0xc3, 0xa4, 0x04 } },
-    { (uint32_t)16E6,  (uint32_t)100E3, { 0xc3, 0xad, 0x06 } },
-    { (uint32_t)16E6,   (uint32_t)80E3, { 0xc3, 0xbf, 0x07 } },
-    { (uint32_t)16E6,   (uint32_t)50E3, { 0xc7, 0xad, 0x06 } },
-    { (uint32_t)16E6,   (uint32_t)40E3, { 0xc7, 0xbf, 0x07 } },
-    { (uint32_t)16E6,   (uint32_t)20E3, { 0xcf, 0xbf, 0x07 } },
-    { (uint32_t)16E6,   (uint32_t)10E3, { 0xdf, 0xbf, 0x07 } },
-    { (uint32_t)16E6,    (uint32_t)5E3, { 0xff, 0xbf, 0x07 } },
-
-    { (uint32_t)25E6, (uint32_t)1000E3, { 0x80, 0x9a, 0x03 } }, // Attention!!! 40ns faster than the regular Bittime (1000ns) -> not recommended
-    { (uint32_t)25E6,  (uint32_t)500E3, { 0xc0, 0xbf, 0x07 } },
-    { (uint32_t)25E6,  (uint32_t)250E3, { 0xc1, 0xbf, 0x07 } },
-    { (uint32_t)25E6,  (uint32_t)200E3, { 0xc2, 0xb5, 0x06 } }, // Attention!!! 40ns slower than the regular Bittime (5000ns)
-    { (uint32_t)25E6,  (uint32_t)125E3, { 0xc3, 0xbf, 0x07 } },
-    { (uint32_t)25E6,  (uint32_t)100E3, { 0xc4, 0xbf, 0x07 } },
-    { (uint32_t)25E6,   (uint32_t)80E3, { 0x8b, 0x9b, 0x03 } }, // Attention!!! 20ns faster than the regular Bittime (12500ns)
-    { (uint32_t)25E6,   (uint32_t)50E3, { 0xc9, 0xbf, 0x07 } },
-    { (uint32_t)25E6,   (uint32_t)40E3, { 0xcc, 0xbe, 0x07 } }, // Attention!!! 40ns faster than the regular Bittime (25000ns)
-    { (uint32_t)25E6,   (uint32_t)20E3, { 0xd8, 0xbf, 0x07 } },
-    { (uint32_t)25E6,   (uint32_t)10E3, { 0xf1, 0xbf, 0x07 } },
-    //{ (uint32_t)25E6,    (uint32_t)5E3, { 0xff, 0xbf, 0x07 } }, // not possible, Prescaler out of range
-
-    { (uint32_t)40E6, (uint32_t)1000E3, { 0xc0, 0xad, 0x06 } },
-    { (uint32_t)40E6,  (uint32_t)500E3, { 0xc1, 0xad, 0x06 } },
-    { (uint32_t)40E6,  (uint32_t)250E3, { 0xc3, 0xad, 0x06 } },
-    { (uint32_t)40E6,  (uint32_t)200E3, { 0xc3, 0xbf, 0x07 } },
-    { (uint32_t)40E6,  (uint32_t)125E3, { 0xc7, 0xad, 0x06 } },
-    { (uint32_t)40E6,  (uint32_t)100E3, { 0xc7, 0xbf, 0x07 } },
-    { (uint32_t)40E6,   (uint32_t)80E3, { 0xc9, 0xbf, 0x07 } },
-    { (uint32_t)40E6,   (uint32_t)50E3, { 0xcf, 0xbf, 0x07 } },
-    { (uint32_t)40E6,   (uint32_t)40E3, { 0xd3, 0xbf, 0x07 } },
-    { (uint32_t)40E6,   (uint32_t)20E3, { 0xe7, 0xbf, 0x07 } },
-    //{ (uint32_t)40E6,   (uint32_t)10E3, { 0xf1, 0xbf, 0x07 } }, // not possible, Prescaler out of range
-    //{ (uint32_t)40E6,    (uint32_t)5E3, { 0xff, 0xbf, 0x07 } }, // not possible, Prescaler out of range
-  };
-
-  const uint8_t* cnf = NULL;
-
-  for (unsigned int i = 0; i < (sizeof(CNF_MAPPER) / sizeof(CNF_MAPPER[0])); i++) {
-    if ((CNF_MAPPER[i].clockFrequency == targetClockFrequency) && (CNF_MAPPER[i].baudRate == targetBaudRate)) {
-      cnf = CNF_MAPPER[i].cnf;
-      break;
+  uint32_t BestError = 0xFFFFFFFF;
+  uint16_t BestSamplePointError = 0xFFFF;
+  uint8_t BestPrescaler = 0;
+  uint8_t BestSegment1 = 0;
+  uint8_t BestPhaseSegment2 = 0;
+
+  for (uint8_t TimeQuanta = 25; TimeQuanta >= 5; TimeQuanta--)
+  {
+    // Bitrate = ClockFrequency / (2 * BRP * TQ)
+    uint32_t Divider = 2UL * TimeQuanta * BaudRate;
+    uint32_t Prescaler = (ClockFrequency + (Divider / 2)) / Divider;
+
+    if ((Prescaler < 1) || (Prescaler > 64))
+    {
+      continue;
+    }
+
+    int32_t Error = (int32_t)(((uint64_t)ClockFrequency * 1000000ULL) / ((uint64_t)Divider * Prescaler)) - 1000000L;
+    uint32_t AbsError = (Error < 0) ? (uint32_t)(-Error) : (uint32_t)Error;
+
+    if (AbsError > _maxBitRateError)
+    {
+      continue;
+    }
+
+    // PHSEG2 according to the Sample-Point, min. 2 TQ (IPT), max. 8 TQ
+    uint8_t PhaseSegment2 = (uint8_t)(((uint16_t)TimeQuanta * (1000 - _samplePoint) + 500) / 1000);
+
+    if (PhaseSegment2 < 2)
+    {
+      PhaseSegment2 = 2;
+    }
+
+    // PRSEG + PHSEG1, max. 16 TQ
+    uint8_t Segment1 = TimeQuanta - 1 - PhaseSegment2;
+
+    if (Segment1 > 16)
+    {
+      PhaseSegment2 = PhaseSegment2 + (Segment1 - 16);
+      Segment1 = 16;
+    }
+
+    if ((PhaseSegment2 > 8) || (Segment1 < PhaseSegment2))
+    {
+      continue;
+    }
+
+    uint16_t ReachedSamplePoint = (uint16_t)(((uint16_t)(TimeQuanta - PhaseSegment2) * 1000) / TimeQuanta);
+    uint16_t SamplePointError = (ReachedSamplePoint > _samplePoint) ? (ReachedSamplePoint - _samplePoint) : (_samplePoint - ReachedSamplePoint);
+
+    if ((AbsError < BestError) ||
+        ((AbsError == BestError) && (SamplePointError < BestSamplePointError)))
+    {
+      BestError = AbsError;
+      BestSamplePointError = SamplePointError;
+      BestPrescaler = (uint8_t)Prescaler;
+      BestSegment1 = Segment1;
+      BestPhaseSegment2 = PhaseSegment2;
+      BitRateError = Error;
+      SamplePoint = ReachedSamplePoint;
     }
   }
 
-  if (cnf == NULL) {
+  if (BestPrescaler == 0)
+  {
     this->_lastMcpError = ERROR_MCP2515_CNF_NOT_FOUND;
     return false;
   }
 
+  uint8_t SyncJumpWidth = (BestPhaseSegment2 > 4) ? 4 : (BestPhaseSegment2 - 1);
+
+  // PHSEG1 at least SJW, the Rest is the Propagation-Segment
+  uint8_t PhaseSegment1 = BestSegment1 / 2;
+
+  if (PhaseSegment1 < SyncJumpWidth)
+  {
+    PhaseSegment1 = SyncJumpWidth;
+  }
+
+  uint8_t PropagationSegment = BestSegment1 - PhaseSegment1;
+
+  Cnf[0] = (uint8_t)(((SyncJumpWidth - 1) << 6) | ((BestPrescaler - 1) & CNF1_BIT_BRP));
+  Cnf[1] = (uint8_t)(CNF2_BIT_BTLMODE | ((PhaseSegment1 - 1) << 3) | ((PropagationSegment - 1) & CNF2_BIT_PRSEG));
+  Cnf[2] = (uint8_t)((BestPhaseSegment2 - 1) & CNF3_BIT_PHSEG2);
+
+  return true;
+}
+
+/**
+ * @brief Changing the Bit-Timing according to the Baudrate and ClockFrequency.
+ * @param targetBaudrate Baudrate (1E3 - 1000E3), the Bit-Timing is calculated with calculateBitTiming()
+ * @param targetClockFrequency ClockFrequency of the MCP2515 (1E6 - 40E6)
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::changeBitTiming(uint32_t targetBaudRate, uint32_t targetClockFrequency)
+{
+  uint8_t cnf[3];
+  int32_t BitRateError;
+  uint16_t SamplePoint;
+
+  if (!calculateBitTiming(targetBaudRate, targetClockFrequency, cnf, BitRateError, SamplePoint))
+  {
+    // Error will be set in calculateBitTiming()
+    return false;
+  }
+
+  if (!writeBitTiming(cnf))
+  {
+    // Error will be set in writeBitTiming()
+    return false;
+  }
+
+  this->_bitRateError = BitRateError;
+  this->_actualSamplePoint = SamplePoint;
+
+  return true;
+}
+
+/**
+ * @brief Writes the Bit-Timing (CNF1 - CNF3) in the Configuration-Mode and restores the previous Operation-Mode.
+ * @param cnf Values of CNF1, CNF2 and CNF3
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::writeBitTiming(const uint8_t cnf[3])
+{
+  uint8_t OperationMode = _operationMode;
+
   if (OperationMode != MCP2515_OP_CONFIGURATION)
   {
     if (!setConfigurationMode())
@@ -3588,14 +3952,69 @@ bool MCP2515::changeBitTiming(uint32_t targetBaudRate, uint32_t targetClockFrequ
     return false;
   }
 
-  if (!modifyConfigurationRegister3(0xC7, cnf[2]))
+  // SOF and WAKFIL are no Bit-Timing-Settings and stay as they are (see setClockOutput() and enterSleepMode())
+  if (!modifyConfigurationRegister3(CNF3_BIT_PHSEG2, cnf[2]))
   {
     this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CNF3_NOT_SET;
     return false;
   }
 
   delayMicroseconds(10);
+  MCP2515_COUNT_BUSY_WAIT(10);
+
+  return setOperationMode(OperationMode);
+}
+
+/**
+ * @brief Requests an Operation-Mode with one Bit-Modify of CANCTRL.REQOP and waits until CANSTAT.OPMOD shows the Operation-Mode.
+ *
+ * The Timeout is MCP2515_MODE_TRANSITION_TIMEOUT plus the Time of one Frame at the actual Baudrate.
+ * The measured Time of the Transition can be get with getLastModeTransitionTime().
+ * @note Doc p. 59; Kap. 10
+ * @param OperationMode MCP2515_OP_*
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::requestOperationMode(uint8_t OperationMode)
+{
+  uint32_t Start = micros();
+  uint32_t Timeout = MCP2515_MODE_TRANSITION_TIMEOUT + ((uint32_t)MCP2515_MAX_FRAME_BITS * 1000000UL) / _baudRate;
 
+  if (!bitModifyInstruction(REG_CANCTRL, CANCTRL_BIT_REQOP, (OperationMode << 5)))
+  {
+    this->_lastMcpError = ERROR_MCP2515_OPERATION_MODE_NOT_SET | _lastMcpError;
+    return false;
+  }
+
+  while (((getCanStatus() & CANSTAT_BIT_OPMOD) >> 5) != OperationMode)
+  {
+    if ((micros() - Start) > Timeout)
+    {
+      MCP2515_COUNT_BUSY_WAIT(micros() - Start);
+      this->_lastMcpError = ERROR_MCP2515_OPERATION_MODE_NOT_SET | ERROR_MCP2515_VALUE_NOT_SET;
+      return false;
+    }
+  }
+
+  this->_modeTransitionTime = micros() - Start;
+  MCP2515_COUNT_BUSY_WAIT(_modeTransitionTime);
+  this->_operationMode = OperationMode;
+
+  // Leaving the Sleep-Mode by a Request ends the Wait for a Wake-Up (see enterSleepMode())
+  if (OperationMode != MCP2515_OP_SLEEP)
+  {
+    this->_sleepPreviousMode = 0xFF;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Restores an Operation-Mode (e.g. after a Change in the Configuration-Mode).
+ * @param OperationMode MCP2515_OP_*
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setOperationMode(uint8_t OperationMode)
+{
   if (OperationMode != _operationMode)
   {
     switch (OperationMode)
@@ -3624,619 +4043,5030 @@ bool MCP2515::changeBitTiming(uint32_t targetBaudRate, uint32_t targetClockFrequ
   return true;
 }
 
-
-
-
-/***********************************************************************************************************************
- * 									Public Methods
- **********************************************************************************************************************/
-
-
 /**
- * @brief ClassConstructor
+ * @brief Restores the Operation-Mode after a failed Change in the Configuration-Mode.
+ *
+ * The last MCP-Error of the failed Change is kept (the Mode-Requests are public Calls which reset it).
+ * @param OperationMode MCP2515_OP_*
  */
-MCP2515::MCP2515() :
-  _spiSettings(MCP2515_MAX_SPI_SPEED, MCP2515_SPI_DATA_ORDER, MCP2515_SPI_MODE),
-  _csPin(0),
-  _spiMode(MCP2515_SPI_MODE),
-  _dataOrder(MCP2515_SPI_DATA_ORDER),
-  _spiFrequency(MCP2515_MAX_SPI_SPEED),
-  _clockFrequency(MCP2515_DEFAULT_CLOCK_FREQUENCY),
-  _operationMode(0xFF),
-  _baudRate(MCP2515_DEFAULT_BAUDRATE),
-  _isInitialized(false),
-  _lastMcpError(EMPTY_VALUE_16_BIT),
-  _reCheckEnabled(true)
+void MCP2515::restoreOperationMode(uint8_t OperationMode)
 {
-}
+  uint16_t LastMcpError = _lastMcpError;
 
-/**
- * @brief Deconstructor
- */
-MCP2515::~MCP2515()
-{
+  setOperationMode(OperationMode);
+
+  this->_lastMcpError = LastMcpError;
 }
 
 /**
- * @brief Returns the last MCP-Error.
+ * @brief Loads ID, DLC and Data of a Message with a single LOAD TX BUFFER-Instruction into the given TX-Buffer.
  *
- * The last MCP-Error will always been reset at the beginning of a Method.
- * @return uint16_t MCP-Error
+ * In contrast to fillTransmitBuffer() no single Register is written or rechecked.
  *
- * 0x0000 = no Error
+ * The TXnIF-Flag of the Buffer will be reset (Buffer is marked as occupied).
+ * @param BufferNumber 0 - 2
+ * @param ID Message-ID
+ * @param Extended bool true if it is a Extended Frame
+ * @param RTR bool true if it is a Remote Transmit request Message
+ * @param DLC Data Length Code of the Message
+ * @param Data 8-Byte Data-Array (in total)
+ * @return true when success, false on any error (Check _lastMcpError)
  */
-uint16_t MCP2515::getLastMCPError()
+bool MCP2515::loadTransmitBuffer(uint8_t BufferNumber, uint32_t ID, bool Extended, bool RTR, uint8_t DLC, const uint8_t Data[8])
 {
-	return _lastMcpError;
-}
-
-/**
- * @brief Set the ReCheck-Enabler.
- *
- * When it's enabled, after Setting some bit it will check if the bit is set successfully.
- * @param reCheckEnabler bool
- * @return bool true when success, false on any error
- */
-bool MCP2515::setReCheckEnabler(bool reCheckEnabler)
-{
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
-
-  if (!_isInitialized)
+  if ((BufferNumber > 2) ||
+      (ID > 0x1FFFFFFF) ||
+      (!Extended && ID > 0x7FF) ||
+      (DLC > 8))
   {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
     return false;
   }
 
-  if (reCheckEnabler != true && reCheckEnabler != false)
+  // SIDH, SIDL, EID8, EID0, DLC, D0 - D7
+  uint8_t Values[13];
+
+  if (Extended)
   {
-    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
-    return false;
+    Values[0] = (uint8_t)(ID >> 21);
+    Values[1] = (uint8_t)((((ID >> 18) & 0x07) << 5) | TXBnSIDL_BIT_EXIDE | ((ID >> 16) & TXBnSIDL_BIT_EID));
+    Values[2] = (uint8_t)(ID >> 8);
+    Values[3] = (uint8_t)(ID);
+  } else {
+    Values[0] = (uint8_t)(ID >> 3);
+    Values[1] = (uint8_t)((ID & 0x07) << 5);
+    Values[2] = 0x00;
+    Values[3] = 0x00;
   }
 
-  this->_reCheckEnabled = reCheckEnabler;
+  Values[4] = DLC | (RTR ? TXBnDLC_BIT_RTR : 0x00);
 
-  return true;
-}
+  uint8_t Length = 5;
 
-/**
- * @brief Set the CS (ChipSelect) Pin.
- * @note Use this Method only before the Initialisation of the MCP2515.
- * @param cs ChipSelect-Pin
- * @return true when success, false on any error
- */
-bool MCP2515::setSpiPins(uint8_t cs)
-{
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  if (!RTR)
+  {
+    for (uint8_t i = 0; i < DLC; i++)
+    {
+      Values[Length++] = Data[i];
+    }
+  }
 
-  if (_isInitialized)
+  if (!loadTxBufferInstruction(Values, Length, (BufferNumber == 2), (BufferNumber == 1), false))
   {
-    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
+#ifdef MCP2515_ENABLE_BUS_LOAD
+    this->_transmitFrameBits[BufferNumber] = 0;
+#endif
     return false;
   }
 
-  this->_csPin = cs;
+#ifdef MCP2515_ENABLE_BUS_LOAD
+  // on-wire Length for the Bus-Load (see addTransmittedBuffer())
+  MCP2515Frame Frame = {ID, Extended, RTR, DLC, {0}};
 
-  return true;
+  for (uint8_t i = 5; i < Length; i++)
+  {
+    Frame.data[i - 5] = Values[i];
+  }
+
+  this->_transmitFrameBits[BufferNumber] = (uint8_t)getFrameBitLength(Frame, _transmitStuffBits[BufferNumber]);
+#endif
+  MCP2515_LATENCY_TX_ENQUEUED(BufferNumber, micros());
+
+  // Mark the Buffer as occupied (see fillTransmitBuffer())
+  return bitModifyInstruction(REG_CANINTF, CANINTF_BIT_TXnIF(BufferNumber), 0x00);
 }
 
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
 /**
- * @brief Setting the SPI-Mode.
- * @note Use this Method only before the Initialisation of the MCP2515.
- * @param SpiMode Allowed Values for the MCP2515 are SPI_MODE0 and SPI_MODE3.
- * @return true when success, false on any error
+ * @brief Fills the Token-Bucket of a Rate-Limit for the elapsed Time.
+ * @param Limit Rate-Limit
+ * @param Now actual Time (micros())
  */
-bool MCP2515::setSpiMode(uint8_t SpiMode)
+void MCP2515::refillRateLimit(MCP2515RateLimit &Limit, uint32_t Now)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  uint32_t Elapsed = Now - Limit.lastUpdate;
+  Limit.lastUpdate = Now;
 
-  if (_isInitialized)
-  {
-    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
-    return false;
-  }
+  // Tokens in 1/1000 Bit: Rate ‰ of the Baudrate in Bit/s = Bit/ms
+  int64_t Tokens = (int64_t)Limit.tokens + ((uint64_t)Elapsed * ((uint64_t)_baudRate * Limit.rate / 1000)) / 1000;
+  int64_t Max = (int64_t)Limit.burst * 1000;
 
-  if (SpiMode != SPI_MODE0 && SpiMode != SPI_MODE3)
+  Limit.tokens = (int32_t)((Tokens > Max) ? Max : Tokens);
+}
+
+/**
+ * @brief Searches the Rate-Limit of a Frame.
+ * @param Frame Frame
+ * @return first matching Rate-Limit, NULL when the Frame has no Rate-Limit
+ */
+MCP2515RateLimit *MCP2515::findRateLimit(const MCP2515Frame &Frame)
+{
+  for (uint8_t i = 0; i < MCP2515_MAX_RATE_LIMITS; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_SPI_MODE_NOT_ALLOWED;
-    return false;
+    if ((_rateLimits[i].rate > 0) &&
+        (_rateLimits[i].extended == Frame.extended) &&
+        (Frame.id >= _rateLimits[i].idFrom) &&
+        (Frame.id <= _rateLimits[i].idTo))
+    {
+      return &_rateLimits[i];
+    }
   }
 
-  this->_spiMode = SpiMode;
-  SPISettings _spiSettings(_spiFrequency, _dataOrder, SpiMode);
+  return NULL;
+}
+#endif
 
-  return true;
+/**
+ * @brief Appends Bits (MSB first) to the Bit-Stream of a Frame.
+ * @param Stream Bit-Stream (initialized with 0, 2 Bytes more than the used Bytes)
+ * @param Position Number of Bits in the Bit-Stream
+ * @param Value Bits
+ * @param Count Number of Bits (1 - 16)
+ */
+void MCP2515::appendFrameBits(uint8_t Stream[], uint8_t &Position, uint16_t Value, uint8_t Count)
+{
+  uint8_t Index = Position >> 3;
+  uint32_t Bits = (uint32_t)(Value & (0xFFFF >> (16 - Count))) << (24 - Count - (Position & 0x07));
+
+  Stream[Index] = Stream[Index] | (uint8_t)(Bits >> 16);
+  Stream[Index + 1] = Stream[Index + 1] | (uint8_t)(Bits >> 8);
+  Stream[Index + 2] = Stream[Index + 2] | (uint8_t)Bits;
+  Position = Position + Count;
 }
 
 /**
- * @brief Set the DataOrder.
- * @note Use this Method only before the Initialisation of the MCP2515.
- * @param DataOrder Allowed Value for the MCP2515 is MSBFIRST.
- * @return true when success, false on any error
+ * @brief Calculates the on-wire Length of a Frame (the Frame is not checked).
+ *
+ * The Bits from SOF till the end of the Data-Field are packed into a Bit-Stream. The CRC-15 and the Stuff-Bits
+ * are calculated with Tables one Nibble at a time, so it is fast enough for every transmitted and received Frame.
+ * @param Frame Frame (DLC 0 - 15, max. 8 Data-Bytes are transmitted)
+ * @param StuffBits Number of Stuff-Bits of the Frame
+ * @return Length in Bits incl. CRC-Delimiter, ACK, EOF and Interframe-Space
  */
-bool MCP2515::setDataOrder(uint8_t DataOrder)
+uint16_t MCP2515::getFrameBitLength(const MCP2515Frame &Frame, uint8_t &StuffBits)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  // SOF till CRC are max. 118 Bits
+  uint8_t Stream[17] = {0};
+  uint8_t Position = 0;
+  uint8_t DataLength = Frame.rtr ? 0 : ((Frame.dlc > 8) ? 8 : Frame.dlc);
+  uint16_t Control = ((Frame.rtr ? 1 : 0) << 6) | (Frame.dlc & 0x0F);
+
+  if (Frame.extended)
+  {
+    // SOF, Base-ID; SRR, IDE, Extended-ID[17:9]; Extended-ID[8:0], RTR, r1, r0, DLC
+    appendFrameBits(Stream, Position, ((Frame.id >> 18) & 0x7FF), 12);
+    appendFrameBits(Stream, Position, (0x600 | ((Frame.id >> 9) & 0x1FF)), 11);
+    appendFrameBits(Stream, Position, (((Frame.id & 0x1FF) << 7) | Control), 16);
+  } else {
+    // SOF, ID; RTR, IDE, r0, DLC
+    appendFrameBits(Stream, Position, (Frame.id & 0x7FF), 12);
+    appendFrameBits(Stream, Position, Control, 7);
+  }
 
-  if (_isInitialized)
+  for (uint8_t i = 0; i < DataLength; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
-    return false;
+    appendFrameBits(Stream, Position, Frame.data[i], 8);
   }
 
-  if (DataOrder != MSBFIRST)
+  // CRC-15 of SOF till the end of the Data-Field
+  uint16_t Crc = 0;
+  uint8_t Nibbles = Position >> 2;
+
+  for (uint8_t i = 0; i < Nibbles; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_DATA_ORDER_NOT_ALLOWED;
-    return false;
+    uint8_t Nibble = (i & 0x01) ? (Stream[i >> 1] & 0x0F) : (Stream[i >> 1] >> 4);
+    Crc = ((Crc << 4) ^ pgm_read_word(&FrameCrcTable[((Crc >> 11) ^ Nibble) & 0x0F])) & 0x7FFF;
   }
 
-  this->_dataOrder = DataOrder;
-  SPISettings _spiSettings(_spiFrequency, DataOrder, _spiMode);
+  for (uint8_t i = (Nibbles << 2); i < Position; i++)
+  {
+    uint8_t Next = ((Stream[i >> 3] >> (7 - (i & 0x07))) ^ (Crc >> 14)) & 0x01;
+    Crc = (Crc << 1) & 0x7FFF;
 
-  return true;
-}
+    if (Next)
+    {
+      Crc = Crc ^ 0x4599;
+    }
+  }
 
-/**
- * @brief Set the SPI-Clock-Frequency.
- * @note Use this Method only before the Initialisation of the MCP2515.
- * @param Frequency max. allowed Value for the MCP2515 is 10e6 Hz.
- * @return true when success, false on any error
- */
-bool MCP2515::setSpiFrequency(uint32_t Frequency)
-{
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  // The CRC-Sequence is also stuffed
+  appendFrameBits(Stream, Position, Crc, 15);
 
-  if (_isInitialized)
+  // The Bus is recessive before the SOF, so the SOF starts a new Run
+  uint8_t State = 0x04;
+  Nibbles = Position >> 2;
+  StuffBits = 0;
+
+  for (uint8_t i = 0; i < Nibbles; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
-    return false;
+    uint8_t Nibble = (i & 0x01) ? (Stream[i >> 1] & 0x0F) : (Stream[i >> 1] >> 4);
+    State = pgm_read_byte(&FrameStuffTable[(State << 4) | Nibble]);
+    StuffBits = StuffBits + (State >> 3);
+    State = State & 0x07;
   }
 
-  if (((uint32_t)Frequency > (uint32_t)MCP2515_MAX_SPI_SPEED) ||
-      ((uint32_t)Frequency < (uint32_t)1e6))
+  uint8_t LastBit = State >> 2;
+  uint8_t Run = (State & 0x03) + 1;
+
+  for (uint8_t i = (Nibbles << 2); i < Position; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_SPI_FREQUENCY_NOT_ALLOWED;
-    return false;
-  }
+    uint8_t Bit = (Stream[i >> 3] >> (7 - (i & 0x07))) & 0x01;
 
-  this->_spiFrequency = Frequency;
-  SPISettings _spiSettings(Frequency, _dataOrder, _spiMode);
+    if (Bit == LastBit)
+    {
+      Run++;
+    } else {
+      Run = 1;
+      LastBit = Bit;
+    }
 
-  return true;
+    // After 5 equal Bits a complementary Stuff-Bit is inserted
+    if (Run == 5)
+    {
+      StuffBits++;
+      LastBit = !Bit;
+      Run = 1;
+    }
+  }
+
+  // CRC-Delimiter (1), ACK-Slot and -Delimiter (2), EOF (7), Interframe-Space (3)
+  return Position + StuffBits + 13;
 }
 
+#ifdef MCP2515_ENABLE_BUS_LOAD
 /**
- * @brief Set the MCP2515 Clock-Frequency.
- * @note Use this Method only before the Initialisation of the MCP2515.
- * @param ClockFrequency allowed Values are 8MHz, 16MHz, 25MHz or 40MHz.
- * @return true when success, false on any error
+ * @brief Moves the sliding Window of the Bus-Load to the given Time.
+ * @param Now micros()
  */
-bool MCP2515::setClockFrequency(uint32_t ClockFrequency)
+void MCP2515::updateBusLoad(uint32_t Now)
 {
-  if (_isInitialized)
-  {
-    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
-    return false;
-  }
+  uint32_t Elapsed = Now - _busLoadSlotStart;
 
-  if (ClockFrequency != 8E6 && ClockFrequency != 16E6 && ClockFrequency != 25E6 && ClockFrequency != 40E6)
+  // Nothing happened within the whole Window
+  if (Elapsed >= ((uint32_t)MCP2515_BUS_LOAD_SLOTS * MCP2515_BUS_LOAD_SLOT_TIME))
   {
-    this->_lastMcpError = ERROR_MCP2515_CLOCKFREQUENCY_NOT_VALID;
-    return false;
+    for (uint8_t i = 0; i < MCP2515_BUS_LOAD_SLOTS; i++)
+    {
+      this->_busLoadBits[i] = 0;
+    }
+
+    this->_busLoadSlotStart = Now;
+    this->_busLoadSlotCount = MCP2515_BUS_LOAD_SLOTS - 1;
+    return;
   }
 
-  this->_clockFrequency = ClockFrequency;
+  while (Elapsed >= MCP2515_BUS_LOAD_SLOT_TIME)
+  {
+    this->_busLoadSlot = (_busLoadSlot + 1) % MCP2515_BUS_LOAD_SLOTS;
+    this->_busLoadBits[_busLoadSlot] = 0;
+    this->_busLoadSlotStart += MCP2515_BUS_LOAD_SLOT_TIME;
+    Elapsed -= MCP2515_BUS_LOAD_SLOT_TIME;
 
-  return true;
+    if (_busLoadSlotCount < (MCP2515_BUS_LOAD_SLOTS - 1))
+    {
+      this->_busLoadSlotCount++;
+    }
+  }
 }
 
 /**
- * @brief Set the MCP2515 in the Configuration-Mode.
- * @note Doc p. 59; Kap. 10.1
- * @return true when success, false on any error (Check _lastMcpError)
+ * @brief Adds a transmitted or received Frame to the Bus-Load.
+ * @param Bits on-wire Length of the Frame
+ * @param StuffBits Stuff-Bits of the Frame
+ * @param Transmitted true = transmitted Frame, false = received Frame
  */
-bool MCP2515::setConfigurationMode()
+void MCP2515::addBusLoad(uint16_t Bits, uint8_t StuffBits, bool Transmitted)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
-
-  if (!_isInitialized)
-  {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
-  }
+  updateBusLoad(micros());
 
-  int8_t counter = 100;
+  this->_busLoadBits[_busLoadSlot] += Bits;
+  this->_busLoadStatistic.stuffBits += StuffBits;
 
-  while (!modifyCanControl(CANCTRL_BIT_REQOP, (MCP2515_OP_CONFIGURATION << 5)) && counter > 0)
+  if (Transmitted)
   {
-    counter--;
-    delayMicroseconds(10);
+    this->_busLoadStatistic.transmittedFrames++;
+    this->_busLoadStatistic.transmittedBits += Bits;
+  } else {
+    this->_busLoadStatistic.receivedFrames++;
+    this->_busLoadStatistic.receivedBits += Bits;
   }
+}
 
-  if (counter <= 0)
+/**
+ * @brief Adds the Frame of a successful transmitted TX-Buffer to the Bus-Load.
+ *
+ * The Length is calculated when the TX-Buffer is filled (see fillTransmitBuffer() and loadTransmitBuffer()).
+ * @param BufferNumber 0 - 2
+ */
+void MCP2515::addTransmittedBuffer(uint8_t BufferNumber)
+{
+  if (_transmitFrameBits[BufferNumber] != 0)
   {
-    this->_lastMcpError = ERROR_MCP2515_OPERATION_MODE_NOT_SET | _lastMcpError;
-    return false;
+    addBusLoad(_transmitFrameBits[BufferNumber], _transmitStuffBits[BufferNumber], true);
   }
+}
+#endif
 
-  this->_operationMode = MCP2515_OP_CONFIGURATION;
-  return true;
+/**
+ * @brief Writes a Filter (SIDH, SIDL, EID8 and EID0).
+ * @param FilterNumber 0 - 5
+ * @param Value Filter in the Register-Layout (Bit 28 - 18 = Standard-ID, Bit 17 - 0 = Extended-ID[17:0])
+ * @param Extended true = Filter is applied only to Extended Frames
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::writeFilter(uint8_t FilterNumber, uint32_t Value, bool Extended)
+{
+  return setFilterStandardIdentifierHigh(FilterNumber, (uint8_t)(Value >> 21)) &&
+         setFilterStandardIdentifierLow(FilterNumber, (uint8_t)((Value >> 18) & 0x07), Extended, (uint8_t)((Value >> 16) & 0x03)) &&
+         setFilterExtendedIdentifierHigh(FilterNumber, (uint8_t)(Value >> 8)) &&
+         setFilterExtendedIdentifierLow(FilterNumber, (uint8_t)Value);
 }
 
 /**
- * @brief Set the MCP2515 in the Normal-Mode.
- * @note Doc p. 60; Kap. 10.5
+ * @brief Writes a Mask (SIDH, SIDL, EID8 and EID0).
+ * @param MaskNumber 0 - 1
+ * @param Value Mask in the Register-Layout (Bit 28 - 18 = Standard-ID, Bit 17 - 0 = Extended-ID[17:0])
  * @return true when success, false on any error (Check _lastMcpError)
  */
-bool MCP2515::setNormalMode()
+bool MCP2515::writeMask(uint8_t MaskNumber, uint32_t Value)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  return setMaskStandardIdentifierHigh(MaskNumber, (uint8_t)(Value >> 21)) &&
+         setMaskStandardIdentifierLow(MaskNumber, (uint8_t)((Value >> 18) & 0x07), (uint8_t)((Value >> 16) & 0x03)) &&
+         setMaskExtendedIdentifierHigh(MaskNumber, (uint8_t)(Value >> 8)) &&
+         setMaskExtendedIdentifierLow(MaskNumber, (uint8_t)Value);
+}
 
-  if (!_isInitialized)
+/**
+ * @brief Converts Masks and Filters into the Register-Values (Filter 0 - 5, Mask 0 - 1 with SIDH, SIDL, EID8 and EID0 each).
+ * @param Config Masks and Filters
+ * @param Registers Register-Values (see getFilterRegisterAddress())
+ */
+void MCP2515::encodeFilters(const MCP2515FilterConfig &Config, uint8_t Registers[MCP2515_FILTER_REGISTERS])
+{
+  for (uint8_t i = 0; i < 8; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
-  }
-
-  int8_t counter = 100;
+    uint32_t Value = (i < 6) ? Config.filters[i] : Config.masks[i - 6];
+    bool Extended = (i < 6) ? Config.extended[i] : false;
 
-  while (!modifyCanControl(CANCTRL_BIT_REQOP, (MCP2515_OP_NORMAL << 5)) && counter > 0)
-  {
-    counter--;
-    delayMicroseconds(10);
+    Registers[i * 4] = (uint8_t)(Value >> 21);
+    Registers[i * 4 + 1] = (uint8_t)((((Value >> 18) & 0x07) << 5) | (Extended ? RXFnSIDL_BIT_EXIDE : 0x00) | ((Value >> 16) & 0x03));
+    Registers[i * 4 + 2] = (uint8_t)(Value >> 8);
+    Registers[i * 4 + 3] = (uint8_t)Value;
   }
+}
 
-  if (counter <= 0)
+/**
+ * @brief Returns the Register-Address of an Index in the Register-Values of encodeFilters().
+ * @param Index 0 - 23 = Filter 0 - 5, 24 - 31 = Mask 0 - 1
+ * @return Register-Address
+ */
+uint8_t MCP2515::getFilterRegisterAddress(uint8_t Index)
+{
+  if (Index < 24)
   {
-    this->_lastMcpError = ERROR_MCP2515_OPERATION_MODE_NOT_SET | _lastMcpError;
-    return false;
+    return REG_RXFnSIDH(Index / 4) + (Index % 4);
   }
 
-  this->_operationMode = MCP2515_OP_NORMAL;
-  return true;
+  return REG_RXMnSIDH((Index - 24) / 4) + (Index % 4);
 }
 
 /**
- * @brief Set the MCP2515 in the Sleep-Mode.
- * @note Doc p. 59; Kap. 10.2
- * @return true when success, false on any error (Check _lastMcpError)
+ * @brief Returns the Index in the Register-Values of encodeFilters() of a Register-Address.
+ * @param Address Register-Address
+ * @return 0 - 31, 0xFF when the Register is no Mask- or Filter-Register
  */
-bool MCP2515::setSleepMode()
+uint8_t MCP2515::getFilterRegisterIndex(uint8_t Address)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
-
-  if (!_isInitialized)
+  if (Address <= 0x0B)
   {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
+    return Address;
   }
 
-  int8_t counter = 100;
-
-  while (!modifyCanControl(CANCTRL_BIT_REQOP, (MCP2515_OP_SLEEP << 5)) && counter > 0)
+  if ((Address >= 0x10) && (Address <= 0x1B))
   {
-    counter--;
-    delayMicroseconds(10);
+    return Address - 0x04;
   }
 
-  if (counter <= 0)
+  if ((Address >= 0x20) && (Address <= 0x27))
   {
-    this->_lastMcpError = ERROR_MCP2515_OPERATION_MODE_NOT_SET | _lastMcpError;
-    return false;
+    return Address - 0x08;
   }
 
-  this->_operationMode = MCP2515_OP_SLEEP;
-  return true;
+  return 0xFF;
 }
 
 /**
- * @brief Set the MCP2515 in the Listen-Only-Mode.
- * @note Doc p. 59; Kap. 10.3
- * @return true when success, false on any error (Check _lastMcpError)
+ * @brief Returns the Index of a Register in the Register-Cache.
+ * @param Address Register-Address
+ * @return 0 - (MCP2515_CACHED_REGISTERS - 1), 0xFF when the Register is not cached
  */
-bool MCP2515::setListenOnlyMode()
+uint8_t MCP2515::getCachedRegisterIndex(uint8_t Address)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
-
-  if (!_isInitialized)
+  for (uint8_t i = 0; i < MCP2515_CACHED_REGISTERS; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
+    if (CachedRegisterAddress[i] == Address)
+    {
+      return i;
+    }
   }
 
-  int8_t counter = 100;
-
-  while (!modifyCanControl(CANCTRL_BIT_REQOP, (MCP2515_OP_LISTEN << 5)) && counter > 0)
-  {
-    counter--;
-    delayMicroseconds(10);
-  }
+  return 0xFF;
+}
 
-  if (counter <= 0)
+/**
+ * @brief Loads the Values after the Reset of the MCP2515 into the Register-Cache.
+ */
+void MCP2515::resetRegisterCache()
+{
+  for (uint8_t i = 0; i < MCP2515_CACHED_REGISTERS; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_OPERATION_MODE_NOT_SET | _lastMcpError;
-    return false;
+    this->_registerCache[i] = CachedRegisterReset[i];
   }
 
-  this->_operationMode = MCP2515_OP_LISTEN;
-  return true;
+  this->_registerCacheValid = _registerCacheEnabled ? ((1 << MCP2515_CACHED_REGISTERS) - 1) : 0;
 }
 
 /**
- * @brief Set the MCP2515 in the Loopback-Mode.
- * @note Doc p. 60; Kap. 10.4
- * @return true when success, false on any error (Check _lastMcpError)
+ * @brief Counts the IDs which pass at least one of the Filters (Inclusion-Exclusion over all Combinations of Filters).
+ * @param Care compared Bits of each Filter
+ * @param Value Value of the compared Bits of each Filter
+ * @param Count Number of Filters (max. 6)
+ * @param Bits Number of ID-Bits (11 or 29)
+ * @return Number of accepted IDs
  */
-bool MCP2515::setLoopbackMode()
+uint32_t MCP2515::countFilterMatches(const uint32_t Care[], const uint32_t Value[], uint8_t Count, uint8_t Bits)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  // The Sum is exact modulo 2^32 and the Result is below 2^32, so no 64-Bit-Arithmetic is needed
+  uint32_t Matches = 0;
 
-  if (!_isInitialized)
+  for (uint8_t Combination = 1; Combination < (1 << Count); Combination++)
   {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
-  }
+    uint32_t CommonCare = 0;
+    uint32_t CommonValue = 0;
+    bool Possible = true;
 
-  int8_t counter = 100;
+    for (uint8_t f = 0; f < Count; f++)
+    {
+      if (Combination & (1 << f))
+      {
+        Possible = Possible && (((CommonValue ^ Value[f]) & CommonCare & Care[f]) == 0);
+        CommonCare = CommonCare | Care[f];
+        CommonValue = CommonValue | Value[f];
+      }
+    }
 
-  while (!modifyCanControl(CANCTRL_BIT_REQOP, (MCP2515_OP_LOOPBACK << 5)) && counter > 0)
-  {
-    counter--;
-    delayMicroseconds(10);
+    if (Possible)
+    {
+      uint32_t Size = 1UL << (Bits - __builtin_popcountl(CommonCare));
+      Matches = (__builtin_popcount(Combination) & 0x01) ? (Matches + Size) : (Matches - Size);
+    }
   }
 
-  if (counter <= 0)
-  {
-    this->_lastMcpError = ERROR_MCP2515_OPERATION_MODE_NOT_SET | _lastMcpError;
-    return false;
-  }
+  return Matches;
+}
 
-  this->_operationMode = MCP2515_OP_LOOPBACK;
-  return true;
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+/**
+ * @brief Checks if two Entries of the Transmit-Queue have the same ID.
+ * @param SlotA Entry A
+ * @param SlotB Entry B
+ * @return true when the ID (and Frame-Type) is equal
+ */
+bool MCP2515::txQueueSameId(uint8_t SlotA, uint8_t SlotB)
+{
+  return (_txQueue[SlotA].frame.id == _txQueue[SlotB].frame.id) &&
+         (_txQueue[SlotA].frame.extended == _txQueue[SlotB].frame.extended);
 }
 
 /**
- * @brief Initialize the MCP2515.
- *
- * - Reset the MCP2515
+ * @brief Updates the Head (oldest queued Entry, it has to be transmitted first) of all queued Entries with the ID of Slot.
  *
- * - Set the BitTiming for the given BaudRate
- *
- * - Setting the PinControl for RX-Pins and TX-Pins
- *
- * - Enable Receive-Interrupts
- *
- * - Disable Mask and Filter-Settings
- *
- * - Set the OperationMode Normal
- * @param BaudRate Baudrate of the CAN-Communication
- * @param reCheckEnabled bool true if after Set-Processes a recheck of setted Values has to be execute
- * @return true when success, false on any error (Check _lastMcpError)
+ * Has to be called whenever an Entry with this ID enters or leaves the State MCP2515_QUEUE_ENTRY_QUEUED,
+ * so processTransmitQueue() does not have to search the Head of each Entry.
+ * @param Slot Entry with the ID (its own State does not matter)
  */
-bool MCP2515::init(uint32_t BaudRate, bool reCheckEnabled)
+void MCP2515::txQueueUpdateHead(uint8_t Slot)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  uint8_t Head = 0xFF;
 
-  if (_isInitialized)
+  for (uint8_t i = 0; i < MCP2515_TX_QUEUE_SIZE; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
-    return false;
+    if ((_txQueue[i].state == MCP2515_QUEUE_ENTRY_QUEUED) && txQueueSameId(i, Slot) &&
+        ((Head == 0xFF) || ((int16_t)(_txQueue[i].sequence - _txQueue[Head].sequence) < 0)))
+    {
+      Head = i;
+    }
   }
 
-  this->_reCheckEnabled = reCheckEnabled;
+  for (uint8_t i = 0; i < MCP2515_TX_QUEUE_SIZE; i++)
+  {
+    if ((_txQueue[i].state == MCP2515_QUEUE_ENTRY_QUEUED) && txQueueSameId(i, Slot))
+    {
+      this->_txQueue[i].head = Head;
+    }
+  }
+}
 
-  if (_csPin == 0)
+/**
+ * @brief Checks if the Entry A of the Transmit-Queue has to be transmitted before Entry B.
+ * @param SlotA Entry A
+ * @param SlotB Entry B
+ * @param HasDeadline Entry B has a Deadline
+ * @param Deadline Deadline of Entry B
+ * @return true when Entry A has the same ID or an earlier (or equal) Deadline
+ */
+bool MCP2515::txQueueMustPrecede(uint8_t SlotA, uint8_t SlotB, bool HasDeadline, uint32_t Deadline)
+{
+  if (txQueueSameId(SlotA, SlotB))
   {
-    this->_lastMcpError = ERROR_MCP2515_INIT_CS_PIN_NOT_DEFINED;
-    return false;
+    return true;
   }
 
-  pinMode(_csPin, OUTPUT);
-  this->_isInitialized = true;
+  return _txQueue[SlotA].hasDeadline && (!HasDeadline || ((int32_t)(_txQueue[SlotA].deadline - Deadline) <= 0));
+}
 
-  // start SPI
-  SPI.begin();
+/**
+ * @brief Raises the Priorities (TXP) of the pending Frames of the Transmit-Queue to the highest Levels, their Order is kept.
+ *
+ * A loaded Frame gets a Priority below the pending Frames which have to be transmitted before it, so without raising them
+ * the free Levels run out after a few Frames and the TX-Buffers would have to drain before the next Frame is loaded.
+ * The Priorities are written from the highest to the lowest, so the Order is also kept between the Writes
+ * (the Priority of a Frame which is already on the Bus does not matter).
+ * @return true when at least one Priority is raised
+ */
+bool MCP2515::txQueueRaisePriorities()
+{
+  bool Raised = false;
+  uint8_t Done = 0x00;
+  uint8_t Limit = 12;
 
-  // Reset the MCP2515
-  if (!resetInstruction()) {
-    this->_isInitialized = false;
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_RESET_FAILED;
-    return false;
-  }
+  while (true)
+  {
+    // The pending Frame with the highest Priority (TXP * 3 + Buffer-Number) which is not raised yet
+    uint8_t Highest = 0xFF;
 
-  // Change the Bit-Timing
-  if (!changeBaudRate(BaudRate)) {
-    this->_isInitialized = false;
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_CHANGE_BITTIMING;
-    return false;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      if ((_txQueueInFlight & (1 << i)) && !(Done & (1 << i)) &&
+          ((Highest == 0xFF) || ((_txQueuePriority[i] * 3 + i) > (_txQueuePriority[Highest] * 3 + Highest))))
+      {
+        Highest = i;
+      }
+    }
+
+    if (Highest == 0xFF)
+    {
+      break;
+    }
+
+    // With at most three Frames the Limit always stays above the Buffer-Number and the Priority is never lowered
+    uint8_t TXP = ((Limit - 1 - Highest) / 3 > 3) ? 3 : (Limit - 1 - Highest) / 3;
+
+    if (TXP != _txQueuePriority[Highest])
+    {
+      bitModifyInstruction(REG_TXBnCTRL(Highest), TXBnCTRL_BIT_TXP, TXP);
+      this->_txQueuePriority[Highest] = TXP;
+      Raised = true;
+    }
+
+    Done = Done | (1 << Highest);
+    Limit = TXP * 3 + Highest;
   }
 
-  // Set TXnRTS-Pin to Digital Input
-  if (!modifyTXnRTSPinControl(TXRTSCTRL_BIT_BnRTSM(0) | TXRTSCTRL_BIT_BnRTSM(1) | TXRTSCTRL_BIT_BnRTSM(2), 0x00))
+  return Raised;
+}
+#endif
+
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+/**
+ * @brief Compares two Entries of the Cyclic-Heap.
+ * @param HeapPositionA Position in the Heap
+ * @param HeapPositionB Position in the Heap
+ * @return true if the Message at Position A has to be released before the Message at Position B
+ */
+bool MCP2515::cyclicHeapBefore(uint8_t HeapPositionA, uint8_t HeapPositionB)
+{
+  // The difference is evaluated signed, so the overflow of micros() is handled.
+  return (int32_t)(_cyclicMessages[_cyclicHeap[HeapPositionA]].nextRelease - _cyclicMessages[_cyclicHeap[HeapPositionB]].nextRelease) < 0;
+}
+
+/**
+ * @brief Moves the given Heap-Entry up until the Heap-Condition is fulfilled.
+ * @param HeapPosition Position in the Heap
+ */
+void MCP2515::cyclicHeapSiftUp(uint8_t HeapPosition)
+{
+  while (HeapPosition > 0)
   {
-    this->_isInitialized = false;
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_TX_PIN_CONTROL;
-    return false;
+    uint8_t Parent = (HeapPosition - 1) / 2;
+
+    if (!cyclicHeapBefore(HeapPosition, Parent))
+    {
+      break;
+    }
+
+    uint8_t Temp = _cyclicHeap[Parent];
+    this->_cyclicHeap[Parent] = _cyclicHeap[HeapPosition];
+    this->_cyclicHeap[HeapPosition] = Temp;
+    HeapPosition = Parent;
   }
+}
 
-  // Disable the RXnBF-Pins
-  if (!modifyRXnBFPinControl(BFPCTRL_BIT_BnBFE(0) | BFPCTRL_BIT_BnBFE(1), 0x00))
+/**
+ * @brief Moves the given Heap-Entry down until the Heap-Condition is fulfilled.
+ * @param HeapPosition Position in the Heap
+ */
+void MCP2515::cyclicHeapSiftDown(uint8_t HeapPosition)
+{
+  while (true)
   {
-    this->_isInitialized = false;
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_RX_PIN_CONTROL;
-    return false;
+    uint8_t Smallest = HeapPosition;
+    uint8_t Left = 2 * HeapPosition + 1;
+    uint8_t Right = Left + 1;
+
+    if (Left < _cyclicHeapSize && cyclicHeapBefore(Left, Smallest))
+    {
+      Smallest = Left;
+    }
+
+    if (Right < _cyclicHeapSize && cyclicHeapBefore(Right, Smallest))
+    {
+      Smallest = Right;
+    }
+
+    if (Smallest == HeapPosition)
+    {
+      break;
+    }
+
+    uint8_t Temp = _cyclicHeap[Smallest];
+    this->_cyclicHeap[Smallest] = _cyclicHeap[HeapPosition];
+    this->_cyclicHeap[HeapPosition] = Temp;
+    HeapPosition = Smallest;
   }
+}
 
-  // Disable all Interrupts
-  if (!setCanInterruptEnable(false, false, false, false, false, false, false, false))
+/**
+ * @brief Moves the Epoch of the Scheduler forward before the µs-Difference to it overflows.
+ *
+ * The Epoch is moved in Steps of MCP2515_CYCLIC_EPOCH_STEP, the Steps are counted, so the Phase to the
+ * original Epoch stays exact (see addCyclicMessage()).
+ * @param Now micros()
+ */
+void MCP2515::updateCyclicEpoch(uint32_t Now)
+{
+  while ((Now - _cyclicEpoch) >= MCP2515_CYCLIC_EPOCH_STEP)
   {
-    this->_isInitialized = false;
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_SET_INTERRUPTS;
-    return false;
+    this->_cyclicEpoch += MCP2515_CYCLIC_EPOCH_STEP;
+    this->_cyclicEpochSteps++;
   }
+}
+#endif
 
-  // Set the TX-Buffer empty Flags
-  if (!modifyCanInterruptFlag(0x1C, 0x1C))
+
+
+/***********************************************************************************************************************
+ * 									Public Methods
+ **********************************************************************************************************************/
+
+
+// Only the Layout of this Build is defined (see MCP2515LayoutCheck)
+template <size_t Size, uint8_t Features>
+const uint8_t MCP2515LayoutCheck<Size, Features>::value = 0;
+
+template struct MCP2515LayoutCheck<sizeof(MCP2515), MCP2515_FEATURES>;
+
+/**
+ * @brief ClassConstructor
+ * @param LayoutCheck only for the Layout-Check at Link-Time (see MCP2515LayoutCheck), keep the Default
+ */
+MCP2515::MCP2515(const uint8_t *) :
+  _spiSettings(MCP2515_MAX_SPI_SPEED, MCP2515_SPI_DATA_ORDER, MCP2515_SPI_MODE),
+  _csPin(0),
+  _spiMode(MCP2515_SPI_MODE),
+  _dataOrder(MCP2515_SPI_DATA_ORDER),
+  _spiFrequency(MCP2515_MAX_SPI_SPEED),
+  _clockFrequency(MCP2515_DEFAULT_CLOCK_FREQUENCY),
+  _operationMode(0xFF),
+  _baudRate(MCP2515_DEFAULT_BAUDRATE),
+  _samplePoint(MCP2515_DEFAULT_SAMPLE_POINT),
+  _maxBitRateError(MCP2515_DEFAULT_MAX_BITRATE_ERROR),
+  _bitRateError(0),
+  _actualSamplePoint(0),
+  _isInitialized(false),
+  _lastMcpError(EMPTY_VALUE_16_BIT),
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+  _callDepth(0),
+#endif
+#ifdef MCP2515_ENABLE_ERROR_LOG
+  _errorEvents(),
+  _errorEventHead(0),
+  _errorEventCount(0),
+  _errorEventTotal(0),
+#endif
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+  _performanceCounters(),
+#endif
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+  _latencyHistograms(),
+  _interruptTime(0),
+  _interruptCaptured(false),
+  _rxAvailableTime(),
+  _rxAvailableMask(0),
+  _transmitEnqueueTime(),
+  _transmitEnqueuedMask(0),
+  _transmitStartedMask(0),
+#endif
+  _reCheckEnabled(true),
+  _oneShotMode(false),
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+  _cyclicMessages(),
+  _cyclicHeap(),
+  _cyclicHeapSize(0),
+  _cyclicEpoch(0),
+  _cyclicEpochSteps(0),
+#endif
+  _transmitCallback(NULL),
+  _transmitTag(),
+  _pendingTransmissions(0),
+  _transmitDeadline(),
+  _transmitDeadlineMask(0),
+  _maxSendTime(0),
+  _modeTransitionTime(0),
+  _sleepPreviousMode(0xFF),
+  _sleepWakeUpInterrupt(false),
+  _wakeUpPending(false),
+  _wakeUpTime(0),
+  _wakeUpLatency(0),
+  _busStateMonitoring(false),
+  _busStateCallback(NULL),
+  _busState(MCP2515_BUS_STATE_ERROR_ACTIVE),
+  _transmitErrorCounter(0),
+  _receiveErrorCounter(0),
+  _busOffBackoff(MCP2515_BUS_OFF_RECOVERY_AUTOMATIC),
+  _busOffPreviousMode(MCP2515_OP_NORMAL),
+  _busOffTime(0),
+  _busOffRecoveryTime(0),
+  _busOffCount(0),
+  _sofTimestamp(0),
+  _sofCount(0),
+  _sofLatched(),
+  _sofLatchedMask(0),
+  _sofLatchedCount(0),
+  _rxStartOfFrame(0),
+  _rxStartOfFrameValid(false),
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+  _txQueue(),
+  _txQueueCount(0),
+  _txQueueSequence(0),
+  _txQueueInFlight(0),
+  _txQueueSlot(),
+  _txQueuePriority(),
+  _txQueuePreempted(0),
+  _txQueueExpired(0),
+  _txQueueStatistic(),
+  _rateLimits(),
+  _busLoadLimit(),
+  _utilizationBits(0),
+  _utilizationStart(0),
+  _utilization(0),
+#endif
+#ifdef MCP2515_ENABLE_BUS_LOAD
+  _transmitFrameBits(),
+  _transmitStuffBits(),
+  _busLoadBits(),
+  _busLoadSlot(0),
+  _busLoadSlotCount(0),
+  _busLoadSlotStart(0),
+  _busLoadStatistic(),
+#endif
+  _filterRegisters(),
+  _filterRegistersValid(false),
+  _registerCacheEnabled(false),
+  _registerCache(),
+  _registerCacheValid(0)
+{
+}
+
+/**
+ * @brief Deconstructor
+ */
+MCP2515::~MCP2515()
+{
+}
+
+/**
+ * @brief Returns the last MCP-Error.
+ *
+ * The last MCP-Error will always been reset at the beginning of a Method.
+ * Previous Errors are stored in the Error-Log (see getErrorEvent(), only with MCP2515_ENABLE_ERROR_LOG).
+ * @return uint16_t MCP-Error
+ *
+ * 0x0000 = no Error
+ */
+uint16_t MCP2515::getLastMCPError()
+{
+	return _lastMcpError;
+}
+
+#ifdef MCP2515_ENABLE_ERROR_LOG
+/**
+ * @brief Get the Count of the stored Error-Events (see getErrorEvent()).
+ *
+ * Only available when MCP2515_ENABLE_ERROR_LOG is defined.
+ * @return uint8_t Count of stored Error-Events (0 - MCP2515_ERROR_LOG_SIZE)
+ */
+uint8_t MCP2515::getErrorEventCount()
+{
+  return _errorEventCount;
+}
+
+/**
+ * @brief Get the Count of all Error-Events since the last clearErrorEvents(), also the overwritten ones.
+ *
+ * Only available when MCP2515_ENABLE_ERROR_LOG is defined.
+ * @return uint32_t Count of Error-Events
+ */
+uint32_t MCP2515::getErrorEventTotal()
+{
+  return _errorEventTotal;
+}
+
+/**
+ * @brief Get a stored Error-Event.
+ *
+ * Only available when MCP2515_ENABLE_ERROR_LOG is defined.
+ *
+ * Every public Call which ends with an Error stores the Error, the Context, the Time and some Status-Registers
+ * in a Ring of MCP2515_ERROR_LOG_SIZE Events. Successful Calls do not change the Error-Log.
+ * @param Index 0 = newest Error-Event, getErrorEventCount() - 1 = oldest Error-Event
+ * @param Event Error-Event
+ * @return true when the Error-Event exists, otherwise false
+ */
+bool MCP2515::getErrorEvent(uint8_t Index, MCP2515ErrorEvent &Event)
+{
+  if (Index >= _errorEventCount)
   {
-    this->_isInitialized = false;
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_SET_TX_BUFFER_FLAGS;
     return false;
   }
 
-  // Disable the Mask und Filter
-  if (!disableFilterMask(0) || !disableFilterMask(1))
+  Event = _errorEvents[(_errorEventHead + MCP2515_ERROR_LOG_SIZE - 1 - Index) % MCP2515_ERROR_LOG_SIZE];
+  return true;
+}
+
+/**
+ * @brief Clears the Error-Log.
+ *
+ * Only available when MCP2515_ENABLE_ERROR_LOG is defined.
+ */
+void MCP2515::clearErrorEvents()
+{
+  this->_errorEventHead = 0;
+  this->_errorEventCount = 0;
+  this->_errorEventTotal = 0;
+}
+#endif
+
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+/**
+ * @brief Get a Copy of the Performance-Counters.
+ *
+ * Only available when MCP2515_ENABLE_PERFORMANCE_COUNTERS is defined.
+ * @param Counters Performance-Counters since the Construction or the last resetPerformanceCounters()
+ */
+void MCP2515::getPerformanceCounters(MCP2515PerformanceCounters &Counters)
+{
+  noInterrupts();
+  Counters = _performanceCounters;
+  interrupts();
+}
+
+/**
+ * @brief Resets all Performance-Counters to 0.
+ *
+ * Only available when MCP2515_ENABLE_PERFORMANCE_COUNTERS is defined.
+ */
+void MCP2515::resetPerformanceCounters()
+{
+  noInterrupts();
+  this->_performanceCounters = MCP2515PerformanceCounters();
+  interrupts();
+}
+#endif
+
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+/**
+ * @brief Get the logarithmic Bucket of a Latency (2 Buckets per Power of 2).
+ * @param Latency Latency in µs
+ * @return Bucket (0 - MCP2515_LATENCY_BUCKETS-1)
+ */
+uint8_t MCP2515::getLatencyBucket(uint32_t Latency)
+{
+  if (Latency < 2)
   {
-    this->_isInitialized = false;
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_DISABLE_MASKS_FILTERS;
-    return false;
+    return (uint8_t)Latency;
   }
 
-  // Change to Operation-Mode Normal
-  if (!setNormalMode()) {
-    this->_isInitialized = false;
-    this->_lastMcpError =_lastMcpError | ERROR_MCP2515_INIT_SET_NORMAL_MODE;
-    return false;
+  uint8_t Exponent = 1;
+
+  while ((Latency >> (Exponent + 1)) != 0)
+  {
+    Exponent++;
   }
 
-  return true;
+  uint8_t Bucket = (2 * Exponent) + ((Latency >> (Exponent - 1)) & 0x01);
+
+  return (Bucket < MCP2515_LATENCY_BUCKETS) ? Bucket : (MCP2515_LATENCY_BUCKETS - 1);
 }
 
 /**
- * @brief Deinitialize the MCP2515.
+ * @brief Get the smallest Latency of a Bucket (see getLatencyBucket()).
+ * @param Bucket Bucket
+ * @return Latency in µs
  */
-void MCP2515::deinit()
+uint32_t MCP2515::getLatencyBucketStart(uint8_t Bucket)
 {
-  this->_isInitialized = false;
-  SPI.end();
+  if (Bucket < 2)
+  {
+    return Bucket;
+  }
+
+  return (uint32_t)(2 + (Bucket & 0x01)) << ((Bucket / 2) - 1);
 }
 
 /**
- * @brief Changing the Baudrate.
- * @param targetBaudrate possible Baudrates= (5E3, 10E3, 20E3, 40E3, 50E3, 80E3, 100E3, 125E3, 200E3, 250E3, 500E3, 1000E3)
- * @return true when success, false on any error (Check _lastMcpError)
- * @note If a Baudrate is allowed depends on the ClockFrequency.
+ * @brief Adds a Latency to a Histogram.
+ * @param Histogram MCP2515_LATENCY_*
+ * @param Latency Latency in µs
  */
-bool MCP2515::changeBaudRate(uint32_t targetBaudRate)
+void MCP2515::recordLatency(uint8_t Histogram, uint32_t Latency)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  MCP2515LatencyHistogram &Result = _latencyHistograms[Histogram];
+  uint8_t Bucket = getLatencyBucket(Latency);
 
-  if (!_isInitialized)
+  if (Result.buckets[Bucket] < 0xFFFF)
   {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
+    Result.buckets[Bucket]++;
   }
 
-  if (targetBaudRate != _baudRate)
+  if ((Result.count == 0) || (Latency < Result.min))
   {
-    if (!changeBitTiming(targetBaudRate, _clockFrequency))
+    Result.min = Latency;
+  }
+
+  if (Latency > Result.max)
+  {
+    Result.max = Latency;
+  }
+
+  Result.count++;
+}
+
+/**
+ * @brief Marks received Frames as seen by the Driver, the first one after an INT-Edge ends the Latency of the Edge.
+ * @param Flags RXnIF-Flags (Bit 0 = RX0IF, Bit 1 = RX1IF)
+ */
+void MCP2515::noteReceiveAvailable(uint8_t Flags)
+{
+  uint32_t Now = micros();
+  bool Available = false;
+
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    if ((Flags & CANINTF_BIT_RXnIF(i)) && !(_rxAvailableMask & (1 << i)))
     {
-      // Error will be set in changeBitTiming()
-      return false;
+      this->_rxAvailableTime[i] = Now;
+      this->_rxAvailableMask = _rxAvailableMask | (1 << i);
+      Available = true;
     }
-    this->_baudRate = targetBaudRate;
   }
-  return true;
+
+  if (!Available)
+  {
+    return;
+  }
+
+  noInterrupts();
+  bool Captured = _interruptCaptured;
+  uint32_t InterruptTime = _interruptTime;
+  this->_interruptCaptured = false;
+  interrupts();
+
+  if (Captured)
+  {
+    recordLatency(MCP2515_LATENCY_INT_TO_AVAILABLE, Now - InterruptTime);
+  }
 }
 
 /**
- * @brief Enable/Disable an Interrupt.
+ * @brief Ends the Latency of a received Frame when it is read by the Application.
+ * @param BufferNumber 0 - 1
+ */
+void MCP2515::noteReceiveConsumed(uint8_t BufferNumber)
+{
+  if (_rxAvailableMask & (1 << BufferNumber))
+  {
+    recordLatency(MCP2515_LATENCY_AVAILABLE_TO_CONSUMED, micros() - _rxAvailableTime[BufferNumber]);
+    this->_rxAvailableMask = _rxAvailableMask & ~(1 << BufferNumber);
+  }
+}
+
+/**
+ * @brief Stores the Time when a Frame was handed to the Driver for a TX-Buffer.
+ * @param BufferNumber 0 - 2
+ * @param Time micros() of the Hand-Over
+ */
+void MCP2515::noteTransmitEnqueued(uint8_t BufferNumber, uint32_t Time)
+{
+  this->_transmitEnqueueTime[BufferNumber] = Time;
+  this->_transmitEnqueuedMask = _transmitEnqueuedMask | (1 << BufferNumber);
+  this->_transmitStartedMask = _transmitStartedMask & ~(1 << BufferNumber);
+}
+
+/**
+ * @brief Ends the Latency till the Transmit Request of the given TX-Buffers.
+ *
+ * A repeated Request of an already requested Frame starts a new Measurement of the Completion only.
+ * @param Mask Bit 0 - 2 = TX-Buffer 0 - 2
+ */
+void MCP2515::noteTransmitStarted(uint8_t Mask)
+{
+  uint32_t Now = micros();
+
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    if (!(Mask & (1 << i)))
+    {
+      continue;
+    }
+
+    if (_transmitEnqueuedMask & (1 << i))
+    {
+      recordLatency(MCP2515_LATENCY_ENQUEUE_TO_TX_START, Now - _transmitEnqueueTime[i]);
+      this->_transmitEnqueuedMask = _transmitEnqueuedMask & ~(1 << i);
+    } else {
+      this->_transmitEnqueueTime[i] = Now;
+    }
+
+    this->_transmitStartedMask = _transmitStartedMask | (1 << i);
+  }
+}
+
+/**
+ * @brief Ends the Latency till the successful Transmission of the given TX-Buffer.
+ * @param BufferNumber 0 - 2
+ */
+void MCP2515::noteTransmitCompleted(uint8_t BufferNumber)
+{
+  if (_transmitStartedMask & (1 << BufferNumber))
+  {
+    recordLatency(MCP2515_LATENCY_ENQUEUE_TO_TX_COMPLETE, micros() - _transmitEnqueueTime[BufferNumber]);
+    this->_transmitStartedMask = _transmitStartedMask & ~(1 << BufferNumber);
+  }
+}
+
+/**
+ * @brief Stores the Time of a falling Edge of the INT-Pin (Start of the Latency MCP2515_LATENCY_INT_TO_AVAILABLE).
+ *
+ * Call it from the Interrupt-Service-Routine of the INT-Pin. The INT-Pin stays low while any Interrupt-Flag is set,
+ * so the Latency is only exact when only the Receive-Interrupts are enabled.
+ * Only available when MCP2515_ENABLE_LATENCY_HISTOGRAMS is defined.
+ * @note Uses no SPI and can be called from an Interrupt-Service-Routine.
+ */
+void MCP2515::captureInterrupt()
+{
+  this->_interruptTime = micros();
+  this->_interruptCaptured = true;
+}
+
+/**
+ * @brief Get a Copy of a Latency-Histogram.
+ *
+ * Only available when MCP2515_ENABLE_LATENCY_HISTOGRAMS is defined.
+ * @param Histogram MCP2515_LATENCY_*
+ * @param Result Latency-Histogram since the Construction or the last resetLatencyHistograms()
+ * @return true when the Histogram exists, otherwise false
+ */
+bool MCP2515::getLatencyHistogram(uint8_t Histogram, MCP2515LatencyHistogram &Result)
+{
+  if (Histogram >= MCP2515_LATENCY_HISTOGRAMS)
+  {
+    return false;
+  }
+
+  Result = _latencyHistograms[Histogram];
+  return true;
+}
+
+/**
+ * @brief Get a Percentile of a Latency-Histogram (e.g. 99 for the Tail-Latency).
+ *
+ * The Result is the largest Latency of the Bucket which contains the Percentile, but not more than the Maximum.
+ * Only available when MCP2515_ENABLE_LATENCY_HISTOGRAMS is defined.
+ * @param Histogram MCP2515_LATENCY_*
+ * @param Percentile 0 - 100
+ * @return Latency in µs, 0 when the Histogram is empty or does not exist
+ */
+uint32_t MCP2515::getLatencyPercentile(uint8_t Histogram, uint8_t Percentile)
+{
+  if ((Histogram >= MCP2515_LATENCY_HISTOGRAMS) ||
+      (Percentile > 100) ||
+      (_latencyHistograms[Histogram].count == 0))
+  {
+    return 0;
+  }
+
+  const MCP2515LatencyHistogram &Result = _latencyHistograms[Histogram];
+
+  if (Percentile == 0)
+  {
+    return Result.min;
+  }
+
+  uint32_t Total = 0;
+
+  for (uint8_t i = 0; i < MCP2515_LATENCY_BUCKETS; i++)
+  {
+    Total += Result.buckets[i];
+  }
+
+  uint32_t Target = ((Total * Percentile) + 99) / 100;
+  uint32_t Cumulative = 0;
+
+  for (uint8_t i = 0; i < (MCP2515_LATENCY_BUCKETS - 1); i++)
+  {
+    Cumulative += Result.buckets[i];
+
+    if (Cumulative >= Target)
+    {
+      uint32_t Latency = getLatencyBucketStart(i + 1) - 1;
+      return (Latency < Result.max) ? Latency : Result.max;
+    }
+  }
+
+  return Result.max;
+}
+
+/**
+ * @brief Resets all Latency-Histograms.
+ *
+ * Only available when MCP2515_ENABLE_LATENCY_HISTOGRAMS is defined.
+ */
+void MCP2515::resetLatencyHistograms()
+{
+  for (uint8_t i = 0; i < MCP2515_LATENCY_HISTOGRAMS; i++)
+  {
+    this->_latencyHistograms[i] = MCP2515LatencyHistogram();
+  }
+}
+
+/**
+ * @brief Prints all Latency-Histograms (e.g. to Serial).
+ *
+ * For each Histogram one Line with Count, Minimum, 50th/99th Percentile and Maximum,
+ * followed by one Line per used Bucket with its Range in µs and its Count.
+ * Only available when MCP2515_ENABLE_LATENCY_HISTOGRAMS is defined.
+ * @param Output Output (e.g. Serial)
+ */
+void MCP2515::printLatencyHistograms(Print &Output)
+{
+  const char *Names[MCP2515_LATENCY_HISTOGRAMS] = {"INT -> available", "available -> consumed", "enqueue -> TX start", "enqueue -> TX complete"};
+
+  for (uint8_t i = 0; i < MCP2515_LATENCY_HISTOGRAMS; i++)
+  {
+    const MCP2515LatencyHistogram &Result = _latencyHistograms[i];
+
+    Output.print(Names[i]);
+    Output.print(": count ");
+    Output.print(Result.count);
+    Output.print(", min ");
+    Output.print(Result.min);
+    Output.print(" us, p50 ");
+    Output.print(getLatencyPercentile(i, 50));
+    Output.print(" us, p99 ");
+    Output.print(getLatencyPercentile(i, 99));
+    Output.print(" us, max ");
+    Output.print(Result.max);
+    Output.println(" us");
+
+    for (uint8_t Bucket = 0; Bucket < MCP2515_LATENCY_BUCKETS; Bucket++)
+    {
+      if (Result.buckets[Bucket] == 0)
+      {
+        continue;
+      }
+
+      Output.print("\t");
+      Output.print(getLatencyBucketStart(Bucket));
+
+      if (Bucket == (MCP2515_LATENCY_BUCKETS - 1))
+      {
+        Output.print("+");
+      } else if ((getLatencyBucketStart(Bucket + 1) - 1) > getLatencyBucketStart(Bucket)) {
+        Output.print(" - ");
+        Output.print(getLatencyBucketStart(Bucket + 1) - 1);
+      }
+
+      Output.print(" us: ");
+      Output.println(Result.buckets[Bucket]);
+    }
+  }
+}
+#endif
+
+/**
+ * @brief Starts a public Call: an Error of a previous Call is reset. The Context of the Call is kept in this Object,
+ * so a successful Call writes no Member of the MCP2515-Object (only the Performance-Counters, when enabled).
+ * @param Module MCP2515-Object of the Call
+ * @param Context MCP2515_CONTEXT_* of the Call
+ */
+MCP2515::ErrorContext::ErrorContext(MCP2515 &Module, uint8_t Context) :
+  _module(Module),
+  _context(Context)
+{
+  // Only written when the previous Call failed
+  if (Module._lastMcpError != EMPTY_VALUE_16_BIT)
+  {
+    Module._lastMcpError = EMPTY_VALUE_16_BIT;
+  }
+
+#ifdef MCP2515_ENABLE_ERROR_LOG
+  this->_errorEventTotal = Module._errorEventTotal;
+#endif
+
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+  Module._callDepth++;
+  this->_start = micros();
+#endif
+}
+
+/**
+ * @brief Ends a public Call: when the Call ends with an Error it will be stored in the Error-Log
+ * (only with MCP2515_ENABLE_ERROR_LOG). When a nested public Call already stored the Error,
+ * this Event is completed with the Error and the Context of this Call.
+ */
+MCP2515::ErrorContext::~ErrorContext()
+{
+#ifdef MCP2515_ENABLE_ERROR_LOG
+  if (_module._lastMcpError != EMPTY_VALUE_16_BIT)
+  {
+    if (_module._errorEventTotal != _errorEventTotal)
+    {
+      _module.completeErrorEvent(_context);
+    } else {
+      _module.logErrorEvent(_context);
+    }
+  }
+#endif
+
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+  _module._callDepth--;
+
+  // Only the outermost Call is counted, so the Time of nested public Calls is not counted twice
+  if (_module._callDepth == 0)
+  {
+    _module._performanceCounters.contextCalls[_context]++;
+    _module._performanceCounters.contextTime[_context] += micros() - _start;
+  }
+#endif
+}
+
+#ifdef MCP2515_ENABLE_ERROR_LOG
+/**
+ * @brief Stores the last MCP-Error with the Status-Registers of the MCP2515 as Error-Event in the Error-Log.
+ * @param Context MCP2515_CONTEXT_* of the failed Call
+ */
+void MCP2515::logErrorEvent(uint8_t Context)
+{
+  MCP2515ErrorEvent &Event = _errorEvents[_errorEventHead];
+
+  Event.code = _lastMcpError;
+  Event.context = Context;
+  Event.timestamp = micros();
+  Event.registersValid = _isInitialized;
+
+  if (_isInitialized)
+  {
+    uint8_t Counters[2] = {0, 0};
+    uint8_t Flags[2] = {0, 0};
+
+    Event.canStatus = readInstruction(REG_CANSTAT);
+    readInstruction(REG_TEC, Counters, 2);
+    readInstruction(REG_CANINTF, Flags, 2);
+
+    Event.transmitErrorCounter = Counters[0];
+    Event.receiveErrorCounter = Counters[1];
+    Event.canInterruptFlags = Flags[0];
+    Event.errorFlags = Flags[1];
+
+    // The Reads must not change the Error of the Call
+    this->_lastMcpError = Event.code;
+  } else {
+    Event.canStatus = 0;
+    Event.canInterruptFlags = 0;
+    Event.errorFlags = 0;
+    Event.transmitErrorCounter = 0;
+    Event.receiveErrorCounter = 0;
+  }
+
+  this->_errorEventHead = (_errorEventHead + 1) % MCP2515_ERROR_LOG_SIZE;
+
+  if (_errorEventCount < MCP2515_ERROR_LOG_SIZE)
+  {
+    this->_errorEventCount++;
+  }
+
+  this->_errorEventTotal++;
+}
+
+/**
+ * @brief Completes the newest Error-Event (stored by a nested public Call) with the last MCP-Error and the Context of the calling Method.
+ * @param Context MCP2515_CONTEXT_* of the failed Call
+ */
+void MCP2515::completeErrorEvent(uint8_t Context)
+{
+  if (_errorEventCount == 0)
+  {
+    // Cleared in the meantime
+    logErrorEvent(Context);
+    return;
+  }
+
+  MCP2515ErrorEvent &Event = _errorEvents[(_errorEventHead + MCP2515_ERROR_LOG_SIZE - 1) % MCP2515_ERROR_LOG_SIZE];
+
+  Event.code = _lastMcpError;
+  Event.context = Context;
+}
+#endif
+
+/**
+ * @brief Set the ReCheck-Enabler.
+ *
+ * When it's enabled, after Setting some bit it will check if the bit is set successfully.
+ * @param reCheckEnabler bool
+ * @return bool true when success, false on any error
+ */
+bool MCP2515::setReCheckEnabler(bool reCheckEnabler)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (reCheckEnabler != true && reCheckEnabler != false)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  this->_reCheckEnabled = reCheckEnabler;
+
+  return true;
+}
+
+/**
+ * @brief Enable or disable the Register-Cache.
+ *
+ * The Register-Cache holds a Copy of the writable Configuration-Registers (BFPCTRL, TXRTSCTRL, CANCTRL, CNF1 - CNF3, CANINTE,
+ * RXB0CTRL, RXB1CTRL) and uses the programmed Masks and Filters. While it's enabled:
+ *
+ * - Getters of these Registers (and the Rechecks after a Write) are served from the Cache (Registers with read-only Bits are still read).
+ *
+ * - Writes and Modifies which don't change a Value are skipped (a Request of an Operation-Mode or an Abort is always written).
+ *
+ * Divergences (e.g. after a Reset of the MCP2515) can be detected with scrubRegisterCache().
+ * @note Can also be set before init().
+ * @param RegisterCacheEnabler true = Register-Cache enabled
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setRegisterCacheEnabler(bool RegisterCacheEnabler)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  if (RegisterCacheEnabler != true && RegisterCacheEnabler != false)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  if (RegisterCacheEnabler != _registerCacheEnabled)
+  {
+    // Changes while the Cache was disabled are unknown
+    this->_registerCacheValid = 0;
+  }
+
+  this->_registerCacheEnabled = RegisterCacheEnabler;
+
+  return true;
+}
+
+/**
+ * @brief Compares the Register-Cache with the Registers of the MCP2515 and reloads the Cache from the MCP2515.
+ *
+ * The Masks and Filters are only compared in the Configuration-Mode, because they read all '0's in any other Mode.
+ * @param Divergences Number of Registers which differ from the Cache
+ * @return true when no Register differs, false on any error or Divergence (ERROR_MCP2515_REGISTER_CACHE_DIVERGED)
+ */
+bool MCP2515::scrubRegisterCache(uint8_t &Divergences)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  Divergences = 0;
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  uint8_t Registers[MCP2515_FILTER_REGISTERS];
+
+  for (uint8_t i = 0; i < MCP2515_CACHED_REGISTERS; i++)
+  {
+    uint8_t Cached = _registerCache[i];
+    bool Valid = _registerCacheValid & (1 << i);
+
+    // Reading reloads the Cache
+    readInstruction(CachedRegisterAddress[i], Registers, 1);
+
+    if (Valid && (((Cached ^ Registers[0]) & ~CachedRegisterReadOnly[i]) != 0x00))
+    {
+      Divergences++;
+    }
+  }
+
+  if (_filterRegistersValid && (_operationMode == MCP2515_OP_CONFIGURATION))
+  {
+    // Filter 0 - 2, Filter 3 - 5, Mask 0 - 1
+    readInstruction(getFilterRegisterAddress(0), &Registers[0], 12);
+    readInstruction(getFilterRegisterAddress(12), &Registers[12], 12);
+    readInstruction(getFilterRegisterAddress(24), &Registers[24], 8);
+
+    for (uint8_t i = 0; i < MCP2515_FILTER_REGISTERS; i++)
+    {
+      if (Registers[i] != _filterRegisters[i])
+      {
+        Divergences++;
+        this->_filterRegisters[i] = Registers[i];
+      }
+    }
+  }
+
+  if (Divergences > 0)
+  {
+    this->_lastMcpError = ERROR_MCP2515_REGISTER_CACHE_DIVERGED;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Set the CS (ChipSelect) Pin.
+ * @note Use this Method only before the Initialisation of the MCP2515.
+ * @param cs ChipSelect-Pin
+ * @return true when success, false on any error
+ */
+bool MCP2515::setSpiPins(uint8_t cs)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETUP);
+
+  if (_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
+    return false;
+  }
+
+  this->_csPin = cs;
+
+  return true;
+}
+
+/**
+ * @brief Setting the SPI-Mode.
+ * @note Use this Method only before the Initialisation of the MCP2515.
+ * @param SpiMode Allowed Values for the MCP2515 are SPI_MODE0 and SPI_MODE3.
+ * @return true when success, false on any error
+ */
+bool MCP2515::setSpiMode(uint8_t SpiMode)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETUP);
+
+  if (_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
+    return false;
+  }
+
+  if (SpiMode != SPI_MODE0 && SpiMode != SPI_MODE3)
+  {
+    this->_lastMcpError = ERROR_MCP2515_SPI_MODE_NOT_ALLOWED;
+    return false;
+  }
+
+  this->_spiMode = SpiMode;
+  SPISettings _spiSettings(_spiFrequency, _dataOrder, SpiMode);
+
+  return true;
+}
+
+/**
+ * @brief Set the DataOrder.
+ * @note Use this Method only before the Initialisation of the MCP2515.
+ * @param DataOrder Allowed Value for the MCP2515 is MSBFIRST.
+ * @return true when success, false on any error
+ */
+bool MCP2515::setDataOrder(uint8_t DataOrder)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETUP);
+
+  if (_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
+    return false;
+  }
+
+  if (DataOrder != MSBFIRST)
+  {
+    this->_lastMcpError = ERROR_MCP2515_DATA_ORDER_NOT_ALLOWED;
+    return false;
+  }
+
+  this->_dataOrder = DataOrder;
+  SPISettings _spiSettings(_spiFrequency, DataOrder, _spiMode);
+
+  return true;
+}
+
+/**
+ * @brief Set the SPI-Clock-Frequency.
+ * @note Use this Method only before the Initialisation of the MCP2515.
+ * @param Frequency max. allowed Value for the MCP2515 is 10e6 Hz.
+ * @return true when success, false on any error
+ */
+bool MCP2515::setSpiFrequency(uint32_t Frequency)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETUP);
+
+  if (_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
+    return false;
+  }
+
+  if (((uint32_t)Frequency > (uint32_t)MCP2515_MAX_SPI_SPEED) ||
+      ((uint32_t)Frequency < (uint32_t)1e6))
+  {
+    this->_lastMcpError = ERROR_MCP2515_SPI_FREQUENCY_NOT_ALLOWED;
+    return false;
+  }
+
+  this->_spiFrequency = Frequency;
+  SPISettings _spiSettings(Frequency, _dataOrder, _spiMode);
+
+  return true;
+}
+
+/**
+ * @brief Set the MCP2515 Clock-Frequency.
+ * @note Use this Method only before the Initialisation of the MCP2515.
+ * @param ClockFrequency allowed Values are 1MHz - 40MHz (the Bit-Timing is calculated for any ClockFrequency).
+ * @return true when success, false on any error
+ */
+bool MCP2515::setClockFrequency(uint32_t ClockFrequency)
+{
+  if (_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
+    return false;
+  }
+
+  if ((ClockFrequency < (uint32_t)MCP2515_MIN_CLOCK_FREQUENCY) || (ClockFrequency > (uint32_t)MCP2515_MAX_CLOCK_FREQUENCY))
+  {
+    this->_lastMcpError = ERROR_MCP2515_CLOCKFREQUENCY_NOT_VALID;
+    return false;
+  }
+
+  this->_clockFrequency = ClockFrequency;
+
+  return true;
+}
+
+/**
+ * @brief Set the MCP2515 in the Configuration-Mode.
+ * @note Doc p. 59; Kap. 10.1
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setConfigurationMode()
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_OPERATION_MODE);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  return requestOperationMode(MCP2515_OP_CONFIGURATION);
+}
+
+/**
+ * @brief Set the MCP2515 in the Normal-Mode.
+ * @note Doc p. 60; Kap. 10.5
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setNormalMode()
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_OPERATION_MODE);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  return requestOperationMode(MCP2515_OP_NORMAL);
+}
+
+/**
+ * @brief Set the MCP2515 in the Sleep-Mode.
+ * @note Doc p. 59; Kap. 10.2
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setSleepMode()
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_OPERATION_MODE);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  return requestOperationMode(MCP2515_OP_SLEEP);
+}
+
+/**
+ * @brief Set the MCP2515 in the Sleep-Mode and arm the Wake-Up on Bus-Activity.
+ *
+ * The Wake-Up-Interrupt (WAKIE) is enabled, so the INT-Pin wakes up the Microcontroller too. The MCP2515 wakes up into the
+ * Listen-Only-Mode, handleInterrupt() (or wakeUp()) restores the Operation-Mode from before the Sleep-Mode.
+ * The Frame which causes the Wake-Up is lost (the Oscillator of the MCP2515 starts with it), the following Frames are received.
+ * @note Doc p. 59; Kap. 10.2
+ * @param WakeUpFilter true = the Low-Pass-Filter of the RXCAN-Pin (CNF3.WAKFIL) is enabled, so short Glitches don't wake up the MCP2515
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::enterSleepMode(bool WakeUpFilter)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_OPERATION_MODE);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (WakeUpFilter != true && WakeUpFilter != false)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  if (_operationMode == MCP2515_OP_SLEEP)
+  {
+    this->_lastMcpError = ERROR_MCP2515_FALSE_OPERATION_MODE;
+    return false;
+  }
+
+  uint8_t OperationMode = _operationMode;
+  uint8_t WakeUpFilterBit = WakeUpFilter ? CNF3_BIT_WAKFIL : 0x00;
+
+  // WAKFIL can only be changed in the Configuration-Mode (the Sleep-Mode can be requested from there)
+  if ((getConfigurationRegister3() & CNF3_BIT_WAKFIL) != WakeUpFilterBit)
+  {
+    if (!setConfigurationMode())
+    {
+      // Error will be set in setConfigurationMode()
+      return false;
+    }
+
+    if (!modifyConfigurationRegister3(CNF3_BIT_WAKFIL, WakeUpFilterBit))
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CNF3_NOT_SET;
+      return false;
+    }
+  }
+
+  // The Wake-Up-Interrupt is disabled again after the Wake-Up, when it was not enabled before
+  this->_sleepWakeUpInterrupt = !(getCanInterruptEnable() & CANINTE_BIT_WAKIE);
+
+  if (!modifyCanInterruptFlag(CANINTF_BIT_WAKIF, 0x00) ||
+      !modifyCanInterruptEnable(CANINTE_BIT_WAKIE, CANINTE_BIT_WAKIE))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CHANGE_INTERRUPT;
+    return false;
+  }
+
+  if (!requestOperationMode(MCP2515_OP_SLEEP))
+  {
+    // Error will be set in requestOperationMode()
+    return false;
+  }
+
+  this->_sleepPreviousMode = OperationMode;
+  this->_wakeUpPending = false;
+
+  return true;
+}
+
+/**
+ * @brief Wakes up the MCP2515 from the Sleep-Mode of enterSleepMode() (e.g. to transmit a Message).
+ *
+ * The Wake-Up is generated by setting CANINTF.WAKIF, afterwards the Operation-Mode from before the Sleep-Mode is restored.
+ * @note Doc p. 59; Kap. 10.2
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::wakeUp()
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_OPERATION_MODE);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (_sleepPreviousMode == 0xFF)
+  {
+    this->_lastMcpError = ERROR_MCP2515_FALSE_OPERATION_MODE;
+    return false;
+  }
+
+  if (!modifyCanInterruptFlag(CANINTF_BIT_WAKIF, CANINTF_BIT_WAKIF))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CHANGE_INTERRUPT;
+    return false;
+  }
+
+  if (!handleWakeUp())
+  {
+    if (_lastMcpError == EMPTY_VALUE_16_BIT)
+    {
+      this->_lastMcpError = ERROR_MCP2515_OPERATION_MODE_NOT_SET | ERROR_MCP2515_VALUE_NOT_SET;
+    }
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Handles a Wake-Up (WAKIF) from the Sleep-Mode of enterSleepMode().
+ *
+ * The MCP2515 wakes up into the Listen-Only-Mode and changes CANCTRL.REQOP by itself, so CANCTRL is reloaded from the MCP2515.
+ * The Operation-Mode from before the Sleep-Mode is restored and the Measurement of the Wake-Up-Latency is started.
+ * @return true when a Wake-Up was handled, false when not (Check _lastMcpError)
+ */
+bool MCP2515::handleWakeUp()
+{
+  if (!(getCanInterruptFlag() & CANINTF_BIT_WAKIF))
+  {
+    return false;
+  }
+
+  uint8_t OperationMode = _sleepPreviousMode;
+
+  this->_wakeUpTime = micros();
+  this->_wakeUpLatency = 0;
+  this->_wakeUpPending = true;
+  this->_sleepPreviousMode = 0xFF;
+  this->_operationMode = MCP2515_OP_LISTEN;
+  this->_registerCacheValid = _registerCacheValid & ~(1 << getCachedRegisterIndex(REG_CANCTRL));
+
+  modifyCanInterruptFlag(CANINTF_BIT_WAKIF, 0x00);
+
+  if (_sleepWakeUpInterrupt)
+  {
+    modifyCanInterruptEnable(CANINTE_BIT_WAKIE, 0x00);
+  }
+
+  if (OperationMode == MCP2515_OP_LISTEN)
+  {
+    // Wait until the Oscillator is started and the MCP2515 is in the Listen-Only-Mode
+    return requestOperationMode(MCP2515_OP_LISTEN);
+  }
+
+  return setOperationMode(OperationMode);
+}
+
+/**
+ * @brief Reads TEC, REC and EFLG, resets ERRIF and updates the Bus-State (see enableBusStateMonitoring()).
+ *
+ * On a Change the Bus-State-Callback is called. When the MCP2515 goes Bus-Off and a Backoff is configured it is held
+ * in the Configuration-Mode (off the Bus) until recoverFromBusOff().
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::updateBusState()
+{
+  uint8_t Counters[2];
+
+  if (!readInstruction(REG_TEC, Counters, 2))
+  {
+    // Error will be set in readInstruction()
+    return false;
+  }
+
+  uint8_t ErrorFlags = getErrorFlag();
+
+  if (!modifyCanInterruptFlag(CANINTF_BIT_ERRIF, 0x00))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_RESET_FLAG;
+    return false;
+  }
+
+  this->_transmitErrorCounter = Counters[0];
+  this->_receiveErrorCounter = Counters[1];
+
+  uint8_t State = MCP2515_BUS_STATE_ERROR_ACTIVE;
+
+  if (ErrorFlags & EFLG_BIT_TXBO)
+  {
+    State = MCP2515_BUS_STATE_BUS_OFF;
+  } else if (ErrorFlags & (EFLG_BIT_TXEP | EFLG_BIT_RXEP)) {
+    State = MCP2515_BUS_STATE_ERROR_PASSIVE;
+  } else if (ErrorFlags & EFLG_BIT_EWARN) {
+    State = MCP2515_BUS_STATE_WARNING;
+  }
+
+  if (State == _busState)
+  {
+    return true;
+  }
+
+  uint8_t PreviousState = _busState;
+  this->_busState = State;
+
+  if (State == MCP2515_BUS_STATE_BUS_OFF)
+  {
+    this->_busOffTime = micros();
+    this->_busOffCount++;
+
+    // Hold the MCP2515 off the Bus, otherwise it recovers by itself after 128 x 11 recessive Bits
+    if (_busOffBackoff != MCP2515_BUS_OFF_RECOVERY_AUTOMATIC)
+    {
+      this->_busOffPreviousMode = _operationMode;
+
+      if (!setConfigurationMode())
+      {
+        // Error will be set in setConfigurationMode()
+        return false;
+      }
+    }
+  } else if (PreviousState == MCP2515_BUS_STATE_BUS_OFF) {
+    this->_busOffRecoveryTime = micros() - _busOffTime;
+  }
+
+  if (_busStateCallback != NULL)
+  {
+    _busStateCallback(State, PreviousState, _transmitErrorCounter, _receiveErrorCounter);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Recovers the MCP2515 from Bus-Off after the Backoff: TEC and REC were cleared in the Configuration-Mode of
+ * the Backoff, so the Operation-Mode from before the Bus-Off is requested again and the Bus-State is updated.
+ * @note Pending Transmissions, the Configuration and the Transmit-Queue are kept.
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::recoverFromBusOff()
+{
+  if (!setOperationMode(_busOffPreviousMode))
+  {
+    // Error will be set in setOperationMode()
+    return false;
+  }
+
+  // Calls the Bus-State-Callback and sets the Recovery-Time
+  return updateBusState();
+}
+
+/**
+ * @brief Set the MCP2515 in the Listen-Only-Mode.
+ * @note Doc p. 59; Kap. 10.3
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setListenOnlyMode()
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_OPERATION_MODE);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  return requestOperationMode(MCP2515_OP_LISTEN);
+}
+
+/**
+ * @brief Set the MCP2515 in the Loopback-Mode.
+ * @note Doc p. 60; Kap. 10.4
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setLoopbackMode()
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_OPERATION_MODE);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  return requestOperationMode(MCP2515_OP_LOOPBACK);
+}
+
+/**
+ * @brief Initialize the MCP2515.
+ *
+ * - Reset the MCP2515
+ *
+ * - Set the BitTiming for the given BaudRate
+ *
+ * - Setting the PinControl for RX-Pins and TX-Pins
+ *
+ * - Enable Receive-Interrupts
+ *
+ * - Disable Mask and Filter-Settings
+ *
+ * - Set the OperationMode Normal
+ * @param BaudRate Baudrate of the CAN-Communication
+ * @param reCheckEnabled bool true if after Set-Processes a recheck of setted Values has to be execute
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::init(uint32_t BaudRate, bool reCheckEnabled)
+{
+  uint8_t Cnf[3];
+  int32_t BitRateError = 0;
+  uint16_t SamplePoint = 0;
+
+  if (!_isInitialized && !calculateBitTiming(BaudRate, _clockFrequency, Cnf, BitRateError, SamplePoint))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_CHANGE_BITTIMING;
+    return false;
+  }
+
+  return initialize(_clockFrequency, BaudRate, Cnf, BitRateError, SamplePoint, reCheckEnabled);
+}
+
+/**
+ * @brief Initialize the MCP2515 with a declarative Configuration.
+ *
+ * Instead of single Write-Instructions (each with a Recheck) for each Setting, the whole Configuration is written after the Reset
+ * with up to 3 sequential and 3 single Write-Instructions and verified with one sequential Read (see restoreSnapshot()).
+ * @param Config Configuration (Bit-Timing, Interrupts, Pin-Control, Masks and Filters, Operation-Mode)
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::init(const MCP2515InitConfig &Config)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_INITIALISATION);
+
+  MCP2515Snapshot Snapshot;
+  uint8_t Cnf[3];
+  int32_t BitRateError = 0;
+  uint16_t SamplePoint = 0;
+
+  if (_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
+    return false;
+  }
+
+  if ((Config.operationMode > MCP2515_OP_CONFIGURATION) ||
+      (Config.rxPinControl > (BFPCTRL_BIT_BnBFS(1) | BFPCTRL_BIT_BnBFS(0) | BFPCTRL_BIT_BnBFE(1) | BFPCTRL_BIT_BnBFE(0) | BFPCTRL_BIT_BnBFM(1) | BFPCTRL_BIT_BnBFM(0))) ||
+      (Config.txPinControl > (TXRTSCTRL_BIT_BnRTSM(2) | TXRTSCTRL_BIT_BnRTSM(1) | TXRTSCTRL_BIT_BnRTSM(0))))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  for (uint8_t i = 0; Config.filtersEnabled && (i < 6); i++)
+  {
+    if ((Config.filters.filters[i] > MCP2515_FILTER_EXTENDED_BITS) ||
+        ((i < 2) && (Config.filters.masks[i] > MCP2515_FILTER_EXTENDED_BITS)))
+    {
+      this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+      return false;
+    }
+  }
+
+  if (!calculateBitTiming(Config.baudRate, _clockFrequency, Cnf, BitRateError, SamplePoint))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_CHANGE_BITTIMING;
+    return false;
+  }
+
+  uint8_t ReceiveMode = Config.filtersEnabled ? 0x00 : RXBnCTRL_BIT_RXM;
+
+  Snapshot.registers[getCachedRegisterIndex(REG_BFPCTRL)] = Config.rxPinControl;
+  Snapshot.registers[getCachedRegisterIndex(REG_TXRTSCTRL)] = Config.txPinControl;
+  Snapshot.registers[getCachedRegisterIndex(REG_CANCTRL)] = (CachedRegisterReset[getCachedRegisterIndex(REG_CANCTRL)] & (CANCTRL_BIT_CLKEN | CANCTRL_BIT_CLKPRE)) |
+                                                            (Config.operationMode << 5) | (Config.oneShotMode ? CANCTRL_BIT_OSM : 0x00);
+  Snapshot.registers[getCachedRegisterIndex(REG_CNF3)] = Cnf[2];
+  Snapshot.registers[getCachedRegisterIndex(REG_CNF2)] = Cnf[1];
+  Snapshot.registers[getCachedRegisterIndex(REG_CNF1)] = Cnf[0];
+  Snapshot.registers[getCachedRegisterIndex(REG_CANINTE)] = Config.interrupts;
+  Snapshot.registers[getCachedRegisterIndex(REG_RXBnCTRL(0))] = ReceiveMode | (Config.rollover ? RXBnCTRL_BIT_BUFFER0_BUKT : 0x00);
+  Snapshot.registers[getCachedRegisterIndex(REG_RXBnCTRL(1))] = ReceiveMode;
+
+  if (Config.filtersEnabled)
+  {
+    encodeFilters(Config.filters, Snapshot.filters);
+  } else {
+    for (uint8_t i = 0; i < MCP2515_FILTER_REGISTERS; i++)
+    {
+      Snapshot.filters[i] = 0x00;
+    }
+  }
+
+  if (!startInitialization(_clockFrequency, Config.reCheckEnabled))
+  {
+    // Error will be set in startInitialization()
+    return false;
+  }
+
+  this->_baudRate = Config.baudRate;
+  this->_bitRateError = BitRateError;
+  this->_actualSamplePoint = SamplePoint;
+
+  if (!writeConfiguration(Snapshot, Config.filtersEnabled))
+  {
+    this->_isInitialized = false;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_WRITE_CONFIGURATION;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Starts the Initialisation: Resets the MCP2515 and the internal States (same for init() and restoreSnapshot()).
+ *
+ * On success the MCP2515 is in the Configuration-Mode and marked as initialized.
+ * @param ClockFrequency ClockFrequency of the MCP2515
+ * @param reCheckEnabled bool true if after Set-Processes a recheck of setted Values has to be execute
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::startInitialization(uint32_t ClockFrequency, bool reCheckEnabled)
+{
+  if (_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
+    return false;
+  }
+
+  this->_clockFrequency = ClockFrequency;
+
+  this->_reCheckEnabled = reCheckEnabled;
+
+  if (_csPin == 0)
+  {
+    this->_lastMcpError = ERROR_MCP2515_INIT_CS_PIN_NOT_DEFINED;
+    return false;
+  }
+
+  pinMode(_csPin, OUTPUT);
+  this->_isInitialized = true;
+
+  // start SPI
+  SPI.begin();
+
+  // Reset the MCP2515
+  if (!resetInstruction()) {
+    this->_isInitialized = false;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_RESET_FAILED;
+    return false;
+  }
+
+  // After the Reset the One-Shot-Mode is disabled
+  this->_oneShotMode = false;
+
+  // After the Reset the Masks and Filters are unknown
+  this->_filterRegistersValid = false;
+
+  // After the Reset the MCP2515 is not sleeping
+  this->_sleepPreviousMode = 0xFF;
+  this->_wakeUpPending = false;
+  this->_wakeUpLatency = 0;
+
+  // After the Reset the Error-Counters are 0
+  this->_busState = MCP2515_BUS_STATE_ERROR_ACTIVE;
+  this->_transmitErrorCounter = 0;
+  this->_receiveErrorCounter = 0;
+
+  // After the Reset the RX-Buffers are empty, so latched Start-of-Frame-Timestamps are obsolete
+  this->_sofLatchedMask = 0;
+  this->_rxStartOfFrameValid = false;
+
+  // After the Reset no Transmission is pending and the TX-Buffers are empty
+  this->_pendingTransmissions = 0;
+  this->_transmitDeadlineMask = 0;
+#ifdef MCP2515_ENABLE_BUS_LOAD
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    this->_transmitFrameBits[i] = 0;
+  }
+#endif
+
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+  // After the Reset the RX- and TX-Buffers are empty, so started Latency-Measurements are obsolete
+  this->_interruptCaptured = false;
+  this->_rxAvailableMask = 0;
+  this->_transmitEnqueuedMask = 0;
+  this->_transmitStartedMask = 0;
+#endif
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+  // After the Reset the TX-Buffers are empty, so the queued Frames are dropped
+  for (uint8_t i = 0; i < MCP2515_TX_QUEUE_SIZE; i++)
+  {
+    this->_txQueue[i].state = MCP2515_QUEUE_ENTRY_FREE;
+  }
+
+  this->_txQueueCount = 0;
+  this->_txQueueInFlight = 0;
+  this->_txQueuePreempted = 0;
+  this->_txQueueExpired = 0;
+
+  this->_utilizationBits = 0;
+  this->_utilizationStart = micros();
+  this->_utilization = 0;
+#endif
+
+  return true;
+}
+
+/**
+ * @brief Initialize the MCP2515 with an already calculated Bit-Timing (see init()).
+ * @param ClockFrequency ClockFrequency of the MCP2515
+ * @param BaudRate Baudrate of the CAN-Communication
+ * @param Cnf Values of CNF1, CNF2 and CNF3
+ * @param BitRateError Deviation of the Bitrate in ppm
+ * @param SamplePoint Sample-Point in ‰ of the Bittime
+ * @param reCheckEnabled bool true if after Set-Processes a recheck of setted Values has to be execute
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::initialize(uint32_t ClockFrequency, uint32_t BaudRate, const uint8_t Cnf[3], int32_t BitRateError, uint16_t SamplePoint, bool reCheckEnabled)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_INITIALISATION);
+
+  if (!startInitialization(ClockFrequency, reCheckEnabled))
+  {
+    // Error will be set in startInitialization()
+    return false;
+  }
+
+  // Write the Bit-Timing (always, because the Reset clears CNF1 - CNF3)
+  if (!writeBitTiming(Cnf)) {
+    this->_isInitialized = false;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_CHANGE_BITTIMING;
+    return false;
+  }
+
+  this->_baudRate = BaudRate;
+  this->_bitRateError = BitRateError;
+  this->_actualSamplePoint = SamplePoint;
+
+  // Set TXnRTS-Pin to Digital Input
+  if (!modifyTXnRTSPinControl(TXRTSCTRL_BIT_BnRTSM(0) | TXRTSCTRL_BIT_BnRTSM(1) | TXRTSCTRL_BIT_BnRTSM(2), 0x00))
+  {
+    this->_isInitialized = false;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_TX_PIN_CONTROL;
+    return false;
+  }
+
+  // Disable the RXnBF-Pins
+  if (!modifyRXnBFPinControl(BFPCTRL_BIT_BnBFE(0) | BFPCTRL_BIT_BnBFE(1), 0x00))
+  {
+    this->_isInitialized = false;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_RX_PIN_CONTROL;
+    return false;
+  }
+
+  // Disable all Interrupts
+  if (!setCanInterruptEnable(false, false, false, false, false, false, false, false))
+  {
+    this->_isInitialized = false;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_SET_INTERRUPTS;
+    return false;
+  }
+
+  // Set the TX-Buffer empty Flags
+  if (!modifyCanInterruptFlag(0x1C, 0x1C))
+  {
+    this->_isInitialized = false;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_SET_TX_BUFFER_FLAGS;
+    return false;
+  }
+
+  // Disable the Mask und Filter
+  if (!disableFilterMask(0) || !disableFilterMask(1))
+  {
+    this->_isInitialized = false;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INIT_DISABLE_MASKS_FILTERS;
+    return false;
+  }
+
+  // Change to Operation-Mode Normal
+  if (!setNormalMode()) {
+    this->_isInitialized = false;
+    this->_lastMcpError =_lastMcpError | ERROR_MCP2515_INIT_SET_NORMAL_MODE;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Deinitialize the MCP2515.
+ */
+void MCP2515::deinit()
+{
+  this->_isInitialized = false;
+  SPI.end();
+}
+
+/**
+ * @brief Captures the Configuration of the MCP2515 (Configuration-Registers, Masks, Filters and Bit-Timing) into a Snapshot.
+ *
+ * The Registers are read from the Register-Cache, when it's enabled. The Masks and Filters are taken from the programmed Set
+ * (see setFilters()/reprogramFilters()), when it's unknown they are read in the Configuration-Mode (the MCP2515 is shortly off the Bus).
+ * @param Snapshot captured Configuration (see restoreSnapshot())
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::captureSnapshot(MCP2515Snapshot &Snapshot)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_INITIALISATION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  Snapshot.version = MCP2515_SNAPSHOT_VERSION;
+
+  for (uint8_t i = 0; i < MCP2515_CACHED_REGISTERS; i++)
+  {
+    Snapshot.registers[i] = readInstruction(CachedRegisterAddress[i]) & ~CachedRegisterReadOnly[i];
+  }
+
+  // No Abort is restored, the Operation-Mode is the actual one
+  Snapshot.registers[getCachedRegisterIndex(REG_CANCTRL)] = (Snapshot.registers[getCachedRegisterIndex(REG_CANCTRL)] & ~(CANCTRL_BIT_REQOP | CANCTRL_BIT_ABAT)) | (_operationMode << 5);
+
+  if (!_filterRegistersValid)
+  {
+    uint8_t OperationMode = _operationMode;
+
+    if (!setConfigurationMode())
+    {
+      // Error will be set in setConfigurationMode()
+      return false;
+    }
+
+    // Filter 0 - 2, Filter 3 - 5, Mask 0 - 1
+    readInstruction(getFilterRegisterAddress(0), &_filterRegisters[0], 12);
+    readInstruction(getFilterRegisterAddress(12), &_filterRegisters[12], 12);
+    readInstruction(getFilterRegisterAddress(24), &_filterRegisters[24], 8);
+
+    this->_filterRegistersValid = true;
+
+    if (!setOperationMode(OperationMode))
+    {
+      // Error will be set in setOperationMode()
+      return false;
+    }
+  }
+
+  for (uint8_t i = 0; i < MCP2515_FILTER_REGISTERS; i++)
+  {
+    Snapshot.filters[i] = _filterRegisters[i];
+  }
+
+  Snapshot.clockFrequency = _clockFrequency;
+  Snapshot.baudRate = _baudRate;
+  Snapshot.bitRateError = _bitRateError;
+  Snapshot.samplePoint = _actualSamplePoint;
+  Snapshot.checksum = calculateSnapshotChecksum(Snapshot);
+
+  return true;
+}
+
+/**
+ * @brief Initialize the MCP2515 with the Configuration of a Snapshot (e.g. after a Brown-Out or Watchdog-Reset).
+ *
+ * Instead of init() and the following Settings, the whole Configuration is written after the Reset with 3 sequential and
+ * 3 single Write-Instructions. When the Recheck is enabled it's verified with one sequential Read (and RXB0CTRL/RXB1CTRL) before the
+ * Operation-Mode of the Snapshot is requested.
+ * @param Snapshot Configuration (see captureSnapshot())
+ * @param ReadyTime Time in µs from the Reset until the MCP2515 is in the Operation-Mode of the Snapshot
+ * @param reCheckEnabled bool true if after Set-Processes a recheck of setted Values has to be execute
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::restoreSnapshot(const MCP2515Snapshot &Snapshot, uint32_t &ReadyTime, bool reCheckEnabled)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_INITIALISATION);
+
+  uint32_t Start = micros();
+
+  ReadyTime = 0;
+
+  if (_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_IS_INITIALIZED;
+    return false;
+  }
+
+  if ((Snapshot.version != MCP2515_SNAPSHOT_VERSION) ||
+      (Snapshot.checksum != calculateSnapshotChecksum(Snapshot)) ||
+      (Snapshot.clockFrequency < MCP2515_MIN_CLOCK_FREQUENCY) ||
+      (Snapshot.clockFrequency > MCP2515_MAX_CLOCK_FREQUENCY) ||
+      (Snapshot.baudRate < MCP2515_MIN_BAUDRATE) ||
+      (Snapshot.baudRate > MCP2515_MAX_BAUDRATE) ||
+      (((Snapshot.registers[getCachedRegisterIndex(REG_CANCTRL)] & CANCTRL_BIT_REQOP) >> 5) > MCP2515_OP_CONFIGURATION))
+  {
+    this->_lastMcpError = ERROR_MCP2515_SNAPSHOT_NOT_VALID;
+    return false;
+  }
+
+  if (!startInitialization(Snapshot.clockFrequency, reCheckEnabled))
+  {
+    // Error will be set in startInitialization()
+    return false;
+  }
+
+  this->_baudRate = Snapshot.baudRate;
+  this->_bitRateError = Snapshot.bitRateError;
+  this->_actualSamplePoint = Snapshot.samplePoint;
+
+  if (!writeConfiguration(Snapshot, true))
+  {
+    this->_isInitialized = false;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_RESTORE_SNAPSHOT;
+    return false;
+  }
+
+  ReadyTime = micros() - Start;
+
+  return true;
+}
+
+/**
+ * @brief Writes the Configuration of a Snapshot in the Configuration-Mode (after the Reset) and requests its Operation-Mode.
+ *
+ * Register-Blocks: Filter 0 - 2, BFPCTRL, TXRTSCTRL (0x00 - 0x0D); Filter 3 - 5 (0x10 - 0x1B);
+ * Mask 0 - 1, CNF3, CNF2, CNF1, CANINTE, CANINTF (0x20 - 0x2C). CANINTF is written with the set TX-Buffer empty Flags.
+ *
+ * Without the Masks and Filters only BFPCTRL, TXRTSCTRL (0x0C - 0x0D) and CNF3, CNF2, CNF1, CANINTE, CANINTF (0x28 - 0x2C) are written.
+ * The Recheck reads the whole Range up to CANINTE with one sequential Read (and RXB0CTRL/RXB1CTRL).
+ * @param Snapshot Configuration
+ * @param Filters true = the Masks and Filters of the Snapshot are written
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::writeConfiguration(const MCP2515Snapshot &Snapshot, bool Filters)
+{
+  uint8_t CanControlIndex = getCachedRegisterIndex(REG_CANCTRL);
+  uint8_t OperationMode = (Snapshot.registers[CanControlIndex] & CANCTRL_BIT_REQOP) >> 5;
+  uint8_t CanControl = (Snapshot.registers[CanControlIndex] & ~(CANCTRL_BIT_REQOP | CANCTRL_BIT_ABAT)) | (MCP2515_OP_CONFIGURATION << 5);
+  uint8_t First = Filters ? REG_RXFnSIDH(0) : REG_BFPCTRL;
+  uint8_t Block[14];
+
+  // (Filter 0 - 2,) BFPCTRL, TXRTSCTRL
+  for (uint8_t i = 0; i < 12; i++)
+  {
+    Block[i] = Snapshot.filters[i];
+  }
+  Block[12] = Snapshot.registers[getCachedRegisterIndex(REG_BFPCTRL)];
+  Block[13] = Snapshot.registers[getCachedRegisterIndex(REG_TXRTSCTRL)];
+
+  if (!writeInstruction(First, &Block[First], 14 - First))
+  {
+    return false;
+  }
+
+  // Filter 3 - 5
+  if (Filters && !writeInstruction(REG_RXFnSIDH(3), &Snapshot.filters[12], 12))
+  {
+    return false;
+  }
+
+  // (Mask 0 - 1,) CNF3, CNF2, CNF1, CANINTE, CANINTF
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    Block[i] = Snapshot.filters[24 + i];
+  }
+  Block[8] = Snapshot.registers[getCachedRegisterIndex(REG_CNF3)];
+  Block[9] = Snapshot.registers[getCachedRegisterIndex(REG_CNF2)];
+  Block[10] = Snapshot.registers[getCachedRegisterIndex(REG_CNF1)];
+  Block[11] = Snapshot.registers[getCachedRegisterIndex(REG_CANINTE)];
+  Block[12] = CANINTF_BIT_TXnIF(0) | CANINTF_BIT_TXnIF(1) | CANINTF_BIT_TXnIF(2);
+
+  if (!writeInstruction(Filters ? REG_RXMnSIDH(0) : REG_CNF3, Filters ? &Block[0] : &Block[8], Filters ? 13 : 5))
+  {
+    return false;
+  }
+
+  writeInstruction(REG_RXBnCTRL(0), Snapshot.registers[getCachedRegisterIndex(REG_RXBnCTRL(0))]);
+  writeInstruction(REG_RXBnCTRL(1), Snapshot.registers[getCachedRegisterIndex(REG_RXBnCTRL(1))]);
+  writeInstruction(REG_CANCTRL, CanControl);
+
+  // Verify still in the Configuration-Mode, because the Mask- and Filter-Registers read all '0's in any other Mode
+  if (_reCheckEnabled)
+  {
+    MCP2515_COUNT_READBACK();
+    uint8_t Readback[REG_CANINTF];
+
+    readInstruction(First, &Readback[First], REG_CANINTF - First);
+
+    for (uint8_t i = 0; Filters && (i < MCP2515_FILTER_REGISTERS); i++)
+    {
+      if (Readback[getFilterRegisterAddress(i)] != Snapshot.filters[i])
+      {
+        this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
+        return false;
+      }
+    }
+
+    for (uint8_t i = 0; i < MCP2515_CACHED_REGISTERS; i++)
+    {
+      uint8_t Expected = (i == CanControlIndex) ? CanControl : Snapshot.registers[i];
+      uint8_t Value = (CachedRegisterAddress[i] < REG_CANINTF) ? Readback[CachedRegisterAddress[i]] : readInstruction(CachedRegisterAddress[i]);
+
+      if (((Value ^ Expected) & ~CachedRegisterReadOnly[i]) != 0x00)
+      {
+        this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET;
+        return false;
+      }
+    }
+  }
+
+  if (Filters)
+  {
+    for (uint8_t i = 0; i < MCP2515_FILTER_REGISTERS; i++)
+    {
+      this->_filterRegisters[i] = Snapshot.filters[i];
+    }
+
+    this->_filterRegistersValid = true;
+  }
+
+  this->_oneShotMode = (CanControl & CANCTRL_BIT_OSM) == CANCTRL_BIT_OSM;
+
+  if (OperationMode != MCP2515_OP_CONFIGURATION)
+  {
+    return requestOperationMode(OperationMode);
+  }
+
+  return true;
+}
+
+/**
+ * @brief Calculates the Checksum of a Snapshot (inverted Sum of all Bytes of the Values).
+ * @param Snapshot Snapshot
+ * @return Checksum
+ */
+uint8_t MCP2515::calculateSnapshotChecksum(const MCP2515Snapshot &Snapshot)
+{
+  uint8_t Sum = Snapshot.version;
+
+  for (uint8_t i = 0; i < MCP2515_CACHED_REGISTERS; i++)
+  {
+    Sum = Sum + Snapshot.registers[i];
+  }
+
+  for (uint8_t i = 0; i < MCP2515_FILTER_REGISTERS; i++)
+  {
+    Sum = Sum + Snapshot.filters[i];
+  }
+
+  for (uint8_t i = 0; i < 32; i = i + 8)
+  {
+    Sum = Sum + (uint8_t)(Snapshot.clockFrequency >> i) + (uint8_t)(Snapshot.baudRate >> i) + (uint8_t)((uint32_t)Snapshot.bitRateError >> i);
+  }
+
+  Sum = Sum + (uint8_t)Snapshot.samplePoint + (uint8_t)(Snapshot.samplePoint >> 8);
+
+  return ~Sum;
+}
+
+/**
+ * @brief Changing the Baudrate.
+ * @param targetBaudrate Baudrate (1E3 - 1000E3), e.g. also 33.3E3, 83.3E3 or 666E3
+ * @return true when success, false on any error (Check _lastMcpError)
+ * @note If a Baudrate is allowed depends on the ClockFrequency and the max. Deviation of the Bitrate (see setMaxBitRateError()).
+ */
+bool MCP2515::changeBaudRate(uint32_t targetBaudRate)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (targetBaudRate != _baudRate)
+  {
+    if (!changeBitTiming(targetBaudRate, _clockFrequency))
+    {
+      // Error will be set in changeBitTiming()
+      return false;
+    }
+    this->_baudRate = targetBaudRate;
+  }
+  return true;
+}
+
+/**
+ * @brief Detects the Baudrate of the Bus in the Listen-Only-Mode.
+ *
+ * For each Candidate the Bit-Timing is calculated (see calculateBitTiming()) and the Interrupt-Flags MERRF and RXnIF are counted.
+ * A Candidate is accepted after MCP2515_AUTOBAUD_MIN_FRAMES valid Frames (more Frames than Errors) and
+ * rejected after MCP2515_AUTOBAUD_MAX_ERRORS Errors (at least as many Errors as Frames) or when no Event occurs within the Window
+ * (at least the Time of two Frames at the Candidate). Independent of the Events a Candidate is tried at most
+ * (MCP2515_AUTOBAUD_MIN_FRAMES + MCP2515_AUTOBAUD_MAX_ERRORS) Windows. The actual Baudrate is tried first, when it's one of the Candidates.
+ *
+ * The received Frames are discarded. Afterwards the previous Operation-Mode is restored
+ * (when no Baudrate is detected also with the previous Bit-Timing).
+ * @note Doc p. 59; Kap. 10.3 - At least two other Nodes have to communicate on the Bus.
+ * @param Candidates possible Baudrates ordered by their Likelihood
+ * @param Count Number of Candidates
+ * @param BaudRate detected Baudrate (0 when no Baudrate is detected)
+ * @param Duration Time of the Detection in µs
+ * @param Window max. Time without Event per Candidate in µs
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::detectBaudRate(const uint32_t Candidates[], uint8_t Count, uint32_t &BaudRate, uint32_t &Duration, uint32_t Window)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  uint32_t Start = micros();
+
+  BaudRate = 0;
+  Duration = 0;
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if ((Count == 0) || (Window == 0))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  uint8_t OperationMode = _operationMode;
+  uint8_t PreviousCnf[3] = {getConfigurationRegister1(), getConfigurationRegister2(), getConfigurationRegister3()};
+  uint8_t First = 0;
+
+  for (uint8_t i = 0; i < Count; i++)
+  {
+    if (Candidates[i] == _baudRate)
+    {
+      First = i;
+      break;
+    }
+  }
+
+  if (!setListenOnlyMode())
+  {
+    // Error will be set in setListenOnlyMode()
+    return false;
+  }
+
+  for (uint8_t Try = 0; Try < Count; Try++)
+  {
+    // The actual Baudrate first, afterwards the Order of the Candidates
+    uint8_t Index = (Try == 0) ? First : ((Try <= First) ? (Try - 1) : Try);
+    uint8_t Cnf[3];
+    int32_t BitRateError = 0;
+    uint16_t SamplePoint = 0;
+
+    if (!calculateBitTiming(Candidates[Index], _clockFrequency, Cnf, BitRateError, SamplePoint))
+    {
+      // Not possible with this ClockFrequency
+      continue;
+    }
+
+    if (!writeBitTiming(Cnf) ||
+        !modifyCanInterruptFlag(CANINTF_BIT_MERRF | CANINTF_BIT_RXnIF(0) | CANINTF_BIT_RXnIF(1), 0x00))
+    {
+      // Error will be set in writeBitTiming() or modifyCanInterruptFlag()
+      return false;
+    }
+
+    uint16_t Frames = 0;
+    uint16_t Errors = 0;
+    uint32_t CandidateWindow = Window;
+    uint32_t CandidateStart = micros();
+    uint32_t WindowStart = CandidateStart;
+
+    // At low Baudrates the Window covers at least two Frames
+    if (CandidateWindow < ((2UL * MCP2515_MAX_FRAME_BITS * 1000000UL) / Candidates[Index]))
+    {
+      CandidateWindow = (2UL * MCP2515_MAX_FRAME_BITS * 1000000UL) / Candidates[Index];
+    }
+
+    // Hard Limit: enough Windows for the Events of a Decision, not restarted by the Events
+    uint32_t CandidateLimit = CandidateWindow * (MCP2515_AUTOBAUD_MIN_FRAMES + MCP2515_AUTOBAUD_MAX_ERRORS);
+
+    while (((micros() - WindowStart) < CandidateWindow) &&
+           ((micros() - CandidateStart) < CandidateLimit))
+    {
+      uint8_t Flags = getCanInterruptFlag() & (CANINTF_BIT_MERRF | CANINTF_BIT_RXnIF(0) | CANINTF_BIT_RXnIF(1));
+
+      if (Flags == 0x00)
+      {
+        continue;
+      }
+
+      // Each Event restarts the Window
+      WindowStart = micros();
+
+      Errors = Errors + ((Flags & CANINTF_BIT_MERRF) ? 1 : 0);
+      Frames = Frames + ((Flags & CANINTF_BIT_RXnIF(0)) ? 1 : 0) + ((Flags & CANINTF_BIT_RXnIF(1)) ? 1 : 0);
+
+      modifyCanInterruptFlag(Flags, 0x00);
+
+      if ((Frames >= MCP2515_AUTOBAUD_MIN_FRAMES) && (Frames > Errors))
+      {
+        this->_baudRate = Candidates[Index];
+        this->_bitRateError = BitRateError;
+        this->_actualSamplePoint = SamplePoint;
+
+        BaudRate = Candidates[Index];
+
+        if (!setOperationMode(OperationMode))
+        {
+          // Error will be set in setOperationMode()
+          return false;
+        }
+
+        Duration = micros() - Start;
+        return true;
+      }
+
+      if ((Errors >= MCP2515_AUTOBAUD_MAX_ERRORS) && (Errors >= Frames))
+      {
+        break;
+      }
+    }
+  }
+
+  // Restore the previous Bit-Timing and Operation-Mode
+  if (!writeBitTiming(PreviousCnf) || !setOperationMode(OperationMode))
+  {
+    // Error will be set in writeBitTiming() or setOperationMode()
+    return false;
+  }
+
+  Duration = micros() - Start;
+
+  this->_lastMcpError = ERROR_MCP2515_BAUDRATE_NOT_DETECTED;
+  return false;
+}
+
+/**
+ * @brief Detects the Baudrate of the Bus in the Listen-Only-Mode with the usual Baudrates as Candidates
+ * (500k, 250k, 125k, 1000k, 100k, 50k, 20k, 10k, 83.3k, 33.3k, 800k, 666.6k, 200k, 5k).
+ * @param BaudRate detected Baudrate (0 when no Baudrate is detected)
+ * @param Duration Time of the Detection in µs
+ * @param Window max. Time without Event per Candidate in µs
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::detectBaudRate(uint32_t &BaudRate, uint32_t &Duration, uint32_t Window)
+{
+  return detectBaudRate(AutoBaudCandidates, sizeof(AutoBaudCandidates) / sizeof(AutoBaudCandidates[0]), BaudRate, Duration, Window);
+}
+
+/**
+ * @brief Set the target Sample-Point of the Bit-Timing.
+ * @note The Sample-Point is used with the next Change of the Baudrate (see changeBaudRate() or init()).
+ * @param SamplePoint Sample-Point in ‰ of the Bittime (500 - 950, e.g. 875 according to CiA 301)
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setSamplePoint(uint16_t SamplePoint)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  if ((SamplePoint < 500) || (SamplePoint > 950))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  this->_samplePoint = SamplePoint;
+  return true;
+}
+
+/**
+ * @brief Set the max. allowed Deviation of the Bitrate.
+ * @note The Deviation is used with the next Change of the Baudrate (see changeBaudRate() or init()).
+ * @param MaxBitRateError max. Deviation in ppm (0 - 50000)
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setMaxBitRateError(uint32_t MaxBitRateError)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  if (MaxBitRateError > 50000)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  this->_maxBitRateError = MaxBitRateError;
+  return true;
+}
+
+/**
+ * @brief Enable/Disable an Interrupt.
  * @param value bool
  *
- * True = Enable Interrupt
+ * True = Enable Interrupt
+ *
+ * False = Disable Interrupt
+ * @param Interrupt 0 - 7
+ *
+ * 7 = MERRE - Message Error Interrupt
+ *
+ * 6 = WAKIE - Wake-up Interrupt
+ *
+ * 5 = ERRIE - Error Interrupt (multiple sources in EFLG register)
+ *
+ * 4 = TX2IE - Transmit Buffer 2 Empty Interrupt
+ *
+ * 3 = TX1IE - Transmit Buffer 1 Empty Interrupt
+ *
+ * 2 = TX0IE - Transmit Buffer 0 Empty Interrupt
+ *
+ * 1 = RX1IE - Receive Buffer 1 Full Interrupt
+ *
+ * 0 = RX0IE - Receive Buffer 0 Full Interrupt
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::changeInterruptSetting(bool value, uint8_t Interrupt)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if ((Interrupt > 7) ||
+      (value != false && value != true))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  uint8_t InterruptBit = 0x01 << Interrupt;
+
+  uint8_t EnablerValue = (value) ? InterruptBit : 0x00;
+
+  if (!modifyCanInterruptEnable(InterruptBit, EnablerValue))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CHANGE_INTERRUPT;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Enables the Filter/Mask for the given Receive-Buffer.
+ * @param buffer Receive-Buffer-Number (0 - 1)
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::enableFilterMask(uint8_t buffer)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_FILTER);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (buffer > 1)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  switch (buffer)
+  {
+  case 0:
+    return modifyReceiveBuffer0Control(RXBnCTRL_BIT_RXM, 0x00);
+    break;
+  case 1:
+    return modifyReceiveBuffer1Control(RXBnCTRL_BIT_RXM, 0x00);
+    break;
+  default:
+    this->_lastMcpError = ERROR_MCP2515_UNKNOWN_SWITCH;
+    return false;
+    break;
+  }
+}
+
+/**
+ * @brief Disables the Filter/Mask for the given Receive-Buffer.
+ * @param buffer Receive-Buffer-Number (0 - 1)
+ * @return true when success, false on any error
+ */
+bool MCP2515::disableFilterMask(uint8_t buffer)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_FILTER);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (buffer > 1)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  switch (buffer)
+  {
+  case 0:
+    return modifyReceiveBuffer0Control(RXBnCTRL_BIT_RXM, RXBnCTRL_BIT_RXM);
+    break;
+  case 1:
+    return modifyReceiveBuffer1Control(RXBnCTRL_BIT_RXM, RXBnCTRL_BIT_RXM);
+    break;
+  default:
+    this->_lastMcpError = ERROR_MCP2515_UNKNOWN_SWITCH;
+    return false;
+    break;
+  }
+}
+
+/**
+ * @brief Calculates Masks and Filters which accept all wanted IDs and as few not wanted IDs as possible.
+ *
+ * The IDs are clustered greedily (always the two Clusters of the same Frame-Type whose Merge adds the fewest accepted IDs)
+ * until 6 Clusters remain. Then the Clusters are distributed to the RX-Buffers (max. 2 for Mask 0, max. 4 for Mask 1)
+ * with the fewest accepted IDs. Unused Filters repeat a Filter of the same RX-Buffer.
+ *
+ * For Standard-Frames the Mask-Bits of Extended-ID[17:0] are cleared, because the MCP2515 applies them to the first two Data-Bytes.
+ * @note Doc p. 33; Kap. 4.5
+ * @param Ids wanted IDs
+ * @param Extended true = the ID is an Extended-ID
+ * @param Count Number of IDs (1 - MCP2515_MAX_FILTER_IDS)
+ * @param Config calculated Masks and Filters incl. the expected false Accepts
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::compileFilters(const uint32_t Ids[], const bool Extended[], uint8_t Count, MCP2515FilterConfig &Config)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_FILTER);
+
+  if ((Count == 0) || (Count > MCP2515_MAX_FILTER_IDS))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  // Clusters in the Register-Layout: Value = common Bits, Diff = Bits which differ inside the Cluster
+  uint32_t Value[MCP2515_MAX_FILTER_IDS];
+  uint32_t Diff[MCP2515_MAX_FILTER_IDS];
+  bool IsExtended[MCP2515_MAX_FILTER_IDS];
+  uint8_t Clusters = 0;
+  uint8_t WantedStandard = 0;
+  uint8_t WantedExtended = 0;
+
+  for (uint8_t i = 0; i < Count; i++)
+  {
+    if ((Ids[i] > 0x1FFFFFFF) ||
+        (!Extended[i] && Ids[i] > 0x7FF))
+    {
+      this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+      return false;
+    }
+
+    uint32_t Key = Extended[i] ? Ids[i] : (Ids[i] << 18);
+    bool Duplicate = false;
+
+    for (uint8_t j = 0; j < Clusters; j++)
+    {
+      Duplicate = Duplicate || ((Value[j] == Key) && (IsExtended[j] == Extended[i]));
+    }
+
+    if (!Duplicate)
+    {
+      Value[Clusters] = Key;
+      Diff[Clusters] = 0;
+      IsExtended[Clusters] = Extended[i];
+      Clusters++;
+
+      if (Extended[i])
+      {
+        WantedExtended++;
+      } else {
+        WantedStandard++;
+      }
+    }
+  }
+
+  // A wanted ID for RX-Buffers without own Cluster
+  uint32_t FirstValue = Value[0];
+  bool FirstExtended = IsExtended[0];
+
+  // Merge the two Clusters (same Frame-Type) which add the fewest accepted IDs
+  while (Clusters > 6)
+  {
+    uint8_t BestA = 0;
+    uint8_t BestB = 0;
+    uint32_t BestCost = 0xFFFFFFFF;
+
+    for (uint8_t a = 0; a < Clusters; a++)
+    {
+      for (uint8_t b = a + 1; b < Clusters; b++)
+      {
+        if (IsExtended[a] != IsExtended[b])
+        {
+          continue;
+        }
+
+        // Added IDs = merged Cluster minus the Union of both Clusters (nested or overlapping Clusters share IDs)
+        uint32_t Merged = Diff[a] | Diff[b] | (Value[a] ^ Value[b]);
+        uint32_t Covered = (1UL << __builtin_popcountl(Diff[a])) + (1UL << __builtin_popcountl(Diff[b]));
+
+        if (((Value[a] ^ Value[b]) & ~(Diff[a] | Diff[b])) == 0)
+        {
+          Covered = Covered - (1UL << __builtin_popcountl(Diff[a] & Diff[b]));
+        }
+
+        uint32_t Full = 1UL << __builtin_popcountl(Merged);
+        uint32_t Cost = (Full > Covered) ? (Full - Covered) : 0;
+
+        if (Cost < BestCost)
+        {
+          BestCost = Cost;
+          BestA = a;
+          BestB = b;
+        }
+      }
+    }
+
+    Diff[BestA] = Diff[BestA] | Diff[BestB] | (Value[BestA] ^ Value[BestB]);
+    Value[BestA] = Value[BestA] & ~Diff[BestA];
+
+    Clusters--;
+    Value[BestB] = Value[Clusters];
+    Diff[BestB] = Diff[Clusters];
+    IsExtended[BestB] = IsExtended[Clusters];
+  }
+
+  // Distribute the Clusters to the RX-Buffers: Bit n of Buffer0 = Cluster n uses Mask 0
+  uint8_t BestBuffer0 = 0;
+  uint32_t BestAccepted = 0xFFFFFFFF;
+  uint32_t BufferDiff[2];
+
+  for (uint8_t Buffer0 = 0; Buffer0 < (1 << Clusters); Buffer0++)
+  {
+    uint8_t InBuffer0 = __builtin_popcount(Buffer0);
+
+    if ((InBuffer0 > 2) || ((Clusters - InBuffer0) > 4))
+    {
+      continue;
+    }
+
+    BufferDiff[0] = 0;
+    BufferDiff[1] = 0;
+
+    for (uint8_t c = 0; c < Clusters; c++)
+    {
+      uint8_t Buffer = (Buffer0 & (1 << c)) ? 0 : 1;
+      BufferDiff[Buffer] = BufferDiff[Buffer] | Diff[c] | (IsExtended[c] ? 0 : 0x3FFFF);
+    }
+
+    uint32_t Accepted = 0;
+
+    for (uint8_t c = 0; c < Clusters; c++)
+    {
+      uint8_t Buffer = (Buffer0 & (1 << c)) ? 0 : 1;
+      Accepted = Accepted + (1UL << __builtin_popcountl(BufferDiff[Buffer] & (IsExtended[c] ? MCP2515_FILTER_EXTENDED_BITS : MCP2515_FILTER_STANDARD_BITS)));
+    }
+
+    if (Accepted < BestAccepted)
+    {
+      BestAccepted = Accepted;
+      BestBuffer0 = Buffer0;
+    }
+  }
+
+  // Build Masks and Filters
+  uint8_t Used[2] = {0, 0};
+  const uint8_t FirstFilter[2] = {0, 2};
+  const uint8_t FilterCount[2] = {2, 4};
+
+  BufferDiff[0] = 0;
+  BufferDiff[1] = 0;
+
+  for (uint8_t c = 0; c < Clusters; c++)
+  {
+    uint8_t Buffer = (BestBuffer0 & (1 << c)) ? 0 : 1;
+    BufferDiff[Buffer] = BufferDiff[Buffer] | Diff[c] | (IsExtended[c] ? 0 : 0x3FFFF);
+  }
+
+  for (uint8_t Buffer = 0; Buffer < 2; Buffer++)
+  {
+    Config.masks[Buffer] = ~BufferDiff[Buffer] & MCP2515_FILTER_EXTENDED_BITS;
+  }
+
+  for (uint8_t c = 0; c < Clusters; c++)
+  {
+    uint8_t Buffer = (BestBuffer0 & (1 << c)) ? 0 : 1;
+    uint8_t Filter = FirstFilter[Buffer] + Used[Buffer];
+
+    Config.filters[Filter] = Value[c] & Config.masks[Buffer];
+    Config.extended[Filter] = IsExtended[c];
+    Used[Buffer]++;
+  }
+
+  for (uint8_t Buffer = 0; Buffer < 2; Buffer++)
+  {
+    if (Used[Buffer] == 0)
+    {
+      // RX-Buffer without Cluster: only a wanted ID is accepted
+      Config.masks[Buffer] = FirstExtended ? MCP2515_FILTER_EXTENDED_BITS : MCP2515_FILTER_STANDARD_BITS;
+      Config.filters[FirstFilter[Buffer]] = FirstValue;
+      Config.extended[FirstFilter[Buffer]] = FirstExtended;
+      Used[Buffer] = 1;
+    }
+
+    for (uint8_t f = Used[Buffer]; f < FilterCount[Buffer]; f++)
+    {
+      Config.filters[FirstFilter[Buffer] + f] = Config.filters[FirstFilter[Buffer]];
+      Config.extended[FirstFilter[Buffer] + f] = Config.extended[FirstFilter[Buffer]];
+    }
+  }
+
+  // Count the accepted IDs per Frame-Type (Union of the Filters)
+  uint32_t Care[6];
+  uint32_t FilterValue[6];
+  uint32_t AcceptedIds = 0;
+  uint32_t NotWanted = 0;
+
+  for (uint8_t Type = 0; Type < 2; Type++)
+  {
+    uint8_t Filters = 0;
+    uint32_t Bits = Type ? MCP2515_FILTER_EXTENDED_BITS : MCP2515_FILTER_STANDARD_BITS;
+
+    for (uint8_t f = 0; f < 6; f++)
+    {
+      if (Config.extended[f] == (Type == 1))
+      {
+        Care[Filters] = Config.masks[(f < 2) ? 0 : 1] & Bits;
+        FilterValue[Filters] = Config.filters[f] & Care[Filters];
+        Filters++;
+      }
+    }
+
+    AcceptedIds = AcceptedIds + countFilterMatches(Care, FilterValue, Filters, Type ? 29 : 11);
+  }
+
+  if (WantedStandard > 0)
+  {
+    NotWanted = NotWanted + 2048 - WantedStandard;
+  }
+
+  if (WantedExtended > 0)
+  {
+    NotWanted = NotWanted + 0x20000000UL - WantedExtended;
+  }
+
+  Config.falseAccepts = AcceptedIds - (WantedStandard + WantedExtended);
+  Config.falseAcceptRate = (NotWanted > 0) ? (uint32_t)(((uint64_t)Config.falseAccepts * 1000000ULL) / NotWanted) : 0;
+
+  return true;
+}
+
+/**
+ * @brief Programs the Masks and Filters and enables the Acceptance-Filter of both RX-Buffers.
+ *
+ * The MCP2515 is set into the Configuration-Mode and afterwards back into the previous Operation-Mode
+ * (also when the Masks and Filters could not be written).
+ * @param Config Masks and Filters (see compileFilters())
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setFilters(const MCP2515FilterConfig &Config)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_FILTER);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  for (uint8_t i = 0; i < 6; i++)
+  {
+    if ((Config.filters[i] > MCP2515_FILTER_EXTENDED_BITS) ||
+        ((i < 2) && (Config.masks[i] > MCP2515_FILTER_EXTENDED_BITS)))
+    {
+      this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+      return false;
+    }
+  }
+
+  uint8_t OperationMode = _operationMode;
+
+  if (!setConfigurationMode())
+  {
+    // Error will be set in setConfigurationMode()
+    return false;
+  }
+
+  // Until all Writes are done the programmed Set is unknown
+  this->_filterRegistersValid = false;
+
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    if (!writeMask(i, Config.masks[i]))
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_SET_FILTERS;
+      restoreOperationMode(OperationMode);
+      return false;
+    }
+  }
+
+  for (uint8_t i = 0; i < 6; i++)
+  {
+    if (!writeFilter(i, Config.filters[i], Config.extended[i]))
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_SET_FILTERS;
+      restoreOperationMode(OperationMode);
+      return false;
+    }
+  }
+
+  if (!modifyReceiveBuffer0Control(RXBnCTRL_BIT_RXM, 0x00) ||
+      !modifyReceiveBuffer1Control(RXBnCTRL_BIT_RXM, 0x00))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_SET_FILTERS;
+    restoreOperationMode(OperationMode);
+    return false;
+  }
+
+  // Programmed Set for reprogramFilters()
+  encodeFilters(Config, _filterRegisters);
+  this->_filterRegistersValid = true;
+
+  return setOperationMode(OperationMode);
+}
+
+/**
+ * @brief Changes the programmed Masks and Filters with as short as possible Time in the Configuration-Mode.
+ *
+ * Only the Registers which differ from the programmed Set (last setFilters()/reprogramFilters()) are written, grouped into sequential Write-Instructions.
+ * When the programmed Set is unknown (e.g. after init()) all Registers are written.
+ * When the Recheck is enabled each sequential Write is verified with one sequential Read (still in the Configuration-Mode,
+ * because the Mask- and Filter-Registers read all '0's in any other Mode).
+ * After the previous Operation-Mode is restored the Acceptance-Filter of both RX-Buffers is enabled.
+ * On an error the previous Operation-Mode is restored as well and the programmed Set stays unknown.
+ * @param Config Masks and Filters (see compileFilters())
+ * @param OffBusTime Time in µs the MCP2515 was in the Configuration-Mode (0 when no Register changed)
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::reprogramFilters(const MCP2515FilterConfig &Config, uint32_t &OffBusTime)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_FILTER);
+
+  OffBusTime = 0;
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  for (uint8_t i = 0; i < 6; i++)
+  {
+    if ((Config.filters[i] > MCP2515_FILTER_EXTENDED_BITS) ||
+        ((i < 2) && (Config.masks[i] > MCP2515_FILTER_EXTENDED_BITS)))
+    {
+      this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+      return false;
+    }
+  }
+
+  uint8_t Registers[MCP2515_FILTER_REGISTERS];
+  bool Changed[MCP2515_FILTER_REGISTERS];
+  bool AnyChanged = false;
+
+  encodeFilters(Config, Registers);
+
+  for (uint8_t i = 0; i < MCP2515_FILTER_REGISTERS; i++)
+  {
+    Changed[i] = !_filterRegistersValid || (Registers[i] != _filterRegisters[i]);
+    AnyChanged = AnyChanged || Changed[i];
+  }
+
+  if (AnyChanged)
+  {
+    uint8_t OperationMode = _operationMode;
+    uint32_t Start = micros();
+
+    if (!setConfigurationMode())
+    {
+      // Error will be set in setConfigurationMode()
+      return false;
+    }
+
+    // Until all Writes are done the programmed Set is unknown
+    this->_filterRegistersValid = false;
+
+    uint8_t i = 0;
+
+    while (i < MCP2515_FILTER_REGISTERS)
+    {
+      if (!Changed[i])
+      {
+        i++;
+        continue;
+      }
+
+      // Sequential Write inside the Register-Block; up to 2 unchanged Registers are rewritten instead of starting a new Instruction
+      uint8_t First = i;
+      uint8_t Last = i;
+
+      for (uint8_t j = i + 1; (j < MCP2515_FILTER_REGISTERS) && (getFilterRegisterAddress(j) == getFilterRegisterAddress(j - 1) + 1); j++)
+      {
+        if (Changed[j])
+        {
+          Last = j;
+        } else if ((j - Last) > 2) {
+          break;
+        }
+      }
+
+      uint8_t Length = Last - First + 1;
+
+      if (!writeInstruction(getFilterRegisterAddress(First), &Registers[First], Length))
+      {
+        this->_lastMcpError = _lastMcpError | ERROR_MCP2515_SET_FILTERS;
+        restoreOperationMode(OperationMode);
+        return false;
+      }
+
+      if (_reCheckEnabled)
+      {
+        MCP2515_COUNT_READBACK();
+        uint8_t Readback[MCP2515_FILTER_REGISTERS];
+
+        if (!readInstruction(getFilterRegisterAddress(First), Readback, Length))
+        {
+          this->_lastMcpError = _lastMcpError | ERROR_MCP2515_SET_FILTERS;
+          restoreOperationMode(OperationMode);
+          return false;
+        }
+
+        for (uint8_t k = 0; k < Length; k++)
+        {
+          if (Readback[k] != Registers[First + k])
+          {
+            this->_lastMcpError = ERROR_MCP2515_VALUE_NOT_SET | ERROR_MCP2515_SET_FILTERS;
+            restoreOperationMode(OperationMode);
+            return false;
+          }
+        }
+      }
+
+      i = Last + 1;
+    }
+
+    for (uint8_t k = 0; k < MCP2515_FILTER_REGISTERS; k++)
+    {
+      this->_filterRegisters[k] = Registers[k];
+    }
+
+    this->_filterRegistersValid = true;
+
+    if (!setOperationMode(OperationMode))
+    {
+      // Error will be set in setOperationMode()
+      return false;
+    }
+
+    OffBusTime = micros() - Start;
+  }
+
+  if (!modifyReceiveBuffer0Control(RXBnCTRL_BIT_RXM, 0x00) ||
+      !modifyReceiveBuffer1Control(RXBnCTRL_BIT_RXM, 0x00))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_SET_FILTERS;
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Calculates (see compileFilters()) and programs (see setFilters()) the Masks and Filters for the wanted IDs.
+ * @param Ids wanted IDs
+ * @param Extended true = the ID is an Extended-ID
+ * @param Count Number of IDs (1 - MCP2515_MAX_FILTER_IDS)
+ * @param Config programmed Masks and Filters incl. the expected false Accepts
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setAcceptedIds(const uint32_t Ids[], const bool Extended[], uint8_t Count, MCP2515FilterConfig &Config)
+{
+  if (!compileFilters(Ids, Extended, Count, Config))
+  {
+    // Error will be set in compileFilters()
+    return false;
+  }
+
+  return setFilters(Config);
+}
+
+/**
+ * @brief Enable or disable the One-Shot-Mode for all Transmissions.
+ *
+ * In One-Shot-Mode a Message will only attempt to transmit one time (no retransmission on arbitration loss or error).
+ * @note Doc p. 18; Kap. 3.4
+ * @param OneShot true = One-Shot-Mode enabled, false = Messages will reattempt transmission
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setOneShotMode(bool OneShot)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (OneShot != true && OneShot != false)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  if (!modifyCanControl(CANCTRL_BIT_OSM, OneShot ? CANCTRL_BIT_OSM : 0x00))
+  {
+    return false;
+  }
+
+  this->_oneShotMode = OneShot;
+  return true;
+}
+
+/**
+ * @brief Configure the CLKOUT-Pin of the MCP2515.
+ *
+ * MCP2515_CLKOUT_SOF routes the Start-of-Frame-Signal of every Frame on the Bus (received and transmitted) to the CLKOUT-Pin,
+ * so the Pin can be connected to an Input-Capture- or Interrupt-Pin of the Microcontroller (see captureStartOfFrame()).
+ * If CNF3.SOF has to be changed the Configuration-Mode is requested and the previous Operation-Mode is restored afterwards.
+ * @note Doc p. 55; Kap. 8.2
+ * @param Mode MCP2515_CLKOUT_DISABLED, MCP2515_CLKOUT_CLOCK or MCP2515_CLKOUT_SOF
+ * @param Prescaler Divider of the Clock for MCP2515_CLKOUT_CLOCK (1, 2, 4 or 8)
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::setClockOutput(uint8_t Mode, uint8_t Prescaler)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (Mode > MCP2515_CLKOUT_SOF ||
+      (Prescaler != 1 && Prescaler != 2 && Prescaler != 4 && Prescaler != 8))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  if (_operationMode == MCP2515_OP_SLEEP)
+  {
+    this->_lastMcpError = ERROR_MCP2515_FALSE_OPERATION_MODE;
+    return false;
+  }
+
+  uint8_t StartOfFrameBit = (Mode == MCP2515_CLKOUT_SOF) ? CNF3_BIT_SOF : 0x00;
+
+  // SOF can only be changed in the Configuration-Mode
+  if ((getConfigurationRegister3() & CNF3_BIT_SOF) != StartOfFrameBit)
+  {
+    uint8_t OperationMode = _operationMode;
+
+    if (OperationMode != MCP2515_OP_CONFIGURATION && !setConfigurationMode())
+    {
+      // Error will be set in setConfigurationMode()
+      return false;
+    }
+
+    if (!modifyConfigurationRegister3(CNF3_BIT_SOF, StartOfFrameBit))
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CNF3_NOT_SET;
+      return false;
+    }
+
+    if (!setOperationMode(OperationMode))
+    {
+      // Error will be set in setOperationMode()
+      return false;
+    }
+  }
+
+  // CLKPRE: 00 = Clock/1, 01 = Clock/2, 10 = Clock/4, 11 = Clock/8
+  uint8_t ClockPrescaler = 0;
+  while ((1 << ClockPrescaler) < Prescaler)
+  {
+    ClockPrescaler++;
+  }
+
+  // CLKEN and CLKPRE can be changed in all Operation-Modes, the SOF-Signal needs CLKEN too
+  if (!modifyCanControl(CANCTRL_BIT_CLKEN | CANCTRL_BIT_CLKPRE,
+                        ((Mode != MCP2515_CLKOUT_DISABLED) ? CANCTRL_BIT_CLKEN : 0x00) | ClockPrescaler))
+  {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Check if a Transmit-Buffer is free
+ * @return 0xFF if no Transmit-Buffer is free
+ *
+ * 0x0n - n = Number of the free Buffer
+ */
+uint8_t MCP2515::check4FreeTransmitBuffer()
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return 0xFF;
+  }
+
+  uint8_t Value = readStatusInstruction();
+
+  if ((Value & 0xA8) == 0x00)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NO_TRANSMITBUFFER_FREE;
+    return 0xFF;
+  }
+
+  for (size_t i = 0; i < 3; i++)
+  {
+    if ((Value & (0x08 << (2 * i))) != 0 )
+    {
+      return i;
+      break;
+    }
+  }
+
+  this->_lastMcpError = ERROR_MCP2515_UNDEFINED;
+  return 0xFF;
+}
+
+/**
+ * @brief Fill the given Transmit-Buffer with the given Data.
+ * @param BufferNumber 0 - 2
+ * @param ID Message-ID
+ * @param Extended bool true if it is a Extended Frame
+ * @param RTR bool true if it is a Remote Transmit request Message
+ * @param DLC Data Length Code of the Message
+ * @param Data 8-Byte Data-Array (in total)
+ * @return true when success, false on any error (check _lastMcpError)
+ */
+bool MCP2515::fillTransmitBuffer(uint8_t BufferNumber, uint32_t ID, bool Extended, bool RTR, uint8_t DLC, uint8_t Data[8])
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if ((BufferNumber > 2) ||
+      (ID > 0x1FFFFFFF) ||
+      (Extended != false && Extended != true) ||
+      (RTR != false && RTR != true) ||
+      (DLC > 8))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  if ((check4InterruptFlags() & (0x04 << BufferNumber)) != (0x04 << BufferNumber))
+  {
+    if (_lastMcpError != EMPTY_VALUE_16_BIT)
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CHECK_FREE_TRANSMIT_BUFFER;
+      return false;
+    }
+
+    this->_lastMcpError = ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE;
+    return false;
+  }
+
+  uint8_t ErrorCount = 0;
+  if (Extended) {
+    ErrorCount = ErrorCount + (setTransmitBufferStandardIdentifierHigh(BufferNumber, (ID >> 21))) ? 0 : 1;
+    ErrorCount = ErrorCount + (setTransmitBufferStandardIdentifierLow(BufferNumber, ((ID >> 18) & 0x07), Extended, ((ID >> 16) & 0x03))) ? 0 : 1;
+    ErrorCount = ErrorCount + (setTransmitBufferExtendedIdentifierHigh(BufferNumber, ((ID >> 8) & 0xFF))) ? 0 : 1;
+    ErrorCount = ErrorCount + (setTransmitBufferExtendedIdentifierLow(BufferNumber, (ID & 0xFF))) ? 0 : 1;
+  } else {
+    ErrorCount = ErrorCount + (setTransmitBufferStandardIdentifierHigh(BufferNumber, (ID >> 3))) ? 0 : 1;
+    ErrorCount = ErrorCount + (setTransmitBufferStandardIdentifierLow(BufferNumber, (ID & 0x03), Extended, 0x00)) ? 0 : 1;
+    ErrorCount = ErrorCount + (setTransmitBufferExtendedIdentifierHigh(BufferNumber, 0x00)) ? 0 : 1;
+    ErrorCount = ErrorCount + (setTransmitBufferExtendedIdentifierLow(BufferNumber, 0x00)) ? 0 : 1;
+  }
+
+  if (ErrorCount > 0)
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_TRANSMITBUFFER_ID_FILLING;
+    return false;
+  }
+
+  if (RTR) {
+    ErrorCount = ErrorCount + (setTransmitBufferDataLengthCode(BufferNumber, RTR, DLC)) ? 0 : 1;
+  } else {
+    ErrorCount = ErrorCount + (setTransmitBufferDataLengthCode(BufferNumber, RTR, DLC)) ? 0 : 1;
+
+    for (int i = 0; i < DLC; i++) {
+      ErrorCount = ErrorCount + (setTransmitBufferDataByte(BufferNumber, i, Data[i])) ? 0 : 1;
+    }
+  }
+
+  if (ErrorCount > 0)
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_TRANSMITBUFFER_DATA_FILLING;
+    return false;
+  }
+
+  if (!resetInterruptFlag((0x02 + BufferNumber)))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_RESET_FLAG;
+    return false;
+  }
+
+#ifdef MCP2515_ENABLE_BUS_LOAD
+  // on-wire Length for the Bus-Load (see addTransmittedBuffer())
+  MCP2515Frame Frame = {ID, Extended, RTR, DLC, {0}};
+
+  for (uint8_t i = 0; (i < DLC) && !RTR; i++)
+  {
+    Frame.data[i] = Data[i];
+  }
+
+  this->_transmitFrameBits[BufferNumber] = (uint8_t)getFrameBitLength(Frame, _transmitStuffBits[BufferNumber]);
+#endif
+  MCP2515_LATENCY_TX_ENQUEUED(BufferNumber, micros());
+
+  return true;
+}
+
+/**
+ * @brief Initiates a transmission for the given TX-Buffer
+ * @param BufferNumber 0 - 2
+ * @param Priority Message-Priority 0 - 3
+ * @return true when success, false on any error (check _lastMcpError)
+ */
+bool MCP2515::sendMessage(uint8_t BufferNumber, uint8_t Priority)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  // Held off the Bus until the Bus-Off-Recovery (see processBusState())
+  if ((_busState == MCP2515_BUS_STATE_BUS_OFF) && (_busOffBackoff != MCP2515_BUS_OFF_RECOVERY_AUTOMATIC))
+  {
+    this->_lastMcpError = ERROR_MCP2515_BUS_OFF;
+    return false;
+  }
+
+  if ((BufferNumber > 2) ||
+      (Priority > 3))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  // In One-Shot-Mode a failed Attempt ends the Transmission (no Retransmission)
+  if (_oneShotMode)
+  {
+    switch (sendMessageOneShot(BufferNumber, Priority))
+    {
+    case MCP2515_TX_RESULT_SUCCESS:
+      return true;
+      break;
+    case MCP2515_TX_RESULT_FAILED:
+      return false;
+      break;
+    default:
+      this->_lastMcpError = ERROR_MCP2515_ONE_SHOT_NOT_TRANSMITTED | ERROR_MCP2515_MESSAGE_SENDING_ABORTED;
+      return false;
+      break;
+    }
+  }
+
+  if (!modifyTransmitBufferControl(BufferNumber, 0x0B, (0x08 | Priority)))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INITIATE_SENDING;
+    return false;
+  }
+
+  MCP2515_LATENCY_TX_STARTED(1 << BufferNumber);
+
+  bool aborted = false;
+  uint16_t ErrorValue = ERROR_MCP2515_MESSAGE_SENDING_ABORTED;
+  MCP2515_BUSY_WAIT_BEGIN();
+
+  // While the Message Transmit Request bit is set
+  while (getTransmitBufferControl(BufferNumber) & TXBnCTRL_BIT_TXREQ) {
+    // Check if an error occures during the transmission
+    if (!aborted && ((getTransmitBufferControl(BufferNumber) & TXBnCTRL_BIT_TXERR) || (_lastMcpError != EMPTY_VALUE_16_BIT))) {
+
+      if (_lastMcpError != EMPTY_VALUE_16_BIT){
+        ErrorValue = ERROR_MCP2515_ERROR_DURING_SENDING;
+      }
+      // set aborted to true
+      aborted = true;
+
+      // In case of an error during the transmission withdraw only the Transmit Request of this Buffer
+      // ("Abort All Pending Transmissions" would also abort the other TX-Buffers).
+      // The while-loop ended when from the MCP2515 the Transmit Request bit is resetted.
+      bitModifyInstruction(REG_TXBnCTRL(BufferNumber), TXBnCTRL_BIT_TXREQ, 0x00);
+    }
+
+    yield();
+  }
+
+  MCP2515_BUSY_WAIT_END();
+
+  if (aborted) {
+    // The MCP2515 sets the TXnIF-Flag only after a successful Transmission
+    modifyCanInterruptFlag(CANINTF_BIT_TXnIF(BufferNumber), CANINTF_BIT_TXnIF(BufferNumber));
+    this->_lastMcpError = _lastMcpError | ErrorValue;
+    return false;
+  }
+
+  MCP2515_BUS_LOAD_TX_COMPLETED(BufferNumber);
+  MCP2515_LATENCY_TX_COMPLETED(BufferNumber);
+
+  return true;
+}
+
+/**
+ * @brief Transmits the given TX-Buffer with exactly one Transmission-Attempt.
+ *
+ * When the One-Shot-Mode is not enabled globally (see setOneShotMode()), it will be enabled only for this Transmission.
+ * As CANCTRL.OSM applies to all TX-Buffers, the call is refused while another TX-Buffer has a pending Transmission.
+ *
+ * If the Attempt could not be started within MCP2515_ONE_SHOT_TIMEOUT_BITS Bit-Times the Transmission-Request of
+ * this Buffer will be withdrawn, so a stale Message is never sent late.
+ *
+ * On any Result other than MCP2515_TX_RESULT_SUCCESS the Buffer will be marked as free again.
+ * @note Transmissions requested while this call waits (e.g. from an Interrupt-Routine) are also sent One-Shot.
+ * @param BufferNumber 0 - 2
+ * @param Priority Message-Priority 0 - 3
+ * @return MCP2515_TX_RESULT_SUCCESS, MCP2515_TX_RESULT_ARBITRATION_LOST, MCP2515_TX_RESULT_BUS_ERROR, MCP2515_TX_RESULT_ABORTED
+ *
+ * MCP2515_TX_RESULT_FAILED on any error (check _lastMcpError)
+ */
+uint8_t MCP2515::sendMessageOneShot(uint8_t BufferNumber, uint8_t Priority)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return MCP2515_TX_RESULT_FAILED;
+  }
+
+  // Held off the Bus until the Bus-Off-Recovery (see processBusState())
+  if ((_busState == MCP2515_BUS_STATE_BUS_OFF) && (_busOffBackoff != MCP2515_BUS_OFF_RECOVERY_AUTOMATIC))
+  {
+    this->_lastMcpError = ERROR_MCP2515_BUS_OFF;
+    return MCP2515_TX_RESULT_FAILED;
+  }
+
+  if ((BufferNumber > 2) ||
+      (Priority > 3))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return MCP2515_TX_RESULT_FAILED;
+  }
+
+  bool TemporaryOneShot = !_oneShotMode;
+
+  // READ STATUS: TXREQn is Bit 2 + 2n, the other Buffers must not lose their Retransmission
+  if (TemporaryOneShot && (readStatusInstruction() & (0x54 & ~(0x04 << (2 * BufferNumber)))))
+  {
+    this->_lastMcpError = ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE;
+    return MCP2515_TX_RESULT_FAILED;
+  }
+
+  if (TemporaryOneShot && !modifyCanControl(CANCTRL_BIT_OSM, CANCTRL_BIT_OSM))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INITIATE_SENDING;
+    return MCP2515_TX_RESULT_FAILED;
+  }
+
+  if (!modifyTransmitBufferControl(BufferNumber, 0x0B, (0x08 | Priority)))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INITIATE_SENDING;
+
+    if (TemporaryOneShot)
+    {
+      modifyCanControl(CANCTRL_BIT_OSM, 0x00);
+    }
+    return MCP2515_TX_RESULT_FAILED;
+  }
+
+  MCP2515_LATENCY_TX_STARTED(1 << BufferNumber);
+
+  uint32_t Timeout = ((uint32_t)MCP2515_ONE_SHOT_TIMEOUT_BITS * 1000000UL / _baudRate) + 1000;
+  uint32_t Start = micros();
+  uint8_t Control = getTransmitBufferControl(BufferNumber);
+
+  // In One-Shot-Mode the Transmit Request bit is reset after the first Attempt
+  while ((Control & TXBnCTRL_BIT_TXREQ) != 0x00)
+  {
+    if ((micros() - Start) > Timeout)
+    {
+      // Withdraw only this Transmission-Request (the other TX-Buffers are not affected)
+      bitModifyInstruction(REG_TXBnCTRL(BufferNumber), TXBnCTRL_BIT_TXREQ, 0x00);
+
+      do
+      {
+        Control = getTransmitBufferControl(BufferNumber);
+      } while ((Control & TXBnCTRL_BIT_TXREQ) != 0x00 && (micros() - Start) < (2 * Timeout));
+
+      break;
+    }
+
+    yield();
+    Control = getTransmitBufferControl(BufferNumber);
+  }
+
+  MCP2515_COUNT_BUSY_WAIT(micros() - Start);
+
+  if (TemporaryOneShot)
+  {
+    modifyCanControl(CANCTRL_BIT_OSM, 0x00);
+  }
+
+  uint8_t Result = MCP2515_TX_RESULT_SUCCESS;
+
+  if ((Control & TXBnCTRL_BIT_MLOA) != 0x00)
+  {
+    Result = MCP2515_TX_RESULT_ARBITRATION_LOST;
+  } else if ((Control & TXBnCTRL_BIT_TXERR) != 0x00)
+  {
+    Result = MCP2515_TX_RESULT_BUS_ERROR;
+  } else if ((Control & (TXBnCTRL_BIT_ABTF | TXBnCTRL_BIT_TXREQ)) != 0x00)
+  {
+    Result = MCP2515_TX_RESULT_ABORTED;
+  }
+
+  if (Result != MCP2515_TX_RESULT_SUCCESS)
+  {
+    // The MCP2515 sets the TXnIF-Flag only after a successful Transmission
+    bitModifyInstruction(REG_CANINTF, CANINTF_BIT_TXnIF(BufferNumber), CANINTF_BIT_TXnIF(BufferNumber));
+  } else {
+    MCP2515_BUS_LOAD_TX_COMPLETED(BufferNumber);
+    MCP2515_LATENCY_TX_COMPLETED(BufferNumber);
+  }
+
+  return Result;
+}
+
+/**
+ * @brief Initiates the transmission of several TX-Buffers with a single RTS-Instruction.
+ *
+ * The Buffers have to be filled before (e.g. with fillTransmitBuffer()).
+ * All requested Buffers are released at the same time, so the MCP2515 transmits them one after another
+ * without waiting for the MCU. With equal Priority the Buffer with the higher number is transmitted first.
+ *
+ * When an error occurs during the transmission or the Buffers are not transmitted within
+ * MCP2515_SEND_BUFFERS_TIMEOUT_BITS Bit-Times per Buffer, only the requested Buffers are withdrawn
+ * and the not transmitted Buffers are marked as free again.
+ * In One-Shot-Mode the MCP2515 resets TXREQ also after a failed Attempt, so the result is taken from TXnIF.
+ * @note Doc p. 65; Kap. 12.7
+ * @param Mask Bit 0 = TX-Buffer 0, Bit 1 = TX-Buffer 1, Bit 2 = TX-Buffer 2 (0x01 - 0x07)
+ * @return true when all requested Buffers are transmitted, false on any error (check _lastMcpError)
+ */
+bool MCP2515::sendBuffers(uint8_t Mask)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  // Held off the Bus until the Bus-Off-Recovery (see processBusState())
+  if ((_busState == MCP2515_BUS_STATE_BUS_OFF) && (_busOffBackoff != MCP2515_BUS_OFF_RECOVERY_AUTOMATIC))
+  {
+    this->_lastMcpError = ERROR_MCP2515_BUS_OFF;
+    return false;
+  }
+
+  if ((Mask == 0x00) ||
+      (Mask > 0x07))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  // READ STATUS: TXREQn is Bit 2 + 2n
+  uint8_t Status = readStatusInstruction();
+
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    if ((Mask & (1 << i)) && (Status & (0x04 << (2 * i))))
+    {
+      this->_lastMcpError = ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE;
+      return false;
+    }
+  }
+
+  if (!rtsInstruction((Mask & 0x01), (Mask & 0x02), (Mask & 0x04)))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INITIATE_SENDING;
+    return false;
+  }
+
+  MCP2515_LATENCY_TX_STARTED(Mask);
+
+  uint8_t Pending = Mask;
+  bool aborted = false;
+  bool TimedOut = false;
+  uint32_t Start = micros();
+  uint32_t Timeout = ((uint32_t)MCP2515_SEND_BUFFERS_TIMEOUT_BITS * 1000000UL / _baudRate) *
+                     (((Mask >> 0) & 0x01) + ((Mask >> 1) & 0x01) + ((Mask >> 2) & 0x01)) + 1000;
+  MCP2515_BUSY_WAIT_BEGIN();
+
+  while (Pending != 0x00)
+  {
+    Status = readStatusInstruction();
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      if ((Pending & (1 << i)) && !(Status & (0x04 << (2 * i))))
+      {
+        Pending = Pending & ~(1 << i);
+      }
+    }
+
+    if (!aborted)
+    {
+      for (uint8_t i = 0; i < 3; i++)
+      {
+        if ((Pending & (1 << i)) && (getTransmitBufferControl(i) & TXBnCTRL_BIT_TXERR))
+        {
+          aborted = true;
+        }
+      }
+
+      if (!aborted && (Pending != 0x00) && ((micros() - Start) >= Timeout))
+      {
+        aborted = true;
+        TimedOut = true;
+      }
+
+      if (aborted)
+      {
+        // Withdraw only the requested Buffers (pending Buffers of other Callers are not affected)
+        for (uint8_t i = 0; i < 3; i++)
+        {
+          if (Pending & (1 << i))
+          {
+            bitModifyInstruction(REG_TXBnCTRL(i), TXBnCTRL_BIT_TXREQ, 0x00);
+          }
+        }
+
+        // A Frame on the Bus is still completed
+        Start = micros();
+        Timeout = ((uint32_t)MCP2515_ONE_SHOT_TIMEOUT_BITS * 1000000UL / _baudRate) + 1000;
+      }
+    } else if ((micros() - Start) >= Timeout)
+    {
+      break;
+    }
+
+    yield();
+  }
+
+  MCP2515_BUSY_WAIT_END();
+
+  // READ STATUS: TXnIF is Bit 3 + 2n (set only after a successful Transmission)
+  Status = readStatusInstruction();
+  uint8_t Failed = 0x00;
+
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    if (Mask & (1 << i))
+    {
+      if (Status & (0x08 << (2 * i)))
+      {
+        MCP2515_BUS_LOAD_TX_COMPLETED(i);
+        MCP2515_LATENCY_TX_COMPLETED(i);
+      } else {
+        Failed = Failed | (1 << i);
+      }
+    }
+  }
+
+  if (Failed != 0x00)
+  {
+    // Mark the not transmitted Buffers as free again
+    bitModifyInstruction(REG_CANINTF, (Failed << 2), (Failed << 2));
+
+    if (TimedOut)
+    {
+      this->_lastMcpError = ERROR_MCP2515_TRANSMIT_TIMEOUT | ERROR_MCP2515_MESSAGE_SENDING_ABORTED;
+    } else if (!aborted && _oneShotMode)
+    {
+      // The single Attempt failed (MLOA, TXERR or ABTF)
+      this->_lastMcpError = ERROR_MCP2515_ONE_SHOT_NOT_TRANSMITTED | ERROR_MCP2515_MESSAGE_SENDING_ABORTED;
+    } else {
+      this->_lastMcpError = ERROR_MCP2515_MESSAGE_SENDING_ABORTED;
+    }
+
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Loads up to three Frames into the TX-Buffers and transmits them with a single RTS-Instruction.
+ *
+ * Frames[0] is loaded into TX-Buffer 2, Frames[1] into TX-Buffer 1 and Frames[2] into TX-Buffer 0,
+ * The Priority of the Buffers is reset to 0, so the Frames are transmitted in the order of the Array.
+ *
+ * Each Frame is loaded with one LOAD TX BUFFER-Instruction.
+ * @param Frames Array of Frames
+ * @param Count Count of Frames (1 - 3)
+ * @return true when all Frames are transmitted, false on any error (check _lastMcpError)
+ */
+bool MCP2515::sendFrames(const MCP2515Frame Frames[], uint8_t Count)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if ((Count == 0) ||
+      (Count > 3))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  for (uint8_t i = 0; i < Count; i++)
+  {
+    if ((Frames[i].id > 0x1FFFFFFF) ||
+        (!Frames[i].extended && Frames[i].id > 0x7FF) ||
+        (Frames[i].dlc > 8))
+    {
+      this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+      return false;
+    }
+  }
+
+  // A Buffer is free when TXnIF (Bit 3 + 2n) is set and TXREQn (Bit 2 + 2n) is not set
+  uint8_t Status = readStatusInstruction();
+  uint8_t Mask = 0x00;
+
+  for (uint8_t i = 0; i < Count; i++)
+  {
+    uint8_t BufferNumber = 2 - i;
+
+    if ((Status & (0x0C << (2 * BufferNumber))) != (0x08 << (2 * BufferNumber)))
+    {
+      this->_lastMcpError = ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE;
+      return false;
+    }
+
+    Mask = Mask | (1 << BufferNumber);
+  }
+
+  for (uint8_t i = 0; i < Count; i++)
+  {
+    uint8_t BufferNumber = 2 - i;
+
+    // The Priority of a previous Transmission stays in TXP and would change the Order
+    if (!loadTransmitBuffer(BufferNumber, Frames[i].id, Frames[i].extended, Frames[i].rtr, Frames[i].dlc, Frames[i].data) ||
+        !bitModifyInstruction(REG_TXBnCTRL(BufferNumber), TXBnCTRL_BIT_TXP, 0x00))
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_TRANSMITBUFFER_DATA_FILLING;
+      return false;
+    }
+  }
+
+  return sendBuffers(Mask);
+}
+
+/**
+ * @brief Initiates a transmission for the given TX-Buffer and aborts it when it is not completed within the Timeout.
+ *
+ * Only the Transmit Request of this Buffer is withdrawn, the pending Transmissions of the other TX-Buffers are not affected.
+ * A Frame which is already on the Bus when the Timeout is over is completed by the MCP2515.
+ *
+ * Async = false: Waits till the Transmission is completed or aborted.
+ *
+ * Async = true: Returns immediately (see startTransmission()), the Timeout is checked and the Completion is reported by handleInterrupt().
+ * handleInterrupt() has to be called regularly (the Timeout doesn't trigger an Interrupt).
+ *
+ * The CPU-Time of each call is measured, the maximum can be read with getMaxSendTime().
+ * @param BufferNumber 0 - 2
+ * @param Priority Message-Priority 0 - 3
+ * @param Timeout Timeout in µs (> 0)
+ * @param Async false = wait for the Completion, true = return immediately
+ * @param Tag User-defined Value which is passed to the Transmit-Callback (only Async)
+ * @return true when success (Async: when the Transmission is initiated), false on any error (check _lastMcpError)
+ */
+bool MCP2515::sendMessageTimeout(uint8_t BufferNumber, uint8_t Priority, uint32_t Timeout, bool Async, uint32_t Tag)
+{
+  uint32_t CallStart = micros();
+
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  // Held off the Bus until the Bus-Off-Recovery (see processBusState())
+  if ((_busState == MCP2515_BUS_STATE_BUS_OFF) && (_busOffBackoff != MCP2515_BUS_OFF_RECOVERY_AUTOMATIC))
+  {
+    this->_lastMcpError = ERROR_MCP2515_BUS_OFF;
+    return false;
+  }
+
+  if ((BufferNumber > 2) ||
+      (Priority > 3) ||
+      (Timeout == 0) ||
+      (Async != false && Async != true))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  bool Result = false;
+
+  if (Async)
+  {
+    Result = startTransmission(BufferNumber, Priority, Tag);
+
+    if (Result)
+    {
+      this->_transmitDeadline[BufferNumber] = CallStart + Timeout;
+      this->_transmitDeadlineMask = _transmitDeadlineMask | (1 << BufferNumber);
+    }
+  } else if ((_pendingTransmissions & (1 << BufferNumber)) ||
+             (readStatusInstruction() & (0x04 << (2 * BufferNumber))))
+  {
+    this->_lastMcpError = ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE;
+  } else if (!bitModifyInstruction(REG_TXBnCTRL(BufferNumber), (TXBnCTRL_BIT_TXREQ | TXBnCTRL_BIT_TXP), (TXBnCTRL_BIT_TXREQ | Priority)))
+  {
+    // No ReCheck: the Transmit Request bit can already be reset when the Transmission is completed
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INITIATE_SENDING;
+  } else {
+    uint32_t Start = micros();
+    bool TimedOut = false;
+    MCP2515_BUSY_WAIT_BEGIN();
+    MCP2515_LATENCY_TX_STARTED(1 << BufferNumber);
+
+    while (getTransmitBufferControl(BufferNumber) & TXBnCTRL_BIT_TXREQ)
+    {
+      if (!TimedOut && ((micros() - Start) >= Timeout))
+      {
+        TimedOut = true;
+
+        // Withdraw only this Transmission-Request, a Frame on the Bus is still completed
+        bitModifyInstruction(REG_TXBnCTRL(BufferNumber), TXBnCTRL_BIT_TXREQ, 0x00);
+        Start = micros();
+        Timeout = ((uint32_t)MCP2515_ONE_SHOT_TIMEOUT_BITS * 1000000UL / _baudRate) + 1000;
+      } else if (TimedOut && ((micros() - Start) >= Timeout))
+      {
+        break;
+      }
+
+      yield();
+    }
+
+    MCP2515_BUSY_WAIT_END();
+
+    // READ STATUS: TXnIF is Bit 3 + 2n (set after a successful Transmission)
+    if (readStatusInstruction() & (0x08 << (2 * BufferNumber)))
+    {
+      Result = true;
+      MCP2515_BUS_LOAD_TX_COMPLETED(BufferNumber);
+      MCP2515_LATENCY_TX_COMPLETED(BufferNumber);
+    } else {
+      // Mark the Buffer as free again
+      bitModifyInstruction(REG_CANINTF, CANINTF_BIT_TXnIF(BufferNumber), CANINTF_BIT_TXnIF(BufferNumber));
+      this->_lastMcpError = (TimedOut ? ERROR_MCP2515_TRANSMIT_TIMEOUT : ERROR_MCP2515_ONE_SHOT_NOT_TRANSMITTED) | ERROR_MCP2515_MESSAGE_SENDING_ABORTED;
+    }
+  }
+
+  uint32_t Duration = micros() - CallStart;
+
+  if (Duration > _maxSendTime)
+  {
+    this->_maxSendTime = Duration;
+  }
+
+  return Result;
+}
+
+/**
+ * @brief Get the maximum CPU-Time of a call of sendMessageTimeout().
+ * @param Reset true = reset the Maximum after reading
+ * @return maximum CPU-Time in µs
+ */
+uint32_t MCP2515::getMaxSendTime(bool Reset)
+{
+  uint32_t Value = _maxSendTime;
+
+  if (Reset)
+  {
+    this->_maxSendTime = 0;
+  }
+
+  return Value;
+}
+
+/**
+ * @brief Initiates a transmission for the given TX-Buffer without waiting for its Completion.
+ *
+ * The TXnIE-Interrupt of the Buffer is enabled, so the INT-Pin signals the Completion.
+ * The Completion is reported by handleInterrupt() to the Transmit-Callback (see setTransmitCallback()).
+ * @param BufferNumber 0 - 2
+ * @param Priority Message-Priority 0 - 3
+ * @param Tag User-defined Value which is passed to the Transmit-Callback
+ * @return true when success, false on any error (check _lastMcpError)
+ */
+bool MCP2515::startTransmission(uint8_t BufferNumber, uint8_t Priority, uint32_t Tag)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  // Held off the Bus until the Bus-Off-Recovery (see processBusState())
+  if ((_busState == MCP2515_BUS_STATE_BUS_OFF) && (_busOffBackoff != MCP2515_BUS_OFF_RECOVERY_AUTOMATIC))
+  {
+    this->_lastMcpError = ERROR_MCP2515_BUS_OFF;
+    return false;
+  }
+
+  if ((BufferNumber > 2) ||
+      (Priority > 3))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  if ((_pendingTransmissions & (1 << BufferNumber)) ||
+      (readStatusInstruction() & (0x04 << (2 * BufferNumber))))
+  {
+    this->_lastMcpError = ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE;
+    return false;
+  }
+
+  if (!modifyCanInterruptEnable(CANINTE_BIT_TXnIE(BufferNumber), CANINTE_BIT_TXnIE(BufferNumber)))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CHANGE_INTERRUPT;
+    return false;
+  }
+
+  this->_transmitTag[BufferNumber] = Tag;
+  this->_transmitDeadlineMask = _transmitDeadlineMask & ~(1 << BufferNumber);
+  this->_pendingTransmissions = _pendingTransmissions | (1 << BufferNumber);
+
+  // No ReCheck: the Transmit Request bit can already be reset when the Transmission is completed
+  if (!bitModifyInstruction(REG_TXBnCTRL(BufferNumber), (TXBnCTRL_BIT_TXREQ | TXBnCTRL_BIT_TXP), (TXBnCTRL_BIT_TXREQ | Priority)))
+  {
+    this->_pendingTransmissions = _pendingTransmissions & ~(1 << BufferNumber);
+    modifyCanInterruptEnable(CANINTE_BIT_TXnIE(BufferNumber), 0x00);
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INITIATE_SENDING;
+    return false;
+  }
+
+  MCP2515_LATENCY_TX_STARTED(1 << BufferNumber);
+
+  return true;
+}
+
+/**
+ * @brief Get the TX-Buffers with a pending Transmission (started with startTransmission()).
+ * @return Bit 0 = TX-Buffer 0, Bit 1 = TX-Buffer 1, Bit 2 = TX-Buffer 2
+ */
+uint8_t MCP2515::getPendingTransmissions()
+{
+  return _pendingTransmissions;
+}
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+/**
+ * @brief Appends a Frame to the Transmit-Queue.
+ *
+ * Only available when MCP2515_ENABLE_TRANSMIT_QUEUE is defined.
+ *
+ * Frames with a Deadline are transmitted by processTransmitQueue() in the order of their Deadline (Earliest Deadline First),
+ * Frames without a Deadline (best effort) afterwards in the order of the Queue.
+ * Frames with the same ID are always transmitted in the order of the Queue.
+ * @param Frame Frame to transmit
+ * @param Deadline Deadline relative to now in µs (0 = no Deadline)
+ * @return true when success, false on any error (check _lastMcpError)
+ */
+bool MCP2515::queueMessage(const MCP2515Frame &Frame, uint32_t Deadline)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if ((Frame.id > 0x1FFFFFFF) ||
+      (!Frame.extended && Frame.id > 0x7FF) ||
+      (Frame.dlc > 8) ||
+      (Deadline > 0x7FFFFFFF))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  for (uint8_t i = 0; i < MCP2515_TX_QUEUE_SIZE; i++)
+  {
+    if (_txQueue[i].state == MCP2515_QUEUE_ENTRY_FREE)
+    {
+      MCP2515QueueEntry &Entry = _txQueue[i];
+
+      uint8_t StuffBits;
+
+      Entry.frame = Frame;
+      Entry.bits = (uint8_t)getFrameBitLength(Frame, StuffBits);
+      Entry.hasDeadline = (Deadline > 0);
+      Entry.deadline = micros() + Deadline;
+      Entry.sequence = _txQueueSequence++;
+      Entry.state = MCP2515_QUEUE_ENTRY_QUEUED;
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+      Entry.enqueued = micros();
+#endif
+      this->_txQueueCount++;
+      txQueueUpdateHead(i);
+
+      return true;
+    }
+  }
+
+  this->_lastMcpError = ERROR_MCP2515_TX_QUEUE_FULL;
+  return false;
+}
+
+/**
+ * @brief Transmits the queued Frames (streaming Transmission, Earliest Deadline First).
+ *
+ * Only available when MCP2515_ENABLE_TRANSMIT_QUEUE is defined.
  *
- * False = Disable Interrupt
- * @param Interrupt 0 - 7
+ * Has to be called as often as possible (e.g. in every loop()).
  *
- * 7 = MERRE - Message Error Interrupt
+ * While one Frame is on the Bus the next Frames are already loaded into the other TX-Buffers,
+ * so the Frames are transmitted back-to-back without waiting for the SPI-Transfer.
  *
- * 6 = WAKIE - Wake-up Interrupt
+ * The queued Frame with the earliest Deadline is loaded next (before it an older Frame with the same ID).
+ * Its Priority (TXP and Buffer-Number) is set lower than the pending Frames which have to be transmitted before it
+ * (same ID or earlier Deadline) and as high as possible otherwise. When no Level below them is free,
+ * the pending Frames are raised to the highest Levels in their Order (see txQueueRaisePriorities()).
+ * When no TX-Buffer is free, a pending Frame with a later Deadline is withdrawn (only this Buffer) and stays queued.
  *
- * 5 = ERRIE - Error Interrupt (multiple sources in EFLG register)
+ * Frames which missed their Deadline are dropped (or withdrawn from the TX-Buffer) and counted as Deadline-Miss.
+ * Frames which are not transmitted (e.g. in One-Shot-Mode) are dropped and their Buffer is marked as free again.
+ * @note Doc p. 17; Kap. 3.2
+ * @return Number of Frames loaded into the TX-Buffers (on Error check _lastMcpError)
+ */
+uint8_t MCP2515::processTransmitQueue()
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return 0;
+  }
+
+  uint32_t Now = micros();
+
+  // Utilization of the own transmitted Frames in ‰ of the Baudrate
+  if ((Now - _utilizationStart) >= MCP2515_UTILIZATION_WINDOW)
+  {
+    this->_utilization = (uint16_t)(((uint64_t)_utilizationBits * 1000000000ULL) / ((uint64_t)(Now - _utilizationStart) * _baudRate));
+    this->_utilizationBits = 0;
+    this->_utilizationStart = Now;
+  }
+
+  if (_txQueueCount == 0)
+  {
+    return 0;
+  }
+
+  // READ STATUS: TXREQn is Bit 2 + 2n, TXnIF is Bit 3 + 2n
+  uint8_t Status = readStatusInstruction();
+
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    if (!(_txQueueInFlight & (1 << i)))
+    {
+      continue;
+    }
+
+    MCP2515QueueEntry &Entry = _txQueue[_txQueueSlot[i]];
+
+    if (Status & (0x04 << (2 * i)))
+    {
+      // Withdraw a pending Frame which missed its Deadline, a Frame which is already on the Bus is still transmitted,
+      // so the Deadline-Miss is counted when the Frame was not transmitted
+      if (Entry.hasDeadline && !(_txQueueExpired & (1 << i)) && ((int32_t)(Now - Entry.deadline) >= 0))
+      {
+        bitModifyInstruction(REG_TXBnCTRL(i), TXBnCTRL_BIT_TXREQ, 0x00);
+        this->_txQueueExpired = _txQueueExpired | (1 << i);
+      }
+      continue;
+    }
+
+    this->_txQueueInFlight = _txQueueInFlight & ~(1 << i);
+
+    if (Status & (0x08 << (2 * i)))
+    {
+      this->_txQueueStatistic.transmitted++;
+      this->_utilizationBits += Entry.bits;
+      MCP2515_BUS_LOAD_TX_COMPLETED(i);
+      MCP2515_LATENCY_TX_COMPLETED(i);
+      Entry.state = MCP2515_QUEUE_ENTRY_FREE;
+    } else {
+      // The MCP2515 sets the TXnIF-Flag only after a successful Transmission
+      bitModifyInstruction(REG_CANINTF, CANINTF_BIT_TXnIF(i), CANINTF_BIT_TXnIF(i));
+      Status = Status | (0x08 << (2 * i));
+
+      // A not transmitted Frame gives its Tokens back
+      MCP2515RateLimit *RateLimit = findRateLimit(Entry.frame);
+
+      if (RateLimit != NULL)
+      {
+        RateLimit->tokens += (int32_t)Entry.bits * 1000;
+      }
+
+      if (_busLoadLimit.rate > 0)
+      {
+        this->_busLoadLimit.tokens += (int32_t)Entry.bits * 1000;
+      }
+
+      if ((_txQueuePreempted & (1 << i)) && !(_txQueueExpired & (1 << i)))
+      {
+        Entry.state = MCP2515_QUEUE_ENTRY_QUEUED;
+        txQueueUpdateHead(_txQueueSlot[i]);
+      } else {
+        if (_txQueueExpired & (1 << i))
+        {
+          this->_txQueueStatistic.deadlineMisses++;
+        } else {
+          this->_txQueueStatistic.notTransmitted++;
+        }
+        Entry.state = MCP2515_QUEUE_ENTRY_FREE;
+      }
+    }
+
+    if (Entry.state == MCP2515_QUEUE_ENTRY_FREE)
+    {
+      this->_txQueueCount--;
+    }
+
+    this->_txQueuePreempted = _txQueuePreempted & ~(1 << i);
+    this->_txQueueExpired = _txQueueExpired & ~(1 << i);
+  }
+
+  // Drop the queued Frames which missed their Deadline
+  for (uint8_t i = 0; i < MCP2515_TX_QUEUE_SIZE; i++)
+  {
+    if ((_txQueue[i].state == MCP2515_QUEUE_ENTRY_QUEUED) && _txQueue[i].hasDeadline && ((int32_t)(Now - _txQueue[i].deadline) >= 0))
+    {
+      this->_txQueue[i].state = MCP2515_QUEUE_ENTRY_FREE;
+      this->_txQueueCount--;
+      this->_txQueueStatistic.deadlineMisses++;
+      txQueueUpdateHead(i);
+    }
+  }
+
+  // Fill the Token-Buckets of the Rate-Limits
+  for (uint8_t i = 0; i < MCP2515_MAX_RATE_LIMITS; i++)
+  {
+    if (_rateLimits[i].rate > 0)
+    {
+      refillRateLimit(_rateLimits[i], Now);
+    }
+  }
+
+  if (_busLoadLimit.rate > 0)
+  {
+    refillRateLimit(_busLoadLimit, Now);
+  }
+
+  uint8_t Loaded = 0;
+
+  while (true)
+  {
+    // Only the Head of an ID (its oldest queued Frame) is loaded (see below),
+    // so the Rate-Limits are checked once per ID with the Length of the Head
+    bool Ready[MCP2515_TX_QUEUE_SIZE];
+
+    for (uint8_t i = 0; i < MCP2515_TX_QUEUE_SIZE; i++)
+    {
+      Ready[i] = false;
+
+      if ((_txQueue[i].state != MCP2515_QUEUE_ENTRY_QUEUED) || (_txQueue[i].head != i))
+      {
+        continue;
+      }
+
+      int32_t Bits = (int32_t)_txQueue[i].bits * 1000;
+      MCP2515RateLimit *RateLimit = findRateLimit(_txQueue[i].frame);
+
+      Ready[i] = !(((_busLoadLimit.rate > 0) && (_busLoadLimit.tokens < Bits)) ||
+                   ((RateLimit != NULL) && (RateLimit->tokens < Bits)));
+    }
+
+    // Search the queued Frame with the earliest Deadline (without Deadline: the oldest Frame),
+    // Frames whose Head is blocked by its Rate-Limit are skipped
+    uint8_t Best = 0xFF;
+
+    for (uint8_t i = 0; i < MCP2515_TX_QUEUE_SIZE; i++)
+    {
+      if ((_txQueue[i].state != MCP2515_QUEUE_ENTRY_QUEUED) || !Ready[_txQueue[i].head])
+      {
+        continue;
+      }
+
+      if (Best == 0xFF)
+      {
+        Best = i;
+      } else if (_txQueue[i].hasDeadline != _txQueue[Best].hasDeadline)
+      {
+        if (_txQueue[i].hasDeadline)
+        {
+          Best = i;
+        }
+      } else if (_txQueue[i].hasDeadline && (_txQueue[i].deadline != _txQueue[Best].deadline))
+      {
+        if ((int32_t)(_txQueue[i].deadline - _txQueue[Best].deadline) < 0)
+        {
+          Best = i;
+        }
+      } else if ((int16_t)(_txQueue[i].sequence - _txQueue[Best].sequence) < 0)
+      {
+        Best = i;
+      }
+    }
+
+    if (Best == 0xFF)
+    {
+      break;
+    }
+
+    // An older queued Frame with the same ID is transmitted first (with the Deadline of the Best Frame)
+    uint8_t Slot = _txQueue[Best].head;
+
+    bool HasDeadline = _txQueue[Best].hasDeadline;
+    uint32_t Deadline = _txQueue[Best].deadline;
+
+    // Priority = TXP * 3 + Buffer-Number (the MCP2515 transmits the highest Priority first)
+    uint8_t Limit = 12;
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      if ((_txQueueInFlight & (1 << i)) && txQueueMustPrecede(_txQueueSlot[i], Slot, HasDeadline, Deadline) &&
+          ((_txQueuePriority[i] * 3 + i) < Limit))
+      {
+        Limit = _txQueuePriority[i] * 3 + i;
+      }
+    }
+
+    // Search the free TX-Buffer (TXnIF set and TXREQ reset) with the highest Priority below the Limit
+    uint8_t BufferNumber = 0xFF;
+    uint8_t Priority = 0;
+    bool FreeBuffer = false;
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      if ((Status & (0x0C << (2 * i))) != (0x08 << (2 * i)) || (_txQueueInFlight & (1 << i)))
+      {
+        continue;
+      }
+
+      FreeBuffer = true;
+
+      if (i >= Limit)
+      {
+        continue;
+      }
+
+      uint8_t TXP = ((Limit - 1 - i) / 3 > 3) ? 3 : (Limit - 1 - i) / 3;
+
+      if ((BufferNumber == 0xFF) || ((TXP * 3 + i) > (Priority * 3 + BufferNumber)))
+      {
+        BufferNumber = i;
+        Priority = TXP;
+      }
+    }
+
+    // A free TX-Buffer but no free Level below the pending Frames: raise them instead of waiting till they are transmitted
+    if ((BufferNumber == 0xFF) && FreeBuffer && txQueueRaisePriorities())
+    {
+      continue;
+    }
+
+    if (BufferNumber == 0xFF)
+    {
+      // Preemption: withdraw the pending Frame with the latest Deadline (only one at a time)
+      if (HasDeadline && (_txQueuePreempted == 0x00))
+      {
+        uint8_t Victim = 0xFF;
+
+        for (uint8_t i = 0; i < 3; i++)
+        {
+          uint8_t VictimSlot = _txQueueSlot[i];
+
+          if (!(_txQueueInFlight & (1 << i)) || (_txQueueExpired & (1 << i)) ||
+              txQueueMustPrecede(VictimSlot, Slot, HasDeadline, Deadline))
+          {
+            continue;
+          }
+
+          // A withdrawn Frame must not be overtaken by a pending Frame with the same ID
+          bool SameIdPending = false;
+
+          for (uint8_t j = 0; j < 3; j++)
+          {
+            if ((j != i) && (_txQueueInFlight & (1 << j)) && txQueueSameId(_txQueueSlot[j], VictimSlot))
+            {
+              SameIdPending = true;
+            }
+          }
+
+          if (SameIdPending)
+          {
+            continue;
+          }
+
+          if ((Victim == 0xFF) ||
+              (_txQueue[_txQueueSlot[Victim]].hasDeadline && (!_txQueue[VictimSlot].hasDeadline ||
+               ((int32_t)(_txQueue[VictimSlot].deadline - _txQueue[_txQueueSlot[Victim]].deadline) > 0))))
+          {
+            Victim = i;
+          }
+        }
+
+        if (Victim != 0xFF)
+        {
+          bitModifyInstruction(REG_TXBnCTRL(Victim), TXBnCTRL_BIT_TXREQ, 0x00);
+          this->_txQueuePreempted = _txQueuePreempted | (1 << Victim);
+          this->_txQueueStatistic.preemptions++;
+        }
+      }
+      break;
+    }
+
+    const MCP2515Frame &Frame = _txQueue[Slot].frame;
+
+    if (!loadTransmitBuffer(BufferNumber, Frame.id, Frame.extended, Frame.rtr, Frame.dlc, Frame.data) ||
+        !bitModifyInstruction(REG_TXBnCTRL(BufferNumber), (TXBnCTRL_BIT_TXREQ | TXBnCTRL_BIT_TXP), (TXBnCTRL_BIT_TXREQ | Priority)))
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INITIATE_SENDING;
+      return Loaded;
+    }
+
+    // The Frame was handed to the Driver with queueMessage()
+    MCP2515_LATENCY_TX_ENQUEUED(BufferNumber, _txQueue[Slot].enqueued);
+    MCP2515_LATENCY_TX_STARTED(1 << BufferNumber);
+
+    // Take the on-wire Length of the Frame from the Token-Buckets
+    MCP2515RateLimit *RateLimit = findRateLimit(Frame);
+
+    if (RateLimit != NULL)
+    {
+      RateLimit->tokens -= (int32_t)_txQueue[Slot].bits * 1000;
+    }
+
+    if (_busLoadLimit.rate > 0)
+    {
+      this->_busLoadLimit.tokens -= (int32_t)_txQueue[Slot].bits * 1000;
+    }
+
+    this->_txQueue[Slot].state = MCP2515_QUEUE_ENTRY_IN_FLIGHT;
+    txQueueUpdateHead(Slot);
+    this->_txQueueInFlight = _txQueueInFlight | (1 << BufferNumber);
+    this->_txQueueSlot[BufferNumber] = Slot;
+    this->_txQueuePriority[BufferNumber] = Priority;
+
+    Status = (Status & ~(0x08 << (2 * BufferNumber))) | (0x04 << (2 * BufferNumber));
+    Loaded++;
+  }
+
+  return Loaded;
+}
+
+/**
+ * @brief Get the Number of Frames in the Transmit-Queue (queued and not yet transmitted).
  *
- * 4 = TX2IE - Transmit Buffer 2 Empty Interrupt
+ * Only available when MCP2515_ENABLE_TRANSMIT_QUEUE is defined.
+ * @return Number of Frames
+ */
+uint8_t MCP2515::getTransmitQueueCount()
+{
+  return _txQueueCount;
+}
+
+/**
+ * @brief Get the Statistic of the Transmit-Queue.
  *
- * 3 = TX1IE - Transmit Buffer 1 Empty Interrupt
+ * Only available when MCP2515_ENABLE_TRANSMIT_QUEUE is defined.
+ * @param Statistic Reference to the Statistic-Struct
+ */
+void MCP2515::getTransmitQueueStatistic(MCP2515TransmitQueueStatistic &Statistic)
+{
+  Statistic = _txQueueStatistic;
+}
+
+/**
+ * @brief Resets the Statistic of the Transmit-Queue.
  *
- * 2 = TX0IE - Transmit Buffer 0 Empty Interrupt
+ * Only available when MCP2515_ENABLE_TRANSMIT_QUEUE is defined.
+ */
+void MCP2515::resetTransmitQueueStatistic()
+{
+  this->_txQueueStatistic.transmitted = 0;
+  this->_txQueueStatistic.notTransmitted = 0;
+  this->_txQueueStatistic.deadlineMisses = 0;
+  this->_txQueueStatistic.preemptions = 0;
+}
+#endif
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+/**
+ * @brief Sets the Transmit-Rate-Limit (Token-Bucket) for an ID-Range of the Transmit-Queue.
+ *
+ * Only available when MCP2515_ENABLE_TRANSMIT_QUEUE is defined.
+ *
+ * The Frames of the ID-Range are only loaded while the own Bus-Load of this ID-Range stays below Rate ‰ of the Baudrate
+ * (on-wire Length incl. Stuff-Bits, see calculateFrameBitLength()). Up to Burst Bits can be transmitted at once.
+ *
+ * Frames of other ID-Ranges are not delayed by a throttled ID-Range.
+ * @param Index Number of the Rate-Limit (0 - MCP2515_MAX_RATE_LIMITS-1), the first matching Rate-Limit is used
+ * @param Extended true = ID-Range of Extended Frames
+ * @param IdFrom first ID of the Range
+ * @param IdTo last ID of the Range
+ * @param Rate max. Bus-Load in ‰ of the Baudrate (1 - 1000, 0 = disable the Rate-Limit)
+ * @param Burst Size of the Token-Bucket in Bits (MCP2515_MAX_FRAME_BITS - 2000000)
+ * @return true when success, false on any error (check _lastMcpError)
+ */
+bool MCP2515::setTransmitRateLimit(uint8_t Index, bool Extended, uint32_t IdFrom, uint32_t IdTo, uint16_t Rate, uint32_t Burst)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if ((Index >= MCP2515_MAX_RATE_LIMITS) ||
+      (Extended != false && Extended != true) ||
+      (IdFrom > IdTo) ||
+      (IdTo > (Extended ? 0x1FFFFFFF : 0x7FF)) ||
+      (Rate > 1000) ||
+      (Burst < MCP2515_MAX_FRAME_BITS) || (Burst > 2000000))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  MCP2515RateLimit &Limit = _rateLimits[Index];
+
+  Limit.idFrom = IdFrom;
+  Limit.idTo = IdTo;
+  Limit.extended = Extended;
+  Limit.rate = Rate;
+  Limit.burst = Burst;
+  Limit.tokens = (int32_t)Burst * 1000;
+  Limit.lastUpdate = micros();
+
+  return true;
+}
+
+/**
+ * @brief Sets the Limit (Token-Bucket) of the own Bus-Load for all Frames of the Transmit-Queue.
+ *
+ * Only available when MCP2515_ENABLE_TRANSMIT_QUEUE is defined.
+ * @param Rate max. Bus-Load in ‰ of the Baudrate (1 - 1000, 0 = disable the Limit)
+ * @param Burst Size of the Token-Bucket in Bits (MCP2515_MAX_FRAME_BITS - 2000000)
+ * @return true when success, false on any error (check _lastMcpError)
+ */
+bool MCP2515::setTransmitBusLoadLimit(uint16_t Rate, uint32_t Burst)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if ((Rate > 1000) ||
+      (Burst < MCP2515_MAX_FRAME_BITS) || (Burst > 2000000))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  this->_busLoadLimit.rate = Rate;
+  this->_busLoadLimit.burst = Burst;
+  this->_busLoadLimit.tokens = (int32_t)Burst * 1000;
+  this->_busLoadLimit.lastUpdate = micros();
+
+  return true;
+}
+
+/**
+ * @brief Get the Utilization of the Bus by the Frames of the Transmit-Queue.
+ *
+ * Only available when MCP2515_ENABLE_TRANSMIT_QUEUE is defined.
+ *
+ * Measured over the last completed Window of MCP2515_UTILIZATION_WINDOW µs (updated by processTransmitQueue()).
+ * @return Utilization in ‰ of the Baudrate
+ */
+uint16_t MCP2515::getTransmitUtilization()
+{
+  return _utilization;
+}
+#endif
+
+/**
+ * @brief Calculates the on-wire Length of a Frame.
+ *
+ * Includes the Stuff-Bits (SOF till CRC, calculated with the real CRC-15 of the Frame), the CRC-Delimiter, ACK, EOF and the Interframe-Space.
+ * @param Frame Frame
+ * @return Length in Bits, 0 on any error (check _lastMcpError)
+ */
+uint16_t MCP2515::calculateFrameBitLength(const MCP2515Frame &Frame)
+{
+  uint8_t StuffBits;
+
+  // Error will be set in calculateFrameBitLength()
+  return calculateFrameBitLength(Frame, StuffBits);
+}
+
+/**
+ * @brief Calculates the on-wire Length of a Frame and its Number of Stuff-Bits.
+ *
+ * Includes the Stuff-Bits (SOF till CRC, calculated with the real CRC-15 of the Frame), the CRC-Delimiter, ACK, EOF and the Interframe-Space.
+ * @param Frame Frame
+ * @param StuffBits Number of Stuff-Bits of the Frame
+ * @return Length in Bits, 0 on any error (check _lastMcpError)
+ */
+uint16_t MCP2515::calculateFrameBitLength(const MCP2515Frame &Frame, uint8_t &StuffBits)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_TRANSMISSION);
+
+  if ((Frame.id > 0x1FFFFFFF) ||
+      (!Frame.extended && Frame.id > 0x7FF) ||
+      (Frame.dlc > 8))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return 0;
+  }
+
+  return getFrameBitLength(Frame, StuffBits);
+}
+
+#ifdef MCP2515_ENABLE_BUS_LOAD
+/**
+ * @brief Get the Bus-Load of the transmitted and received Frames.
  *
- * 1 = RX1IE - Receive Buffer 1 Full Interrupt
+ * Only available when MCP2515_ENABLE_BUS_LOAD is defined.
  *
- * 0 = RX0IE - Receive Buffer 0 Full Interrupt
- * @return true when success, false on any error (Check _lastMcpError)
+ * Measured in a sliding Window of MCP2515_BUS_LOAD_SLOTS x MCP2515_BUS_LOAD_SLOT_TIME µs with the on-wire Length of each Frame
+ * (see calculateFrameBitLength()). Counted are the Frames transmitted by this Node (sendMessage(), sendMessageOneShot(),
+ * sendBuffers(), sendMessageTimeout(), startTransmission(), Transmit-Queue and cyclic Messages) and the Frames read with getAllFromReceiveBuffer().
+ * @return Bus-Load in ‰ of the Baudrate
  */
-bool MCP2515::changeInterruptSetting(bool value, uint8_t Interrupt)
+uint16_t MCP2515::getBusLoad()
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  uint32_t Now = micros();
 
-  if (!_isInitialized)
+  updateBusLoad(Now);
+
+  uint32_t Bits = 0;
+
+  for (uint8_t i = 0; i < MCP2515_BUS_LOAD_SLOTS; i++)
   {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
+    Bits += _busLoadBits[i];
   }
 
-  if ((Interrupt > 7) ||
-      (value != false && value != true))
+  uint32_t Duration = ((uint32_t)_busLoadSlotCount * MCP2515_BUS_LOAD_SLOT_TIME) + (Now - _busLoadSlotStart);
+
+  if ((Duration == 0) || (_baudRate == 0))
   {
-    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
-    return false;
+    return 0;
   }
 
-  uint8_t InterruptBit = 0x01 << Interrupt;
+  uint64_t Load = ((uint64_t)Bits * 1000000000ULL) / ((uint64_t)Duration * _baudRate);
 
-  uint8_t EnablerValue = (value) ? InterruptBit : 0x00;
+  return (Load > 1000) ? 1000 : (uint16_t)Load;
+}
 
-  if (!modifyCanInterruptEnable(InterruptBit, EnablerValue))
+/**
+ * @brief Get the Statistic of the Bus-Load (Frames, Bits and Stuff-Bits since the Construction or the last resetBusLoad()).
+ *
+ * Only available when MCP2515_ENABLE_BUS_LOAD is defined.
+ * @param Statistic Statistic
+ */
+void MCP2515::getBusLoadStatistic(MCP2515BusLoadStatistic &Statistic)
+{
+  Statistic = _busLoadStatistic;
+}
+
+/**
+ * @brief Resets the Bus-Load and its Statistic.
+ *
+ * Only available when MCP2515_ENABLE_BUS_LOAD is defined.
+ */
+void MCP2515::resetBusLoad()
+{
+  for (uint8_t i = 0; i < MCP2515_BUS_LOAD_SLOTS; i++)
   {
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CHANGE_INTERRUPT;
-    return false;
+    this->_busLoadBits[i] = 0;
   }
 
-  return true;
+  this->_busLoadSlot = 0;
+  this->_busLoadSlotCount = 0;
+  this->_busLoadSlotStart = micros();
+  this->_busLoadStatistic = MCP2515BusLoadStatistic();
 }
+#endif
 
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
 /**
- * @brief Enables the Filter/Mask for the given Receive-Buffer.
- * @param buffer Receive-Buffer-Number (0 - 1)
- * @return true when success, false on any error (Check _lastMcpError)
+ * @brief Registers a cyclic Message in the Scheduler.
+ *
+ * Only available when MCP2515_ENABLE_CYCLIC_MESSAGES is defined.
+ *
+ * The Message is released every Period, the first time at Offset after the Epoch of the Scheduler
+ * (Time when the first cyclic Message was registered).
+ *
+ * Released Messages are transmitted by processCyclicMessages().
+ * @param ID Message-ID
+ * @param Extended bool true if it is a Extended Frame
+ * @param DLC Data Length Code of the Message
+ * @param Data 8-Byte Data-Array (in total)
+ * @param Period Period of the Message in ms (1 - MCP2515_MAX_CYCLIC_PERIOD)
+ * @param Offset Offset of the Message in ms (0 - Period-1)
+ * @return Handle of the cyclic Message, MCP2515_CYCLIC_MESSAGE_INVALID on any error (Check _lastMcpError)
  */
-bool MCP2515::enableFilterMask(uint8_t buffer)
+uint8_t MCP2515::addCyclicMessage(uint32_t ID, bool Extended, uint8_t DLC, uint8_t Data[8], uint32_t Period, uint32_t Offset)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_CYCLIC_MESSAGES);
 
   if (!_isInitialized)
   {
     this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
+    return MCP2515_CYCLIC_MESSAGE_INVALID;
   }
 
-  if (buffer > 1)
+  if ((ID > 0x1FFFFFFF) ||
+      (Extended != false && Extended != true) ||
+      (!Extended && ID > 0x7FF) ||
+      (DLC > 8) ||
+      (Period == 0) || (Period > MCP2515_MAX_CYCLIC_PERIOD) ||
+      (Offset >= Period))
   {
     this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
-    return false;
+    return MCP2515_CYCLIC_MESSAGE_INVALID;
   }
 
-  switch (buffer)
+  uint8_t Handle = MCP2515_CYCLIC_MESSAGE_INVALID;
+
+  for (uint8_t i = 0; i < MCP2515_MAX_CYCLIC_MESSAGES; i++)
   {
-  case 0:
-    return modifyReceiveBuffer0Control(RXBnCTRL_BIT_RXM, 0x00);
-    break;
-  case 1:
-    return modifyReceiveBuffer1Control(RXBnCTRL_BIT_RXM, 0x00);
-    break;
-  default:
-    this->_lastMcpError = ERROR_MCP2515_UNKNOWN_SWITCH;
-    return false;
-    break;
+    if (!_cyclicMessages[i].active)
+    {
+      Handle = i;
+      break;
+    }
   }
+
+  if (Handle == MCP2515_CYCLIC_MESSAGE_INVALID)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NO_CYCLIC_SLOT_FREE;
+    return MCP2515_CYCLIC_MESSAGE_INVALID;
+  }
+
+  uint32_t Now = micros();
+
+  if (_cyclicHeapSize == 0)
+  {
+    this->_cyclicEpoch = Now;
+    this->_cyclicEpochSteps = 0;
+  } else {
+    updateCyclicEpoch(Now);
+  }
+
+  MCP2515CyclicMessage &Message = _cyclicMessages[Handle];
+
+  Message.id = ID;
+  Message.extended = Extended;
+  Message.dlc = DLC;
+  for (uint8_t i = 0; i < DLC; i++)
+  {
+    Message.data[i] = Data[i];
+  }
+  Message.period = Period * 1000;
+
+  // Keep the Phase to the Epoch but never release in the past (the Epoch can be older than 2^32 µs)
+  uint32_t Phase = (uint32_t)((((uint64_t)_cyclicEpochSteps * MCP2515_CYCLIC_EPOCH_STEP) + (Now - _cyclicEpoch)) % Message.period);
+
+  Message.nextRelease = Now + ((Offset * 1000 + Message.period - Phase) % Message.period);
+
+  Message.sendCount = 0;
+  Message.maxJitter = 0;
+  Message.jitterSum = 0;
+  Message.jitterCount = 0;
+  Message.deadlineMisses = 0;
+  Message.active = true;
+
+  this->_cyclicHeap[_cyclicHeapSize] = Handle;
+  this->_cyclicHeapSize++;
+  cyclicHeapSiftUp(_cyclicHeapSize - 1);
+
+  return Handle;
 }
 
 /**
- * @brief Disables the Filter/Mask for the given Receive-Buffer.
- * @param buffer Receive-Buffer-Number (0 - 1)
- * @return true when success, false on any error
+ * @brief Updates the Data of a registered cyclic Message.
+ *
+ * Only available when MCP2515_ENABLE_CYCLIC_MESSAGES is defined.
+ *
+ * The new Data will be used at the next Release of the Message.
+ * @param Handle Handle of the cyclic Message
+ * @param DLC Data Length Code of the Message
+ * @param Data 8-Byte Data-Array (in total)
+ * @return true when success, false on any error (Check _lastMcpError)
  */
-bool MCP2515::disableFilterMask(uint8_t buffer)
+bool MCP2515::updateCyclicMessage(uint8_t Handle, uint8_t DLC, uint8_t Data[8])
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_CYCLIC_MESSAGES);
 
   if (!_isInitialized)
   {
@@ -4244,216 +9074,243 @@ bool MCP2515::disableFilterMask(uint8_t buffer)
     return false;
   }
 
-  if (buffer > 1)
+  if ((Handle >= MCP2515_MAX_CYCLIC_MESSAGES) ||
+      (DLC > 8) ||
+      (!_cyclicMessages[Handle].active))
   {
     this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
     return false;
   }
 
-  switch (buffer)
+  MCP2515CyclicMessage &Message = _cyclicMessages[Handle];
+
+  Message.dlc = DLC;
+  for (uint8_t i = 0; i < DLC; i++)
   {
-  case 0:
-    return modifyReceiveBuffer0Control(RXBnCTRL_BIT_RXM, RXBnCTRL_BIT_RXM);
-    break;
-  case 1:
-    return modifyReceiveBuffer1Control(RXBnCTRL_BIT_RXM, RXBnCTRL_BIT_RXM);
-    break;
-  default:
-    this->_lastMcpError = ERROR_MCP2515_UNKNOWN_SWITCH;
-    return false;
-    break;
+    Message.data[i] = Data[i];
   }
+
+  return true;
 }
 
 /**
- * @brief Check if a Transmit-Buffer is free
- * @return 0xFF if no Transmit-Buffer is free
+ * @brief Removes a registered cyclic Message from the Scheduler.
  *
- * 0x0n - n = Number of the free Buffer
+ * Only available when MCP2515_ENABLE_CYCLIC_MESSAGES is defined.
+ * @param Handle Handle of the cyclic Message
+ * @return true when success, false on any error (Check _lastMcpError)
  */
-uint8_t MCP2515::check4FreeTransmitBuffer()
+bool MCP2515::removeCyclicMessage(uint8_t Handle)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_CYCLIC_MESSAGES);
 
   if (!_isInitialized)
   {
     this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return 0xFF;
+    return false;
   }
 
-  uint8_t Value = readStatusInstruction();
-
-  if ((Value & 0xA8) == 0x00)
+  if ((Handle >= MCP2515_MAX_CYCLIC_MESSAGES) ||
+      (!_cyclicMessages[Handle].active))
   {
-    this->_lastMcpError = ERROR_MCP2515_NO_TRANSMITBUFFER_FREE;
-    return 0xFF;
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
   }
 
-  for (size_t i = 0; i < 3; i++)
+  for (uint8_t i = 0; i < _cyclicHeapSize; i++)
   {
-    if ((Value & (0x08 << (2 * i))) != 0 )
+    if (_cyclicHeap[i] == Handle)
     {
-      return i;
+      this->_cyclicHeapSize--;
+      this->_cyclicHeap[i] = _cyclicHeap[_cyclicHeapSize];
+
+      if (i < _cyclicHeapSize)
+      {
+        cyclicHeapSiftDown(i);
+        cyclicHeapSiftUp(i);
+      }
       break;
     }
   }
 
-  this->_lastMcpError = ERROR_MCP2515_UNDEFINED;
-  return 0xFF;
+  this->_cyclicMessages[Handle].active = false;
+
+  return true;
 }
 
 /**
- * @brief Fill the given Transmit-Buffer with the given Data.
- * @param BufferNumber 0 - 2
- * @param ID Message-ID
- * @param Extended bool true if it is a Extended Frame
- * @param RTR bool true if it is a Remote Transmit request Message
- * @param DLC Data Length Code of the Message
- * @param Data 8-Byte Data-Array (in total)
- * @return true when success, false on any error (check _lastMcpError)
+ * @brief Transmits all released cyclic Messages.
+ *
+ * Only available when MCP2515_ENABLE_CYCLIC_MESSAGES is defined.
+ *
+ * Has to be called as often as possible (e.g. in every loop()).
+ *
+ * Each released Message is loaded into a free TX-Buffer (TXnIF set and TXREQ reset) and requested with Priority 0.
+ * TX-Buffers used by the Transmit-Queue (see processTransmitQueue()) or by startTransmission() are only free again
+ * after their Completion was handled there.
+ * When no TX-Buffer is free the Message stays released and will be transmitted at the next call.
+ *
+ * Periods that could not be served before the next Release-Time are skipped and counted as Deadline-Miss.
+ * @return Number of transmitted Messages (on Error check _lastMcpError)
  */
-bool MCP2515::fillTransmitBuffer(uint8_t BufferNumber, uint32_t ID, bool Extended, bool RTR, uint8_t DLC, uint8_t Data[8])
+uint8_t MCP2515::processCyclicMessages()
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_CYCLIC_MESSAGES);
 
   if (!_isInitialized)
   {
     this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
+    return 0;
   }
 
-  if ((BufferNumber > 2) ||
-      (ID > 0x1FFFFFFF) ||
-      (Extended != false && Extended != true) ||
-      (RTR != false && RTR != true) ||
-      (DLC > 8))
+  uint8_t Sent = 0;
+
+  if (_cyclicHeapSize > 0)
   {
-    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
-    return false;
+    updateCyclicEpoch(micros());
   }
 
-  if ((check4InterruptFlags() & (0x04 << BufferNumber)) != (0x04 << BufferNumber))
+  while (_cyclicHeapSize > 0)
   {
-    if (_lastMcpError != EMPTY_VALUE_16_BIT)
+    MCP2515CyclicMessage &Message = _cyclicMessages[_cyclicHeap[0]];
+
+    if ((int32_t)(micros() - Message.nextRelease) < 0)
     {
-      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CHECK_FREE_TRANSMIT_BUFFER;
-      return false;
+      break;
     }
 
-    this->_lastMcpError = ERROR_MCP2515_TRANSMITBUFFER_NOT_FREE;
-    return false;
-  }
+    // Search a free TX-Buffer (TXnIF set and TXREQ reset), Buffers whose Completion is not yet handled
+    // by the Transmit-Queue or handleInterrupt() still belong to them
+    uint8_t Status = readStatusInstruction();
+    uint8_t BufferNumber = 0xFF;
+    uint8_t Owned = _pendingTransmissions;
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+    Owned = Owned | _txQueueInFlight;
+#endif
 
-  uint8_t ErrorCount = 0;
-  if (Extended) {
-    ErrorCount = ErrorCount + (setTransmitBufferStandardIdentifierHigh(BufferNumber, (ID >> 21))) ? 0 : 1;
-    ErrorCount = ErrorCount + (setTransmitBufferStandardIdentifierLow(BufferNumber, ((ID >> 18) & 0x07), Extended, ((ID >> 16) & 0x03))) ? 0 : 1;
-    ErrorCount = ErrorCount + (setTransmitBufferExtendedIdentifierHigh(BufferNumber, ((ID >> 8) & 0xFF))) ? 0 : 1;
-    ErrorCount = ErrorCount + (setTransmitBufferExtendedIdentifierLow(BufferNumber, (ID & 0xFF))) ? 0 : 1;
-  } else {
-    ErrorCount = ErrorCount + (setTransmitBufferStandardIdentifierHigh(BufferNumber, (ID >> 3))) ? 0 : 1;
-    ErrorCount = ErrorCount + (setTransmitBufferStandardIdentifierLow(BufferNumber, (ID & 0x03), Extended, 0x00)) ? 0 : 1;
-    ErrorCount = ErrorCount + (setTransmitBufferExtendedIdentifierHigh(BufferNumber, 0x00)) ? 0 : 1;
-    ErrorCount = ErrorCount + (setTransmitBufferExtendedIdentifierLow(BufferNumber, 0x00)) ? 0 : 1;
-  }
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      if (((Status & (0x0C << (2 * i))) == (0x08 << (2 * i))) && !(Owned & (1 << i)))
+      {
+        BufferNumber = i;
+        break;
+      }
+    }
 
-  if (ErrorCount > 0)
-  {
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_TRANSMITBUFFER_ID_FILLING;
-    return false;
-  }
+    if (BufferNumber == 0xFF)
+    {
+      break;
+    }
 
-  if (RTR) {
-    ErrorCount = ErrorCount + (setTransmitBufferDataLengthCode(BufferNumber, RTR, DLC)) ? 0 : 1;
-  } else {
-    ErrorCount = ErrorCount + (setTransmitBufferDataLengthCode(BufferNumber, RTR, DLC)) ? 0 : 1;
+    // TXP is written together with TXREQ, so the Priority of a previous Transmission of this Buffer does not remain
+    if (!loadTransmitBuffer(BufferNumber, Message.id, Message.extended, false, Message.dlc, Message.data) ||
+        !bitModifyInstruction(REG_TXBnCTRL(BufferNumber), (TXBnCTRL_BIT_TXREQ | TXBnCTRL_BIT_TXP), TXBnCTRL_BIT_TXREQ))
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CYCLIC_SENDING;
+      return Sent;
+    }
 
-    for (int i = 0; i < DLC; i++) {
-      ErrorCount = ErrorCount + (setTransmitBufferDataByte(BufferNumber, i, Data[i])) ? 0 : 1;
+    // The Completion of cyclic Messages is not observed, so they are counted for the Bus-Load when released
+    MCP2515_BUS_LOAD_TX_COMPLETED(BufferNumber);
+
+    // A cyclic Message is handed to the Driver at its Release-Time
+    MCP2515_LATENCY_TX_ENQUEUED(BufferNumber, Message.nextRelease);
+    MCP2515_LATENCY_TX_STARTED(1 << BufferNumber);
+
+    uint32_t Jitter = micros() - Message.nextRelease;
+
+    Message.sendCount++;
+
+    if (Jitter > Message.maxJitter)
+    {
+      Message.maxJitter = Jitter;
     }
-  }
 
-  if (ErrorCount > 0)
-  {
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_TRANSMITBUFFER_DATA_FILLING;
-    return false;
-  }
+    // Prevent an Overflow of the Sum, the Average stays the same
+    if (Message.jitterSum > (0xFFFFFFFF - Jitter))
+    {
+      Message.jitterSum = Message.jitterSum / 2;
+      Message.jitterCount = Message.jitterCount / 2;
+    }
 
-  if (!resetInterruptFlag((0x02 + BufferNumber)))
-  {
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_RESET_FLAG;
-    return false;
+    Message.jitterSum += Jitter;
+    Message.jitterCount++;
+
+    // Skip all Periods which are already over
+    uint32_t Missed = Jitter / Message.period;
+
+    if (Missed > 0)
+    {
+      Message.deadlineMisses = ((uint32_t)Message.deadlineMisses + Missed > 0xFFFF) ? 0xFFFF : Message.deadlineMisses + Missed;
+    }
+
+    Message.nextRelease += (Missed + 1) * Message.period;
+    cyclicHeapSiftDown(0);
+
+    Sent++;
   }
 
-  return true;
+  return Sent;
 }
 
 /**
- * @brief Initiates a transmission for the given TX-Buffer
- * @param BufferNumber 0 - 2
- * @param Priority Message-Priority 0 - 3
- * @return true when success, false on any error (check _lastMcpError)
+ * @brief Get the Statistic of a cyclic Message.
+ *
+ * Only available when MCP2515_ENABLE_CYCLIC_MESSAGES is defined.
+ * @param Handle Handle of the cyclic Message
+ * @param Statistic Reference to the Statistic which will be filled
+ * @return true when success, false on any error (Check _lastMcpError)
  */
-bool MCP2515::sendMessage(uint8_t BufferNumber, uint8_t Priority)
+bool MCP2515::getCyclicMessageStatistic(uint8_t Handle, MCP2515CyclicStatistic &Statistic)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
-
-  if (!_isInitialized)
-  {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
-  }
+  ErrorContext Context(*this, MCP2515_CONTEXT_CYCLIC_MESSAGES);
 
-  if ((BufferNumber > 2) ||
-      (Priority > 3))
+  if ((Handle >= MCP2515_MAX_CYCLIC_MESSAGES) ||
+      (!_cyclicMessages[Handle].active))
   {
     this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
     return false;
   }
 
-  if (!modifyTransmitBufferControl(BufferNumber, 0x0B, (0x08 | Priority)))
-  {
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_INITIATE_SENDING;
-    return false;
-  }
-
-  bool aborted = false;
-  bool error_during_sending = false;
-  uint16_t ErrorValue = EMPTY_VALUE_16_BIT;
-
-  // While the Message Transmit Request bit is set
-  while (getTransmitBufferControl(BufferNumber) & TXBnCTRL_BIT_TXREQ) {
-    // Check if an error occures during the transmission
-    if ((getTransmitBufferControl(BufferNumber) & TXBnCTRL_BIT_TXERR) || (_lastMcpError != EMPTY_VALUE_16_BIT)) {
-
-      if (_lastMcpError != EMPTY_VALUE_16_BIT){
-        error_during_sending = true;
-        ErrorValue = ERROR_MCP2515_ERROR_DURING_SENDING;
-      }
-      // set aborted to true
-      aborted = true;
-
-      // In case of an error during the transmission,
-      // set the "Abort All Pending Transmissions"-bit
-      modifyCanControl(CANCTRL_BIT_ABAT, CANCTRL_BIT_ABAT);
+  MCP2515CyclicMessage &Message = _cyclicMessages[Handle];
 
-      // In case of "Abort All Pending Transmissions" the while-loop
-      // ended automaticaly when from the MCP2515 the Transmit Request bit is resetted.
-    }
+  Statistic.sendCount = Message.sendCount;
+  Statistic.maxJitter = Message.maxJitter;
+  Statistic.averageJitter = (Message.jitterCount > 0) ? (Message.jitterSum / Message.jitterCount) : 0;
+  Statistic.deadlineMisses = Message.deadlineMisses;
 
-    yield();
-  }
+  return true;
+}
 
-  if (aborted) {
-    // when the abortion is successfull reset the "Abort All Pending Transmissions"-bit
-    modifyCanControl(CANCTRL_BIT_ABAT, 0x00);
-    modifyCanInterruptFlag(0x1B, 0x1B);
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_MESSAGE_SENDING_ABORTED;
+/**
+ * @brief Reset the Statistic of a cyclic Message.
+ *
+ * Only available when MCP2515_ENABLE_CYCLIC_MESSAGES is defined.
+ * @param Handle Handle of the cyclic Message
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::resetCyclicMessageStatistic(uint8_t Handle)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_CYCLIC_MESSAGES);
+
+  if ((Handle >= MCP2515_MAX_CYCLIC_MESSAGES) ||
+      (!_cyclicMessages[Handle].active))
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
     return false;
   }
 
+  MCP2515CyclicMessage &Message = _cyclicMessages[Handle];
+
+  Message.sendCount = 0;
+  Message.maxJitter = 0;
+  Message.jitterSum = 0;
+  Message.jitterCount = 0;
+  Message.deadlineMisses = 0;
+
   return true;
 }
+#endif
 
 /**
  * @brief Check for the given Message-ID a RTR-Frame was received.
@@ -4463,7 +9320,7 @@ bool MCP2515::sendMessage(uint8_t BufferNumber, uint8_t Priority)
  */
 bool MCP2515::check4Rtr(uint32_t ID, bool Extended)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_RECEPTION);
 
   if (!_isInitialized)
   {
@@ -4482,6 +9339,8 @@ bool MCP2515::check4Rtr(uint32_t ID, bool Extended)
   {
     if ((rxStatusInstruction() & (0x40 + i * 0x40)) != 0)
     {
+      MCP2515_LATENCY_RX_AVAILABLE(CANINTF_BIT_RXnIF(i));
+
       bool RTR = false;
       switch (i)
       {
@@ -4557,6 +9416,8 @@ bool MCP2515::check4Rtr(uint32_t ID, bool Extended)
         continue;
       }
 
+      MCP2515_LATENCY_RX_CONSUMED(i);
+
       if (!modifyCanInterruptFlag(CANINTF_BIT_RXnIF(i), 0x00))
       {
         this->_lastMcpError = _lastMcpError | ERROR_MCP2515_RESET_FLAG;
@@ -4580,7 +9441,7 @@ bool MCP2515::check4Rtr(uint32_t ID, bool Extended)
  */
 bool MCP2515::check4Receive(uint32_t ID, bool Extended, uint8_t DLC, uint8_t (&DataBuffer)[8])
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_RECEPTION);
 
   if (!_isInitialized)
   {
@@ -4600,6 +9461,8 @@ bool MCP2515::check4Receive(uint32_t ID, bool Extended, uint8_t DLC, uint8_t (&D
   {
     if ((rxStatusInstruction() & (0x40 + i * 0x40)) != 0)
     {
+      MCP2515_LATENCY_RX_AVAILABLE(CANINTF_BIT_RXnIF(i));
+
       if ((getReceiveBufferStandardIdentifierLow(i) & RXBnSIDL_BIT_IDE) == RXBnSIDL_BIT_IDE)
       {
         if (!Extended)
@@ -4673,6 +9536,8 @@ bool MCP2515::check4Receive(uint32_t ID, bool Extended, uint8_t DLC, uint8_t (&D
         }
       }
 
+      MCP2515_LATENCY_RX_CONSUMED(i);
+
       if (!modifyCanInterruptFlag(CANINTF_BIT_RXnIF(i), 0x00))
       {
         this->_lastMcpError = _lastMcpError | ERROR_MCP2515_RESET_FLAG;
@@ -4693,7 +9558,7 @@ bool MCP2515::check4Receive(uint32_t ID, bool Extended, uint8_t DLC, uint8_t (&D
  */
 uint32_t MCP2515::getIdFromReceiveBuffer(uint8_t BufferNumber)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_RECEPTION);
 
   if (!_isInitialized)
   {
@@ -4732,23 +9597,283 @@ uint32_t MCP2515::getIdFromReceiveBuffer(uint8_t BufferNumber)
 
   if (_lastMcpError != EMPTY_VALUE_16_BIT)
   {
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_GET_EXTENDED_FLAG;
-    return EMPTY_VALUE_32_BIT;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_GET_EXTENDED_FLAG;
+    return EMPTY_VALUE_32_BIT;
+  }
+
+  return Message_ID;
+}
+
+/**
+ * @brief Get the DLC from the given RX-Buffer
+ * @param BufferNumber 0 - 1
+ * @return uint8_t Message-DLC
+ *
+ * On Error it will return EMPTY_VALUE_8_BIT (Check _lastMcpError).
+ */
+uint8_t MCP2515::getDlcFromReceiveBuffer(uint8_t BufferNumber)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_RECEPTION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (BufferNumber > 1)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return EMPTY_VALUE_8_BIT;
+  }
+
+  return (getReceiveBufferDataLengthCode(BufferNumber) & RXBnDLC_BIT_DLC);
+}
+
+/**
+ * @brief Get the Frame from the given RX-Buffer
+ * @param BufferNumber 0 - 1
+ * @return uint8_t Frame
+ *
+ * 0 = Standard Frame
+ *
+ * 1 = Extended Frame
+ *
+ * On Error it will return EMPTY_VALUE_8_BIT (Check _lastMcpError).
+ */
+uint8_t MCP2515::getFrameFromReceiveBuffer(uint8_t BufferNumber)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_RECEPTION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (BufferNumber > 1)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return EMPTY_VALUE_8_BIT;
+  }
+
+  if ((getReceiveBufferStandardIdentifierLow(BufferNumber) & RXBnSIDL_BIT_IDE) == RXBnSIDL_BIT_IDE)
+  {
+    return 1;
+  }else{
+    // Because getReceiveBufferStandardIdentifierLow() returns EMPTY_VALUE_8_BIT on Error,
+    // only to check here if Error occurs.
+    if (_lastMcpError != EMPTY_VALUE_16_BIT)
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_GET_EXTENDED_FLAG;
+    }
+
+    return 0;
+  }
+}
+
+/**
+ * @brief Get the Remote-Transmission-Request-Bit from the given RX-Buffer
+ * @param BufferNumber 0 - 1
+ * @return uint8_t RTR
+ *
+ * 0 = Message is not a Remote-Transmission-Request
+ *
+ * 1 = Message is a Remote-Transmission-Request
+ *
+ * On Error it will return EMPTY_VALUE_8_BIT (Check _lastMcpError).
+ */
+uint8_t MCP2515::getRtrFromReceiveBuffer(uint8_t BufferNumber)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_RECEPTION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (BufferNumber > 1)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return EMPTY_VALUE_8_BIT;
+  }
+
+  switch (BufferNumber)
+  {
+  case 0:
+    return ((getReceiveBuffer0Control() & RXBnCTRL_BIT_RXRTR) == RXBnCTRL_BIT_RXRTR) ? 1 : 0;
+    break;
+  case 1:
+    return ((getReceiveBuffer1Control() & RXBnCTRL_BIT_RXRTR) == RXBnCTRL_BIT_RXRTR) ? 1 : 0;
+    break;
+  default:
+    this->_lastMcpError = ERROR_MCP2515_UNKNOWN_SWITCH;
+    return EMPTY_VALUE_8_BIT;
+    break;
+  }
+  return EMPTY_VALUE_8_BIT;
+}
+
+/**
+ * @brief Get the Data from the given RX-Buffer
+ * @param BufferNumber 0 - 1
+ * @param DLC expected Data Length Code
+ * @param DataBuffer Message-Data-Buffer which has to be filled
+ * @return true when success, false on any error (check _lastMcpError)
+ */
+bool MCP2515::getDataFromReceiveBuffer(uint8_t BufferNumber, uint8_t DLC, uint8_t (&DataBuffer)[8])
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_RECEPTION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (BufferNumber > 1 || DLC > 8)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  for (size_t m = 0; m < DLC; m++)
+  {
+    DataBuffer[m] = getReceiveBufferDataByte(BufferNumber, m);
+
+    if (_lastMcpError != EMPTY_VALUE_16_BIT)
+    {
+      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_GET_DATA;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Get all Information from the given RX-Buffer.
+ *
+ * When all Information are collected it would be release the given RX-Buffer.
+ * @param BufferNumber 0 - 1
+ * @param ID Message-ID Variable which has to be filled
+ * @param Frame Frame Variable which has to be filled (true if Extended Frame, false if Standard Frame)
+ * @param RTR RTR Variable which has to be filled (true if RTR, false if not)
+ * @param DLC DLC Variable which has to be filled
+ * @param DataBuffer Message-Data-Buffer which has to be filled
+ * @return true when success, false on any error (check _lastMcpError)
+ */
+bool MCP2515::getAllFromReceiveBuffer(uint8_t BufferNumber, uint32_t (&ID), bool (&Frame), bool (&RTR), uint8_t (&DLC), uint8_t (&DataBuffer)[8])
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_RECEPTION);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return false;
+  }
+
+  if (BufferNumber > 1)
+  {
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
+  }
+
+  // Collect Data from the given RX-Buffer
+  uint8_t Data_RX_Controller = (BufferNumber == 0) ? getReceiveBuffer0Control() : getReceiveBuffer1Control();
+  uint8_t Data_Standard_High = getReceiveBufferStandardIdentifierHigh(BufferNumber);
+  uint8_t Data_Standard_Low = getReceiveBufferStandardIdentifierLow(BufferNumber);
+  uint8_t Data_Extended_High = getReceiveBufferExtendedIdentifierHigh(BufferNumber);
+  uint8_t Data_Extended_Low = getReceiveBufferExtendedIdentifierLow(BufferNumber);
+  uint8_t Data_DLC = getReceiveBufferDataLengthCode(BufferNumber);
+  uint8_t Data_Bytes[8];
+
+  for (size_t i = 0; i < 8; i++)
+  {
+    Data_Bytes[i] = getReceiveBufferDataByte(BufferNumber, i);
+  }
+
+  if (_lastMcpError != EMPTY_VALUE_16_BIT)
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_GET_ALL_DATA;
+    return false;
+  }
+
+  // Take the Start-of-Frame latched for this Buffer before the Buffer is released for the next Frame
+  noInterrupts();
+  this->_rxStartOfFrameValid = (_sofLatchedMask & (1 << BufferNumber)) != 0;
+  this->_rxStartOfFrame = _sofLatched[BufferNumber];
+  this->_sofLatchedMask = _sofLatchedMask & ~(1 << BufferNumber);
+  interrupts();
+
+  MCP2515_LATENCY_RX_CONSUMED(BufferNumber);
+
+  if (!modifyCanInterruptFlag(CANINTF_BIT_RXnIF(BufferNumber), 0x00))
+  {
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_RESET_FLAG;
+  }
+
+  bool RTR_Message = ((Data_RX_Controller & RXBnCTRL_BIT_RXRTR) == RXBnCTRL_BIT_RXRTR) ? true : false;
+  bool Extended_Frame = ((Data_Standard_Low & RXBnSIDL_BIT_IDE) == RXBnSIDL_BIT_IDE) ? true : false;
+
+  uint32_t ID_Message = ((Data_Standard_High << 3) & 0x07F8) |
+                        ((Data_Standard_Low >> 5) & 0x07);
+
+  if (Extended_Frame)
+  {
+    ID_Message = ((ID_Message << 18) & 0x1FFC0000) |
+                 ((((Data_Standard_Low & RXBnSIDL_BIT_EID) << 8) << 8) & 0x30000) |
+                 ((Data_Extended_High << 8) & 0xFF00) |
+                 Data_Extended_Low;
+  }
+
+  // Fill given Variables
+  ID = ID_Message;
+  Frame = Extended_Frame;
+  RTR = RTR_Message;
+
+  if (RTR_Message)
+  {
+    DLC = 0;
+    for (size_t m = 0; m < 8; m++)
+    {
+      DataBuffer[m] = 0;
+    }
+  } else {
+    DLC = Data_DLC & RXBnDLC_BIT_DLC;
+    for (size_t m = 0; m < DLC; m++)
+    {
+      DataBuffer[m] = Data_Bytes[m];
+    }
+  }
+
+#ifdef MCP2515_ENABLE_BUS_LOAD
+  // on-wire Length for the Bus-Load (an RTR-Frame transmits its DLC, but no Data)
+  MCP2515Frame Received = {ID_Message, Extended_Frame, RTR_Message, (uint8_t)(Data_DLC & RXBnDLC_BIT_DLC), {0}};
+
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    Received.data[i] = Data_Bytes[i];
   }
 
-  return Message_ID;
+  uint8_t StuffBits;
+  uint16_t Bits = getFrameBitLength(Received, StuffBits);
+
+  addBusLoad(Bits, StuffBits, false);
+#endif
+
+  return true;
 }
 
 /**
- * @brief Get the DLC from the given RX-Buffer
+ * @brief Release the given RX-Buffer
  * @param BufferNumber 0 - 1
- * @return uint8_t Message-DLC
- *
- * On Error it will return EMPTY_VALUE_8_BIT (Check _lastMcpError).
+ * @return true when success, false on any error (check _lastMcpError)
  */
-uint8_t MCP2515::getDlcFromReceiveBuffer(uint8_t BufferNumber)
+bool MCP2515::releaseReceiveBuffer(uint8_t BufferNumber)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_RECEPTION);
 
   if (!_isInitialized)
   {
@@ -4759,232 +9884,341 @@ uint8_t MCP2515::getDlcFromReceiveBuffer(uint8_t BufferNumber)
   if (BufferNumber > 1)
   {
     this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
-    return EMPTY_VALUE_8_BIT;
+    return false;
   }
 
-  return (getReceiveBufferDataLengthCode(BufferNumber) & RXBnDLC_BIT_DLC);
+  MCP2515_LATENCY_RX_CONSUMED(BufferNumber);
+
+  return modifyCanInterruptFlag(CANINTF_BIT_RXnIF(BufferNumber), 0x00);
 }
 
 /**
- * @brief Get the Frame from the given RX-Buffer
- * @param BufferNumber 0 - 1
- * @return uint8_t Frame
+ * @brief Check all Interrupts
+ * @return Bitwise
+ * Bit 7 -> MERRF - Message Error Interrupt Flag bit
  *
- * 0 = Standard Frame
+ * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
  *
- * 1 = Extended Frame
+ * 0 = No interrupt is pending
+ *
+ * Bit 6 -> WAKIF - Wake-up Interrupt Flag bit
+ *
+ * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
+ *
+ * 0 = No interrupt is pending
+ *
+ * Bit 5 -> ERRIF - Error Interrupt Flag bit (multiple sources in EFLG register)
+ *
+ * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
+ *
+ * 0 = No interrupt is pending
+ *
+ * Bit 4 -> TX2IF - Transmit Buffer 2 Empty Interrupt Flag bit
+ *
+ * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
+ *
+ * 0 = No interrupt is pending
+ *
+ * Bit 3 -> TX1IF - Transmit Buffer 1 Empty Interrupt Flag bit
+ *
+ * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
+ *
+ * 0 = No interrupt is pending
+ *
+ * Bit 2 -> TX0IF - Transmit Buffer 0 Empty Interrupt Flag bit
+ *
+ * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
+ *
+ * 0 = No interrupt is pending
+ *
+ * Bit 1 -> RX1IF - Receive Buffer 1 Full Interrupt Flag bit
+ *
+ * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
+ *
+ * 0 = No interrupt is pending
+ *
+ * Bit 0 -> RX0IF - Receive Buffer 0 Full Interrupt Flag bit
+ *
+ * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
+ *
+ * 0 = No interrupt is pending
  *
  * On Error it will return EMPTY_VALUE_8_BIT (Check _lastMcpError).
  */
-uint8_t MCP2515::getFrameFromReceiveBuffer(uint8_t BufferNumber)
+uint8_t MCP2515::check4InterruptFlags()
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_INTERRUPT);
 
   if (!_isInitialized)
   {
     this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
-  }
-
-  if (BufferNumber > 1)
-  {
-    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
     return EMPTY_VALUE_8_BIT;
   }
 
-  if ((getReceiveBufferStandardIdentifierLow(BufferNumber) & RXBnSIDL_BIT_IDE) == RXBnSIDL_BIT_IDE)
-  {
-    return 1;
-  }else{
-    // Because getReceiveBufferStandardIdentifierLow() returns EMPTY_VALUE_8_BIT on Error,
-    // only to check here if Error occurs.
-    if (_lastMcpError != EMPTY_VALUE_16_BIT)
-    {
-      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_GET_EXTENDED_FLAG;
-    }
+  uint8_t Flags = getCanInterruptFlag();
 
-    return 0;
-  }
+  MCP2515_LATENCY_RX_AVAILABLE(Flags);
+
+  return Flags;
 }
 
 /**
- * @brief Get the Remote-Transmission-Request-Bit from the given RX-Buffer
- * @param BufferNumber 0 - 1
- * @return uint8_t RTR
+ * @brief Resets the given Interrupt-Flag (only)
+ * @param Flag
+ * 7 = MERRF - Message Error Interrupt Flag
  *
- * 0 = Message is not a Remote-Transmission-Request
+ * 6 = WAKIF - Wake-up Interrupt Flag
  *
- * 1 = Message is a Remote-Transmission-Request
+ * 5 = ERRIF - Error Interrupt Flag
  *
- * On Error it will return EMPTY_VALUE_8_BIT (Check _lastMcpError).
+ * 4 = TX2IF - Transmit Buffer 2 Empty Interrupt Flag
+ *
+ * 3 = TX1IF - Transmit Buffer 1 Empty Interrupt Flag
+ *
+ * 2 = TX0IF - Transmit Buffer 0 Empty Interrupt Flag
+ *
+ * 1 = RX1IF - Receive Buffer 1 Full Interrupt Flag
+ *
+ * 0 = RX0IF - Receive Buffer 0 Full Interrupt Flag
+ * @return true when success, false on any error (check _lastMcpError)
  */
-uint8_t MCP2515::getRtrFromReceiveBuffer(uint8_t BufferNumber)
+bool MCP2515::resetInterruptFlag(uint8_t Flag)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_INTERRUPT);
 
   if (!_isInitialized)
   {
     this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
+    return EMPTY_VALUE_8_BIT;
   }
 
-  if (BufferNumber > 1)
+  if (Flag > 7)
   {
     this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
-    return EMPTY_VALUE_8_BIT;
+    return false;
   }
 
-  switch (BufferNumber)
-  {
-  case 0:
-    return ((getReceiveBuffer0Control() & RXBnCTRL_BIT_RXRTR) == RXBnCTRL_BIT_RXRTR) ? 1 : 0;
-    break;
-  case 1:
-    return ((getReceiveBuffer1Control() & RXBnCTRL_BIT_RXRTR) == RXBnCTRL_BIT_RXRTR) ? 1 : 0;
-    break;
-  default:
-    this->_lastMcpError = ERROR_MCP2515_UNKNOWN_SWITCH;
-    return EMPTY_VALUE_8_BIT;
-    break;
-  }
-  return EMPTY_VALUE_8_BIT;
+  return modifyCanInterruptFlag((0x01 << Flag), 0x00);
 }
 
 /**
- * @brief Get the Data from the given RX-Buffer
- * @param BufferNumber 0 - 1
- * @param DLC expected Data Length Code
- * @param DataBuffer Message-Data-Buffer which has to be filled
+ * @brief Sets the given Interrupt-Flag (only)
+ * @param Flag
+ * 7 = MERRF - Message Error Interrupt Flag
+ *
+ * 6 = WAKIF - Wake-up Interrupt Flag
+ *
+ * 5 = ERRIF - Error Interrupt Flag
+ *
+ * 4 = TX2IF - Transmit Buffer 2 Empty Interrupt Flag
+ *
+ * 3 = TX1IF - Transmit Buffer 1 Empty Interrupt Flag
+ *
+ * 2 = TX0IF - Transmit Buffer 0 Empty Interrupt Flag
+ *
+ * 1 = RX1IF - Receive Buffer 1 Full Interrupt Flag
+ *
+ * 0 = RX0IF - Receive Buffer 0 Full Interrupt Flag
  * @return true when success, false on any error (check _lastMcpError)
  */
-bool MCP2515::getDataFromReceiveBuffer(uint8_t BufferNumber, uint8_t DLC, uint8_t (&DataBuffer)[8])
+bool MCP2515::setInterruptFlag(uint8_t Flag)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_INTERRUPT);
 
   if (!_isInitialized)
   {
     this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
+    return EMPTY_VALUE_8_BIT;
   }
 
-  if (BufferNumber > 1 || DLC > 8)
+  if (Flag > 7)
   {
     this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
     return false;
   }
 
-  for (size_t m = 0; m < DLC; m++)
-  {
-    DataBuffer[m] = getReceiveBufferDataByte(BufferNumber, m);
-
-    if (_lastMcpError != EMPTY_VALUE_16_BIT)
-    {
-      this->_lastMcpError = _lastMcpError | ERROR_MCP2515_GET_DATA;
-      return false;
-    }
-  }
+  return modifyCanInterruptFlag((0x01 << Flag), (0x01 << Flag));
+}
 
-  return true;
+/**
+ * @brief Sets the Callback which is called for each completed Transmission (see startTransmission()).
+ * @param Callback Function or NULL to disable the Callback
+ */
+void MCP2515::setTransmitCallback(MCP2515TransmitCallback Callback)
+{
+  this->_transmitCallback = Callback;
 }
 
 /**
- * @brief Get all Information from the given RX-Buffer.
+ * @brief Handles the pending Interrupts of the MCP2515.
  *
- * When all Information are collected it would be release the given RX-Buffer.
- * @param BufferNumber 0 - 1
- * @param ID Message-ID Variable which has to be filled
- * @param Frame Frame Variable which has to be filled (true if Extended Frame, false if Standard Frame)
- * @param RTR RTR Variable which has to be filled (true if RTR, false if not)
- * @param DLC DLC Variable which has to be filled
- * @param DataBuffer Message-Data-Buffer which has to be filled
- * @return true when success, false on any error (check _lastMcpError)
+ * Completed Transmissions (see startTransmission()) are reported to the Transmit-Callback.
+ * Asynchronous Transmissions of sendMessageTimeout() whose Timeout is over are aborted.
+ * The Flags are read from the TXBnCTRL-Register (MLOA, ABTF, TXERR), when the Message was not transmitted
+ * (e.g. One-Shot-Mode or aborted) MCP2515_TX_FLAG_NOT_TRANSMITTED is added and the Buffer is marked as free again.
+ *
+ * After enterSleepMode() a Wake-Up (WAKIF) is handled: the previous Operation-Mode is restored and the Time until the
+ * first received Frame is measured (see getWakeUpLatency()).
+ * @note Uses SPI, so call it from the loop (e.g. when the INT-Pin is low) and not from an Interrupt-Service-Routine.
+ * @return Handled Interrupt-Flags (Bit-Positions like the CANINTF-Register)
+ *
+ * On Error it will return EMPTY_VALUE_8_BIT (Check _lastMcpError).
  */
-bool MCP2515::getAllFromReceiveBuffer(uint8_t BufferNumber, uint32_t (&ID), bool (&Frame), bool (&RTR), uint8_t (&DLC), uint8_t (&DataBuffer)[8])
+uint8_t MCP2515::handleInterrupt()
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_INTERRUPT);
 
   if (!_isInitialized)
   {
     this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return false;
+    return EMPTY_VALUE_8_BIT;
   }
 
-  if (BufferNumber > 1)
+  uint8_t Handled = EMPTY_VALUE_8_BIT;
+
+  // Wake-Up from the Sleep-Mode (see enterSleepMode())
+  if ((_sleepPreviousMode != 0xFF) && handleWakeUp())
   {
-    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
-    return false;
+    Handled = Handled | CANINTF_BIT_WAKIF;
   }
 
-  // Collect Data from the given RX-Buffer
-  uint8_t Data_RX_Controller = (BufferNumber == 0) ? getReceiveBuffer0Control() : getReceiveBuffer1Control();
-  uint8_t Data_Standard_High = getReceiveBufferStandardIdentifierHigh(BufferNumber);
-  uint8_t Data_Standard_Low = getReceiveBufferStandardIdentifierLow(BufferNumber);
-  uint8_t Data_Extended_High = getReceiveBufferExtendedIdentifierHigh(BufferNumber);
-  uint8_t Data_Extended_Low = getReceiveBufferExtendedIdentifierLow(BufferNumber);
-  uint8_t Data_DLC = getReceiveBufferDataLengthCode(BufferNumber);
-  uint8_t Data_Bytes[8];
+  // Change of the Error-Counters (see enableBusStateMonitoring())
+  if (_busStateMonitoring && (readInstruction(REG_CANINTF) & CANINTF_BIT_ERRIF))
+  {
+    if (!updateBusState())
+    {
+      // Error will be set in updateBusState()
+      return EMPTY_VALUE_8_BIT;
+    }
 
-  for (size_t i = 0; i < 8; i++)
+    Handled = Handled | CANINTF_BIT_ERRIF;
+  }
+
+  // First received Frame after the Wake-Up (it stays in the RX-Buffer)
+  if (_wakeUpPending && (readStatusInstruction() & (CANINTF_BIT_RXnIF(0) | CANINTF_BIT_RXnIF(1))))
   {
-    Data_Bytes[i] = getReceiveBufferDataByte(BufferNumber, i);
+    this->_wakeUpLatency = micros() - _wakeUpTime;
+    this->_wakeUpPending = false;
   }
 
-  if (_lastMcpError != EMPTY_VALUE_16_BIT)
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+  // Received Frames after an INT-Edge (see captureInterrupt()), READ STATUS: RXnIF is Bit n
+  if (_interruptCaptured)
   {
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_GET_ALL_DATA;
+    noteReceiveAvailable(readStatusInstruction());
+  }
+#endif
+
+  if (_pendingTransmissions != 0x00)
+  {
+    // READ STATUS: TXREQn is Bit 2 + 2n, TXnIF is Bit 3 + 2n
+    uint8_t Status = readStatusInstruction();
+    uint32_t Timestamp = micros();
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+      if (!(_pendingTransmissions & (1 << i)))
+      {
+        continue;
+      }
+
+      if (Status & (0x04 << (2 * i)))
+      {
+        // Timeout of sendMessageTimeout(): withdraw only the Transmit Request of this Buffer,
+        // the Completion is reported at the next call
+        if ((_transmitDeadlineMask & (1 << i)) && ((int32_t)(Timestamp - _transmitDeadline[i]) >= 0))
+        {
+          bitModifyInstruction(REG_TXBnCTRL(i), TXBnCTRL_BIT_TXREQ, 0x00);
+          this->_transmitDeadlineMask = _transmitDeadlineMask & ~(1 << i);
+        }
+        continue;
+      }
+
+      uint8_t Flags = getTransmitBufferControl(i) & (TXBnCTRL_BIT_ABTF | TXBnCTRL_BIT_MLOA | TXBnCTRL_BIT_TXERR);
+
+      // TXnIF marks the Buffer as free, so the Interrupt has to be disabled after the Completion
+      modifyCanInterruptEnable(CANINTE_BIT_TXnIE(i), 0x00);
+
+      if (!(Status & (0x08 << (2 * i))))
+      {
+        Flags = Flags | MCP2515_TX_FLAG_NOT_TRANSMITTED;
+        bitModifyInstruction(REG_CANINTF, CANINTF_BIT_TXnIF(i), CANINTF_BIT_TXnIF(i));
+      } else {
+        MCP2515_BUS_LOAD_TX_COMPLETED(i);
+        MCP2515_LATENCY_TX_COMPLETED(i);
+      }
+
+      this->_pendingTransmissions = _pendingTransmissions & ~(1 << i);
+      this->_transmitDeadlineMask = _transmitDeadlineMask & ~(1 << i);
+      Handled = Handled | CANINTF_BIT_TXnIF(i);
+
+      if (_transmitCallback != NULL)
+      {
+        _transmitCallback(i, _transmitTag[i], Timestamp, Flags);
+      }
+    }
+  }
+
+  return Handled;
+}
+
+/**
+ * @brief Enables the Monitoring of the Bus-State (Error-Active, Warning, Error-Passive, Bus-Off).
+ *
+ * The Error-Interrupt (ERRIE) is enabled, on ERRIF handleInterrupt() reads TEC, REC and EFLG and calls the Callback when the Bus-State changed.
+ *
+ * With BusOffBackoff = MCP2515_BUS_OFF_RECOVERY_AUTOMATIC the MCP2515 recovers from Bus-Off by itself (after 128 x 11 recessive Bits).
+ * Otherwise it is held in the Configuration-Mode for BusOffBackoff ms and processBusState() recovers it afterwards
+ * with a Reset and a Restore of the Configuration (see captureSnapshot()). Meanwhile Transmissions fail with ERROR_MCP2515_BUS_OFF.
+ * @note Enable it again after init(), the Reset disables the Error-Interrupt.
+ * @param Callback called on every Change of the Bus-State (NULL = no Callback)
+ * @param BusOffBackoff Time before the Bus-Off-Recovery in ms (0 - MCP2515_MAX_BUS_OFF_BACKOFF)
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+bool MCP2515::enableBusStateMonitoring(MCP2515BusStateCallback Callback, uint32_t BusOffBackoff)
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_INTERRUPT);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
     return false;
   }
 
-  if (!modifyCanInterruptFlag(CANINTF_BIT_RXnIF(BufferNumber), 0x00))
+  if (BusOffBackoff > MCP2515_MAX_BUS_OFF_BACKOFF)
   {
-    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_RESET_FLAG;
+    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    return false;
   }
 
-  bool RTR_Message = ((Data_RX_Controller & RXBnCTRL_BIT_RXRTR) == RXBnCTRL_BIT_RXRTR) ? true : false;
-  bool Extended_Frame = ((Data_Standard_Low & RXBnSIDL_BIT_IDE) == RXBnSIDL_BIT_IDE) ? true : false;
-
-  uint32_t ID_Message = ((Data_Standard_High << 3) & 0x07F8) |
-                        ((Data_Standard_Low >> 5) & 0x07);
+  this->_busStateCallback = Callback;
+  this->_busOffBackoff = BusOffBackoff * 1000;
 
-  if (Extended_Frame)
+  if (!modifyCanInterruptEnable(CANINTE_BIT_ERRIE, CANINTE_BIT_ERRIE))
   {
-    ID_Message = ((ID_Message << 18) & 0x1FFC0000) |
-                 ((((Data_Standard_Low & RXBnSIDL_BIT_EID) << 8) << 8) & 0x30000) |
-                 ((Data_Extended_High << 8) & 0xFF00) |
-                 Data_Extended_Low;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CHANGE_INTERRUPT;
+    return false;
   }
 
-  // Fill given Variables
-  ID = ID_Message;
-  Frame = Extended_Frame;
-  RTR = RTR_Message;
+  this->_busStateMonitoring = true;
 
-  if (RTR_Message)
+  // Take over the actual Bus-State
+  if (!updateBusState())
   {
-    DLC = 0;
-    for (size_t m = 0; m < 8; m++)
-    {
-      DataBuffer[m] = 0;
-    }
-  } else {
-    DLC = Data_DLC & RXBnDLC_BIT_DLC;
-    for (size_t m = 0; m < DLC; m++)
-    {
-      DataBuffer[m] = Data_Bytes[m];
-    }
+    // Error will be set in updateBusState()
+    return false;
   }
 
   return true;
 }
 
 /**
- * @brief Release the given RX-Buffer
- * @param BufferNumber 0 - 1
- * @return true when success, false on any error (check _lastMcpError)
+ * @brief Disables the Monitoring of the Bus-State and the Error-Interrupt (ERRIE).
+ * @return true when success, false on any error (Check _lastMcpError)
  */
-bool MCP2515::releaseReceiveBuffer(uint8_t BufferNumber)
+bool MCP2515::disableBusStateMonitoring()
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_INTERRUPT);
 
   if (!_isInitialized)
   {
@@ -4992,157 +10226,202 @@ bool MCP2515::releaseReceiveBuffer(uint8_t BufferNumber)
     return false;
   }
 
-  if (BufferNumber > 1)
+  if (!modifyCanInterruptEnable(CANINTE_BIT_ERRIE, 0x00))
   {
-    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    this->_lastMcpError = _lastMcpError | ERROR_MCP2515_CHANGE_INTERRUPT;
     return false;
   }
 
-  return modifyCanInterruptFlag(CANINTF_BIT_RXnIF(BufferNumber), 0x00);
+  this->_busStateMonitoring = false;
+  this->_busOffBackoff = MCP2515_BUS_OFF_RECOVERY_AUTOMATIC;
+
+  return true;
 }
 
 /**
- * @brief Check all Interrupts
- * @return Bitwise
- * Bit 7 -> MERRF - Message Error Interrupt Flag bit
- *
- * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
- *
- * 0 = No interrupt is pending
- *
- * Bit 6 -> WAKIF - Wake-up Interrupt Flag bit
- *
- * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
- *
- * 0 = No interrupt is pending
- *
- * Bit 5 -> ERRIF - Error Interrupt Flag bit (multiple sources in EFLG register)
- *
- * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
- *
- * 0 = No interrupt is pending
- *
- * Bit 4 -> TX2IF - Transmit Buffer 2 Empty Interrupt Flag bit
- *
- * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
+ * @brief Follows the Bus-State while it is not Error-Active and recovers from Bus-Off after the Backoff (see enableBusStateMonitoring()).
  *
- * 0 = No interrupt is pending
- *
- * Bit 3 -> TX1IF - Transmit Buffer 1 Empty Interrupt Flag bit
- *
- * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
- *
- * 0 = No interrupt is pending
- *
- * Bit 2 -> TX0IF - Transmit Buffer 0 Empty Interrupt Flag bit
- *
- * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
- *
- * 0 = No interrupt is pending
- *
- * Bit 1 -> RX1IF - Receive Buffer 1 Full Interrupt Flag bit
- *
- * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
- *
- * 0 = No interrupt is pending
- *
- * Bit 0 -> RX0IF - Receive Buffer 0 Full Interrupt Flag bit
- *
- * 1 = Interrupt is pending (must be cleared by MCU to reset the interrupt condition)
- *
- * 0 = No interrupt is pending
+ * While the Bus-State is Error-Active no SPI-Communication takes place, so it can be called in every loop.
+ * @return uint8_t actual Bus-State (MCP2515_BUS_STATE_*)
  *
- * On Error it will return EMPTY_VALUE_8_BIT (Check _lastMcpError).
+ * On Error it will return 0xFF (Check _lastMcpError).
  */
-uint8_t MCP2515::check4InterruptFlags()
+uint8_t MCP2515::processBusState()
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_INTERRUPT);
 
   if (!_isInitialized)
   {
     this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return EMPTY_VALUE_8_BIT;
+    return 0xFF;
+  }
+
+  if (!_busStateMonitoring || (_busState == MCP2515_BUS_STATE_ERROR_ACTIVE))
+  {
+    return _busState;
   }
 
-  return getCanInterruptFlag();
+  if ((_busState == MCP2515_BUS_STATE_BUS_OFF) && (_busOffBackoff != MCP2515_BUS_OFF_RECOVERY_AUTOMATIC))
+  {
+    if ((micros() - _busOffTime) >= _busOffBackoff)
+    {
+      if (!recoverFromBusOff())
+      {
+        // Error will be set in recoverFromBusOff()
+        return 0xFF;
+      }
+    }
+
+    return _busState;
+  }
+
+  // TEC and REC decrease with successful Frames, without an Error-Interrupt
+  if (!updateBusState())
+  {
+    // Error will be set in updateBusState()
+    return 0xFF;
+  }
+
+  return _busState;
 }
 
 /**
- * @brief Resets the given Interrupt-Flag (only)
- * @param Flag
- * 7 = MERRF - Message Error Interrupt Flag
- *
- * 6 = WAKIF - Wake-up Interrupt Flag
- *
- * 5 = ERRIF - Error Interrupt Flag
- *
- * 4 = TX2IF - Transmit Buffer 2 Empty Interrupt Flag
- *
- * 3 = TX1IF - Transmit Buffer 1 Empty Interrupt Flag
- *
- * 2 = TX0IF - Transmit Buffer 0 Empty Interrupt Flag
- *
- * 1 = RX1IF - Receive Buffer 1 Full Interrupt Flag
- *
- * 0 = RX0IF - Receive Buffer 0 Full Interrupt Flag
- * @return true when success, false on any error (check _lastMcpError)
+ * @brief Reads the Transmit- and Receive-Error-Counter of the MCP2515.
+ * @note Doc p. 49; Kap. 6.6
+ * @param TransmitErrorCounter TEC
+ * @param ReceiveErrorCounter REC
+ * @return true when success, false on any error (Check _lastMcpError)
  */
-bool MCP2515::resetInterruptFlag(uint8_t Flag)
+bool MCP2515::getErrorCounters(uint8_t &TransmitErrorCounter, uint8_t &ReceiveErrorCounter)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  ErrorContext Context(*this, MCP2515_CONTEXT_INTERRUPT);
 
   if (!_isInitialized)
   {
     this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return EMPTY_VALUE_8_BIT;
+    return false;
   }
 
-  if (Flag > 7)
+  uint8_t Counters[2];
+
+  if (!readInstruction(REG_TEC, Counters, 2))
   {
-    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
+    // Error will be set in readInstruction()
     return false;
   }
 
-  return modifyCanInterruptFlag((0x01 << Flag), 0x00);
+  TransmitErrorCounter = Counters[0];
+  ReceiveErrorCounter = Counters[1];
+
+  return true;
 }
 
 /**
- * @brief Sets the given Interrupt-Flag (only)
- * @param Flag
- * 7 = MERRF - Message Error Interrupt Flag
- *
- * 6 = WAKIF - Wake-up Interrupt Flag
- *
- * 5 = ERRIF - Error Interrupt Flag
- *
- * 4 = TX2IF - Transmit Buffer 2 Empty Interrupt Flag
- *
- * 3 = TX1IF - Transmit Buffer 1 Empty Interrupt Flag
- *
- * 2 = TX0IF - Transmit Buffer 0 Empty Interrupt Flag
- *
- * 1 = RX1IF - Receive Buffer 1 Full Interrupt Flag
+ * @brief Get the Bus-State of the last Update (see enableBusStateMonitoring())
+ * @return uint8_t MCP2515_BUS_STATE_*
+ */
+uint8_t MCP2515::getBusState()
+{
+  return _busState;
+}
+
+/**
+ * @brief Get the Time of the last Bus-Off-Recovery (from the Detection of Bus-Off until the MCP2515 left Bus-Off)
+ * @return uint32_t Recovery-Time in µs (0 = no Recovery until now)
+ */
+uint32_t MCP2515::getBusOffRecoveryTime()
+{
+  return _busOffRecoveryTime;
+}
+
+/**
+ * @brief Get the Count of detected Bus-Offs since the Construction of the Object
+ * @return uint16_t Count of Bus-Offs
+ */
+uint16_t MCP2515::getBusOffCount()
+{
+  return _busOffCount;
+}
+
+/**
+ * @brief Stores the Timestamp of a Start-of-Frame-Signal (see setClockOutput() with MCP2515_CLKOUT_SOF).
  *
- * 0 = RX0IF - Receive Buffer 0 Full Interrupt Flag
- * @return true when success, false on any error (check _lastMcpError)
+ * Call it from the Interrupt-Service-Routine of the Pin connected to CLKOUT (or with the Value of an Input-Capture-Timer).
+ * Every Frame on the Bus generates a Start-of-Frame, also Frames which are not accepted by the Filters and own Transmissions.
+ * @note Uses no SPI and can be called from an Interrupt-Service-Routine.
+ * @param Timestamp Time of the Start-of-Frame in any Unit (e.g. micros() or Timer-Ticks)
  */
-bool MCP2515::setInterruptFlag(uint8_t Flag)
+void MCP2515::captureStartOfFrame(uint32_t Timestamp)
 {
-  this->_lastMcpError = EMPTY_VALUE_16_BIT;
+  this->_sofTimestamp = Timestamp;
+  this->_sofCount = _sofCount + 1;
+}
 
-  if (!_isInitialized)
+/**
+ * @brief Assigns the last Start-of-Frame (see captureStartOfFrame()) to the Frame which was just received into a RX-Buffer.
+ *
+ * Call it from the Interrupt-Service-Routine of the falling Edge of the RXnBF-Pin (BFPCTRL BnBFM and BnBFE set) of the
+ * Buffer or of the INT-Pin when only the Receive-Interrupt of this Buffer is enabled. The Interrupt is generated at the
+ * End of the Frame and the next Start-of-Frame follows at least 3 Bit-Times later (Interframe-Space), so the last
+ * Start-of-Frame belongs to the received Frame.
+ *
+ * The Timestamp is dropped when no Start-of-Frame was captured since the last latched Frame or when one is captured
+ * while it is latched.
+ * @note Uses no SPI and can be called from an Interrupt-Service-Routine. It has to run within 3 Bit-Times after the
+ * End of the Frame (6 µs at 500 kBit/s), a later Call can assign the Start-of-Frame of the next Frame undetected.
+ * @param BufferNumber Number of the RX-Buffer (0 - 1)
+ */
+void MCP2515::latchStartOfFrame(uint8_t BufferNumber)
+{
+  if (BufferNumber > 1)
   {
-    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
-    return EMPTY_VALUE_8_BIT;
+    return;
   }
 
-  if (Flag > 7)
+  uint32_t Count = _sofCount;
+  uint32_t Timestamp = _sofTimestamp;
+
+  // The Start-of-Frame belongs to a previous Frame or a new one was captured in between
+  if ((Count == _sofLatchedCount) || (Count != _sofCount))
+  {
+    this->_sofLatchedMask = _sofLatchedMask & ~(1 << BufferNumber);
+    return;
+  }
+
+  this->_sofLatchedCount = Count;
+  this->_sofLatched[BufferNumber] = Timestamp;
+  this->_sofLatchedMask = _sofLatchedMask | (1 << BufferNumber);
+}
+
+/**
+ * @brief Get the Start-of-Frame-Timestamp of the last Frame read with getAllFromReceiveBuffer().
+ * @param Timestamp Timestamp of the Start-of-Frame (Unit of captureStartOfFrame())
+ * @return true when the Frame has a latched Start-of-Frame (see latchStartOfFrame()), otherwise false
+ */
+bool MCP2515::getStartOfFrameTimestamp(uint32_t &Timestamp)
+{
+  if (!_rxStartOfFrameValid)
   {
-    this->_lastMcpError = ERROR_MCP2515_VALUE_OUTA_RANGE;
     return false;
   }
 
-  return modifyCanInterruptFlag((0x01 << Flag), (0x01 << Flag));
+  Timestamp = _rxStartOfFrame;
+  return true;
+}
+
+/**
+ * @brief Get the Count of captured Start-of-Frame-Signals (see captureStartOfFrame()).
+ *
+ * The Difference of two Values is the Count of Frames on the Bus in between (e.g. to calculate the Bus-Load).
+ * @return uint32_t Count of Start-of-Frames since the Construction of the Object (overflows)
+ */
+uint32_t MCP2515::getStartOfFrameCount()
+{
+  noInterrupts();
+  uint32_t Count = _sofCount;
+  interrupts();
+
+  return Count;
 }
 
 /**
@@ -5225,6 +10504,26 @@ uint8_t MCP2515::getOperationMode()
   return _operationMode;
 }
 
+/**
+ * @brief Get the Time of the last Change of the Operation-Mode (from the Request until CANSTAT.OPMOD shows the new Operation-Mode).
+ * @return Time in µs
+ */
+uint32_t MCP2515::getLastModeTransitionTime()
+{
+  return _modeTransitionTime;
+}
+
+/**
+ * @brief Get the Time from the last Wake-Up (see enterSleepMode()) until the first received Frame.
+ *
+ * Measured from the Handling of the Wake-Up-Interrupt until handleInterrupt() finds the first Frame in a RX-Buffer.
+ * @return uint32_t Wake-Up-Latency in µs (0 = no Frame received since the Wake-Up)
+ */
+uint32_t MCP2515::getWakeUpLatency()
+{
+  return _wakeUpLatency;
+}
+
 /**
  * @brief Get the Baudrate of the CAN-Communication
  * @return uint32_t Value of the Baudrate in Bd (Baud)
@@ -5234,6 +10533,24 @@ uint32_t MCP2515::getBaudRate()
   return _baudRate;
 }
 
+/**
+ * @brief Get the Deviation of the Bitrate of the actual Bit-Timing
+ * @return Deviation in ppm (positive = faster than the Baudrate)
+ */
+int32_t MCP2515::getBitRateError()
+{
+  return _bitRateError;
+}
+
+/**
+ * @brief Get the Sample-Point of the actual Bit-Timing
+ * @return Sample-Point in ‰ of the Bittime
+ */
+uint16_t MCP2515::getSamplePoint()
+{
+  return _actualSamplePoint;
+}
+
 /**
  * @brief Get the Initialisation-Status of the MCP2515
  * @return bool
@@ -5259,3 +10576,61 @@ bool MCP2515::getReCheckEnabled()
 {
   return _reCheckEnabled;
 }
+
+/**
+ * @brief Get the Status of the Register-Cache (see setRegisterCacheEnabler())
+ * @return bool
+ *
+ * True = Register-Cache is enabled
+ *
+ * False = Register-Cache is disabled
+ */
+bool MCP2515::getRegisterCacheEnabled()
+{
+  return _registerCacheEnabled;
+}
+
+/**
+ * @brief Get the One-Shot-Status of the MCP2515
+ * @return bool
+ *
+ * True = One-Shot-Mode is enabled
+ *
+ * False = One-Shot-Mode is disabled
+ */
+bool MCP2515::getOneShotMode()
+{
+  return _oneShotMode;
+}
+
+/**
+ * @brief Get the Configuration of the CLKOUT-Pin (see setClockOutput())
+ * @return uint8_t MCP2515_CLKOUT_DISABLED, MCP2515_CLKOUT_CLOCK or MCP2515_CLKOUT_SOF
+ *
+ * On Error it will return 0xFF (Check _lastMcpError).
+ */
+uint8_t MCP2515::getClockOutput()
+{
+  ErrorContext Context(*this, MCP2515_CONTEXT_SETTINGS);
+
+  if (!_isInitialized)
+  {
+    this->_lastMcpError = ERROR_MCP2515_NOT_INITIALIZED;
+    return 0xFF;
+  }
+
+  uint8_t CanControl = getCanControl();
+  uint8_t ConfigurationRegister3 = getConfigurationRegister3();
+
+  if (_lastMcpError != EMPTY_VALUE_16_BIT)
+  {
+    return 0xFF;
+  }
+
+  if ((CanControl & CANCTRL_BIT_CLKEN) == 0x00)
+  {
+    return MCP2515_CLKOUT_DISABLED;
+  }
+
+  return ((ConfigurationRegister3 & CNF3_BIT_SOF) != 0x00) ? MCP2515_CLKOUT_SOF : MCP2515_CLKOUT_CLOCK;
+}
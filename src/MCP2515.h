@@ -16,6 +16,7 @@
 #include <SPI.h>
 #include "MCP2515Register.h"
 #include "MCP2515Error.h"
+#include "MCP2515BitTiming.h"
 
 /**
  * @brief Constants for SPI-Communication
@@ -23,6 +24,7 @@
 
 #define MCP2515_DEFAULT_CLOCK_FREQUENCY 8e6		// max Clock frequency is 40MHz (see doc page 75)
 #define MCP2515_MAX_CLOCK_FREQUENCY 40e6		// max Clock frequency is 40MHz (see doc page 75)
+#define MCP2515_MIN_CLOCK_FREQUENCY 1e6
 #define MCP2515_MAX_SPI_SPEED 10e6				// max SPI-Speed (see doc page 77 or 1)
 
 /**
@@ -75,13 +77,561 @@
 #define MCP2515_OP_LISTEN			0x03
 #define MCP2515_OP_CONFIGURATION	0x04
 
+/**
+ * MCP2515 CLKOUT-Modes (see setClockOutput())
+ */
+
+#define MCP2515_CLKOUT_DISABLED		0x00	// CLKOUT-Pin disabled (high impedance)
+#define MCP2515_CLKOUT_CLOCK		0x01	// CLKOUT-Pin outputs the Clock divided by the Prescaler
+#define MCP2515_CLKOUT_SOF			0x02	// CLKOUT-Pin outputs the Start-of-Frame-Signal
+
 
 /**
  * MCP2515 other Constants
  */
 
 #define MCP2515_DEFAULT_BAUDRATE	500E3
+#define MCP2515_MIN_BAUDRATE		1E3
+#define MCP2515_MAX_BAUDRATE		1000E3
+
+/**
+ * MCP2515 Bit-Timing
+ */
+
+#define MCP2515_DEFAULT_SAMPLE_POINT			875		// Sample-Point in ‰ of the Bittime (CiA 301)
+#define MCP2515_DEFAULT_MAX_BITRATE_ERROR		10000	// max. Deviation of the Bitrate in ppm
+
+/**
+ * MCP2515 Baudrate-Detection (see detectBaudRate())
+ *
+ * A Candidate is accepted after MCP2515_AUTOBAUD_MIN_FRAMES valid Frames (more Frames than Errors) and
+ * rejected after MCP2515_AUTOBAUD_MAX_ERRORS Errors (at least as many Errors as Frames). Can be overwritten before the Library is included.
+ */
+#ifndef MCP2515_AUTOBAUD_WINDOW
+	#define MCP2515_AUTOBAUD_WINDOW			50000	// max. Time without Event (Frame or Error) per Candidate in µs
+#endif
+#ifndef MCP2515_AUTOBAUD_MIN_FRAMES
+	#define MCP2515_AUTOBAUD_MIN_FRAMES		2
+#endif
+#ifndef MCP2515_AUTOBAUD_MAX_ERRORS
+	#define MCP2515_AUTOBAUD_MAX_ERRORS		2
+#endif
+
+/**
+ * MCP2515 Transmit-Results (One-Shot-Transmission)
+ */
+
+#define MCP2515_TX_RESULT_SUCCESS				0x00	// Message transmitted successfully
+#define MCP2515_TX_RESULT_ARBITRATION_LOST		0x01	// Message lost arbitration (MLOA)
+#define MCP2515_TX_RESULT_BUS_ERROR				0x02	// A bus error occured during the transmission (TXERR)
+#define MCP2515_TX_RESULT_ABORTED				0x03	// Message was aborted (ABTF) or not started in time
+#define MCP2515_TX_RESULT_FAILED				0xFF	// Method-Error (Check _lastMcpError)
+
+/**
+ * MCP2515 Error-Log (see getErrorEvent())
+ *
+ * Only compiled when MCP2515_ENABLE_ERROR_LOG is defined for the whole Build (build flag only, see MCP2515_FEATURES),
+ * otherwise the Error-Log costs neither Flash nor RAM (getLastMCPError() is always available).
+ *
+ * Every public Call which ends with an Error is stored with its Context in a Ring of MCP2515_ERROR_LOG_SIZE Events,
+ * the oldest Event is overwritten. Can be overwritten with a build flag.
+ */
+//#define MCP2515_ENABLE_ERROR_LOG
+
+#ifndef MCP2515_ERROR_LOG_SIZE
+	#define MCP2515_ERROR_LOG_SIZE	8
+#endif
+
+#define MCP2515_CONTEXT_NONE				0x00	// no public Call active
+#define MCP2515_CONTEXT_SETUP				0x01	// Settings before the Initialisation
+#define MCP2515_CONTEXT_INITIALISATION		0x02	// init(), Snapshots
+#define MCP2515_CONTEXT_OPERATION_MODE		0x03	// Operation-Modes, Sleep and Wake-Up
+#define MCP2515_CONTEXT_SETTINGS			0x04	// change/get Settings, Bit-Timing, Baudrate-Detection
+#define MCP2515_CONTEXT_FILTER				0x05	// Masks and Filters
+#define MCP2515_CONTEXT_TRANSMISSION		0x06	// Transmission, Transmit-Queue, Rate-Limits
+#define MCP2515_CONTEXT_CYCLIC_MESSAGES		0x07	// Cyclic Messages
+#define MCP2515_CONTEXT_RECEPTION			0x08	// Reception
+#define MCP2515_CONTEXT_INTERRUPT			0x09	// Interrupt-Flags and handleInterrupt()
+
+#define MCP2515_CONTEXTS					10		// Count of the Contexts
+
+/**
+ * MCP2515 Performance-Counters (see getPerformanceCounters())
+ *
+ * Only compiled when MCP2515_ENABLE_PERFORMANCE_COUNTERS is defined for the whole Build (build flag only, see MCP2515_FEATURES),
+ * otherwise the Counters cost neither Flash nor RAM nor Runtime.
+ */
+//#define MCP2515_ENABLE_PERFORMANCE_COUNTERS
+
+/**
+ * MCP2515 Latency-Histograms (see getLatencyHistogram())
+ *
+ * Only compiled when MCP2515_ENABLE_LATENCY_HISTOGRAMS is defined for the whole Build (build flag only, see MCP2515_FEATURES).
+ *
+ * Each Histogram has MCP2515_LATENCY_BUCKETS logarithmic Buckets (2 per Power of 2, Bucket 0 - 3 = 0 - 3 µs),
+ * with the default of 32 Buckets the last Bucket contains all Latencies from 49152 µs. Can be overwritten with a build flag.
+ */
+//#define MCP2515_ENABLE_LATENCY_HISTOGRAMS
+
+#ifndef MCP2515_LATENCY_BUCKETS
+	#define MCP2515_LATENCY_BUCKETS		32
+#endif
+
+#define MCP2515_LATENCY_INT_TO_AVAILABLE		0x00	// INT-Edge (see captureInterrupt()) till the received Frame is seen by the Driver
+#define MCP2515_LATENCY_AVAILABLE_TO_CONSUMED	0x01	// received Frame seen by the Driver till it is read by the Application
+#define MCP2515_LATENCY_ENQUEUE_TO_TX_START		0x02	// Frame handed to the Driver till its Transmit Request
+#define MCP2515_LATENCY_ENQUEUE_TO_TX_COMPLETE	0x03	// Frame handed to the Driver till its successful Transmission is seen by the Driver
+#define MCP2515_LATENCY_HISTOGRAMS				4		// Count of the Latency-Histograms
+
+/**
+ * Max. Time in Bit-Times to wait for the end of a single transmission attempt
+ * (waiting for Bus-Idle and transmitting the longest possible Frame).
+ */
+#define MCP2515_ONE_SHOT_TIMEOUT_BITS	400
+
+/**
+ * Max. Time in Bit-Times per requested Buffer to wait for the end of sendBuffers() and sendFrames()
+ * (including the retransmissions after a lost Arbitration or a Bus-Error).
+ */
+#define MCP2515_SEND_BUFFERS_TIMEOUT_BITS	4000
+
+/**
+ * MCP2515 Transmit-Flags (passed to the Transmit-Callback)
+ *
+ * ABTF, MLOA and TXERR are taken from the TXBnCTRL-Register. Together with a successful Transmission
+ * they show that at least one previous Attempt was not successful.
+ */
+
+#define MCP2515_TX_FLAG_NOT_TRANSMITTED			0x01	// Message was not transmitted (TXnIF not set)
+#define MCP2515_TX_FLAG_BUS_ERROR				TXBnCTRL_BIT_TXERR	// A bus error occured during an Attempt
+#define MCP2515_TX_FLAG_ARBITRATION_LOST		TXBnCTRL_BIT_MLOA	// Message lost arbitration during an Attempt
+#define MCP2515_TX_FLAG_ABORTED					TXBnCTRL_BIT_ABTF	// Message was aborted
+
+/**
+ * MCP2515 Bus-States (see enableBusStateMonitoring())
+ */
+
+#define MCP2515_BUS_STATE_ERROR_ACTIVE		0x00	// TEC and REC < 96
+#define MCP2515_BUS_STATE_WARNING			0x01	// TEC or REC >= 96 (EFLG.EWARN), still Error-Active
+#define MCP2515_BUS_STATE_ERROR_PASSIVE		0x02	// TEC or REC >= 128 (EFLG.TXEP or EFLG.RXEP)
+#define MCP2515_BUS_STATE_BUS_OFF			0x03	// TEC > 255 (EFLG.TXBO)
+
+#define MCP2515_BUS_OFF_RECOVERY_AUTOMATIC	0		// the MCP2515 recovers by itself after 128 x 11 recessive Bits
+#define MCP2515_MAX_BUS_OFF_BACKOFF			60000	// max. Backoff before the Bus-Off-Recovery in ms
+
+/**
+ * MCP2515 Cyclic-Message-Scheduler (see addCyclicMessage())
+ *
+ * Only compiled when MCP2515_ENABLE_CYCLIC_MESSAGES is defined for the whole Build (build flag only, see MCP2515_FEATURES),
+ * otherwise the Scheduler costs neither Flash nor RAM.
+ *
+ * Maximum number of cyclic Messages that can be registered at the same time.
+ * Can be overwritten with a build flag.
+ * On small AVRs (like the Micro) the default is reduced to save RAM.
+ */
+//#define MCP2515_ENABLE_CYCLIC_MESSAGES
+
+#ifndef MCP2515_MAX_CYCLIC_MESSAGES
+	#if defined(RAMEND) && (RAMEND < 0x1000)
+		#define MCP2515_MAX_CYCLIC_MESSAGES	8
+	#else
+		#define MCP2515_MAX_CYCLIC_MESSAGES	25
+	#endif
+#endif
+
+#define MCP2515_CYCLIC_MESSAGE_INVALID	0xFF
+#define MCP2515_MAX_CYCLIC_PERIOD		2147483	// max. Period in ms, the Release-Times are compared as signed 32-Bit µs-Differences
+#define MCP2515_CYCLIC_EPOCH_STEP		0x40000000UL	// the Epoch is moved forward in Steps of 2^30 µs before the µs-Difference to it overflows
+
+/**
+ * MCP2515 Transmit-Queue (see queueMessage())
+ *
+ * Only compiled when MCP2515_ENABLE_TRANSMIT_QUEUE is defined for the whole Build (build flag only, see MCP2515_FEATURES),
+ * otherwise the Queue costs neither Flash nor RAM.
+ *
+ * Maximum number of Frames which can be queued for the streaming Transmission.
+ * Can be overwritten with a build flag.
+ * On small AVRs (like the Micro) the default is reduced to save RAM.
+ */
+//#define MCP2515_ENABLE_TRANSMIT_QUEUE
+
+#ifndef MCP2515_TX_QUEUE_SIZE
+	#if defined(RAMEND) && (RAMEND < 0x1000)
+		#define MCP2515_TX_QUEUE_SIZE	8
+	#else
+		#define MCP2515_TX_QUEUE_SIZE	32
+	#endif
+#endif
+
+/**
+ * MCP2515 Transmit-Rate-Limits (Token-Buckets in front of the Transmit-Queue)
+ *
+ * Only compiled together with the Transmit-Queue (MCP2515_ENABLE_TRANSMIT_QUEUE).
+ *
+ * Maximum number of ID-Ranges with an own Rate-Limit. Can be overwritten with a build flag.
+ */
+#ifndef MCP2515_MAX_RATE_LIMITS
+	#define MCP2515_MAX_RATE_LIMITS	4
+#endif
+
+#define MCP2515_MAX_FRAME_BITS			160		// Extended Frame with 8 Data-Bytes, max. Stuff-Bits and Interframe-Space
+#define MCP2515_UTILIZATION_WINDOW		100000	// Measuring-Window of the Utilization in µs
+
+/**
+ * MCP2515 Bus-Load (see getBusLoad())
+ *
+ * Only compiled when MCP2515_ENABLE_BUS_LOAD is defined for the whole Build (build flag only, see MCP2515_FEATURES),
+ * otherwise the Bus-Load costs neither Flash nor RAM nor Runtime.
+ *
+ * The Bus-Load is measured in a sliding Window of MCP2515_BUS_LOAD_SLOTS Slots
+ * with MCP2515_BUS_LOAD_SLOT_TIME µs each (default 10 x 100 ms). Can be overwritten with a build flag.
+ */
+//#define MCP2515_ENABLE_BUS_LOAD
+
+#ifndef MCP2515_BUS_LOAD_SLOTS
+	#define MCP2515_BUS_LOAD_SLOTS		10
+#endif
+
+#ifndef MCP2515_BUS_LOAD_SLOT_TIME
+	#define MCP2515_BUS_LOAD_SLOT_TIME	100000
+#endif
+
+/**
+ * MCP2515 Operation-Mode-Transition
+ *
+ * Timeout in µs for the Change of the Operation-Mode (additional to the Time of one Frame at the actual Baudrate,
+ * because the MCP2515 finishes an ongoing Frame before it leaves the Normal-Mode). Can be overwritten before the Library is included.
+ */
+#ifndef MCP2515_MODE_TRANSITION_TIMEOUT
+	#define MCP2515_MODE_TRANSITION_TIMEOUT	1000
+#endif
+
+/**
+ * MCP2515 Acceptance-Filter
+ *
+ * Maximum number of wanted IDs for the Filter-Compiler (see compileFilters()). Can be overwritten before the Library is included.
+ *
+ * Masks and Filters use the Register-Layout: Bit 28 - 18 = Standard-ID (or Extended-ID[28:18]), Bit 17 - 0 = Extended-ID[17:0].
+ */
+#ifndef MCP2515_MAX_FILTER_IDS
+	#define MCP2515_MAX_FILTER_IDS	32
+#endif
+
+#define MCP2515_FILTER_STANDARD_BITS	0x1FFC0000	// Standard-ID in the Register-Layout
+#define MCP2515_FILTER_EXTENDED_BITS	0x1FFFFFFF	// Extended-ID in the Register-Layout
+#define MCP2515_FILTER_REGISTERS		32			// 6 Filters and 2 Masks with 4 Registers each (SIDH, SIDL, EID8, EID0)
+
+#define MCP2515_CACHED_REGISTERS		9			// BFPCTRL, TXRTSCTRL, CANCTRL, CNF3, CNF2, CNF1, CANINTE, RXB0CTRL, RXB1CTRL
+
+#define MCP2515_SNAPSHOT_VERSION		0x01		// Layout-Version of MCP2515Snapshot (Snapshots of other Versions are rejected)
 
+#define MCP2515_QUEUE_ENTRY_FREE		0x00
+#define MCP2515_QUEUE_ENTRY_QUEUED		0x01
+#define MCP2515_QUEUE_ENTRY_IN_FLIGHT	0x02
+
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+/**
+ * @brief Statistic of a cyclic Message.
+ *
+ * Jitter = Time between the scheduled Release-Time and the Transmit-Request in µs.
+ *
+ * A Deadline-Miss is counted for each Period which could not be served before the next Release-Time.
+ */
+struct MCP2515CyclicStatistic
+{
+	uint32_t sendCount;
+	uint32_t maxJitter;
+	uint32_t averageJitter;
+	uint16_t deadlineMisses;
+};
+
+/**
+ * @brief Internal Data of a cyclic Message (used by the Scheduler).
+ */
+struct MCP2515CyclicMessage
+{
+	uint32_t id;
+	uint8_t data[8];
+	uint8_t dlc;
+	bool extended;
+	bool active;
+	uint32_t period;
+	uint32_t nextRelease;
+	uint32_t sendCount;
+	uint32_t maxJitter;
+	uint32_t jitterSum;
+	uint32_t jitterCount;
+	uint16_t deadlineMisses;
+};
+#endif
+
+/**
+ * @brief Callback for completed Transmissions (see startTransmission() and handleInterrupt()).
+ *
+ * BufferNumber = TX-Buffer 0 - 2, Tag = Tag of startTransmission(),
+ * Timestamp = micros() when the Completion was handled, Flags = MCP2515_TX_FLAG_*
+ */
+typedef void (*MCP2515TransmitCallback)(uint8_t BufferNumber, uint32_t Tag, uint32_t Timestamp, uint8_t Flags);
+
+/**
+ * @brief Callback for changes of the Bus-State (see enableBusStateMonitoring()).
+ *
+ * State, PreviousState = MCP2515_BUS_STATE_*, TransmitErrorCounter, ReceiveErrorCounter = TEC and REC after the Change
+ */
+typedef void (*MCP2515BusStateCallback)(uint8_t State, uint8_t PreviousState, uint8_t TransmitErrorCounter, uint8_t ReceiveErrorCounter);
+
+/**
+ * @brief A complete CAN-Frame (used for the Transmission of several Frames at once).
+ */
+struct MCP2515Frame
+{
+	uint32_t id;
+	bool extended;
+	bool rtr;
+	uint8_t dlc;
+	uint8_t data[8];
+};
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+/**
+ * @brief Internal Data of a queued Frame (used by the Transmit-Queue).
+ */
+struct MCP2515QueueEntry
+{
+	MCP2515Frame frame;
+	uint32_t deadline;
+	uint16_t sequence;
+	bool hasDeadline;
+	uint8_t state;
+	uint8_t bits;
+	uint8_t head;
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+	uint32_t enqueued;
+#endif
+};
+
+/**
+ * @brief Statistic of the Transmit-Queue.
+ *
+ * A Deadline-Miss is counted for each Frame which could not be transmitted before its Deadline
+ * (dropped from the Queue or withdrawn from the TX-Buffer). A withdrawn Frame which was already on the Bus
+ * is counted as transmitted only.
+ *
+ * A Preemption is counted when a pending Frame was withdrawn for a Frame with an earlier Deadline (it stays queued).
+ */
+struct MCP2515TransmitQueueStatistic
+{
+	uint32_t transmitted;
+	uint32_t notTransmitted;
+	uint32_t deadlineMisses;
+	uint32_t preemptions;
+};
+#endif
+
+#ifdef MCP2515_ENABLE_BUS_LOAD
+/**
+ * @brief Statistic of the Bus-Load (see getBusLoadStatistic()).
+ *
+ * Bits are the on-wire Length of the Frames incl. Stuff-Bits and Interframe-Space (see calculateFrameBitLength()),
+ * stuffBits are the Stuff-Bits of the transmitted and received Frames.
+ */
+struct MCP2515BusLoadStatistic
+{
+	uint32_t transmittedFrames;
+	uint32_t receivedFrames;
+	uint32_t transmittedBits;
+	uint32_t receivedBits;
+	uint32_t stuffBits;
+};
+#endif
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+/**
+ * @brief Token-Bucket of a Transmit-Rate-Limit.
+ *
+ * The Bucket is filled with Rate ‰ of the Baudrate (in Bits) up to Burst Bits.
+ * A queued Frame is only loaded when the Bucket contains its on-wire Length.
+ */
+struct MCP2515RateLimit
+{
+	uint32_t idFrom;
+	uint32_t idTo;
+	bool extended;
+	uint16_t rate;
+	uint32_t burst;
+	int32_t tokens;
+	uint32_t lastUpdate;
+};
+#endif
+
+/**
+ * @brief Configuration of the Acceptance-Filter (2 Masks and 6 Filters, Register-Layout see MCP2515_MAX_FILTER_IDS).
+ *
+ * Mask 0 and Filter 0 - 1 belong to RX-Buffer 0, Mask 1 and Filter 2 - 5 belong to RX-Buffer 1.
+ *
+ * falseAccepts = Number of not wanted IDs which pass the Filters,
+ * falseAcceptRate = falseAccepts in ppm of all not wanted IDs of the used Frame-Types (2048 Standard-IDs, 2^29 Extended-IDs).
+ */
+struct MCP2515FilterConfig
+{
+	uint32_t masks[2];
+	uint32_t filters[6];
+	bool extended[6];
+	uint32_t falseAccepts;
+	uint32_t falseAcceptRate;
+};
+
+/**
+ * @brief Snapshot of the Configuration of the MCP2515 (see captureSnapshot() and restoreSnapshot()).
+ *
+ * A compact Blob, which can be stored e.g. in the EEPROM (EEPROM.put()/EEPROM.get()).
+ *
+ * registers = BFPCTRL, TXRTSCTRL, CANCTRL, CNF3, CNF2, CNF1, CANINTE, RXB0CTRL, RXB1CTRL (without read-only Bits),
+ * the Operation-Mode is taken from CANCTRL.REQOP.
+ *
+ * filters = Filter 0 - 5 and Mask 0 - 1 (SIDH, SIDL, EID8, EID0 each).
+ */
+struct MCP2515Snapshot
+{
+	uint8_t version;
+	uint8_t registers[MCP2515_CACHED_REGISTERS];
+	uint8_t filters[MCP2515_FILTER_REGISTERS];
+	uint32_t clockFrequency;
+	uint32_t baudRate;
+	int32_t bitRateError;
+	uint16_t samplePoint;
+	uint8_t checksum;
+};
+
+/**
+ * @brief Declarative Configuration for init() (all Settings are written with a few sequential Writes after the Reset).
+ *
+ * interrupts = CANINTE (CANINTE_BIT_*), rxPinControl = BFPCTRL (BFPCTRL_BIT_*), txPinControl = TXRTSCTRL (TXRTSCTRL_BIT_BnRTSM(n)),
+ * rollover = RX-Buffer 0 rolls over into RX-Buffer 1 (RXB0CTRL.BUKT),
+ * filtersEnabled = the Masks and Filters of filters are programmed and used, otherwise every Message is received,
+ * operationMode = MCP2515_OP_* after the Initialisation.
+ *
+ * Initialize it with MCP2515InitConfig Config = {}; and set at least the baudRate and the operationMode.
+ */
+struct MCP2515InitConfig
+{
+	uint32_t baudRate;
+	uint8_t interrupts;
+	uint8_t rxPinControl;
+	uint8_t txPinControl;
+	bool rollover;
+	bool filtersEnabled;
+	MCP2515FilterConfig filters;
+	uint8_t operationMode;
+	bool oneShotMode;
+	bool reCheckEnabled;
+};
+
+#ifdef MCP2515_ENABLE_ERROR_LOG
+/**
+ * @brief Error-Event of the Error-Log (see getErrorEvent()).
+ *
+ * code = Error of the failed Call (like getLastMCPError()), context = MCP2515_CONTEXT_*, timestamp = micros() at the End of the Call,
+ * canStatus, canInterruptFlags, errorFlags, transmitErrorCounter, receiveErrorCounter = CANSTAT, CANINTF, EFLG, TEC, REC
+ * at the End of the Call (only when registersValid, the MCP2515 was not initialized otherwise).
+ */
+struct MCP2515ErrorEvent
+{
+	uint16_t code;
+	uint8_t context;
+	uint32_t timestamp;
+	bool registersValid;
+	uint8_t canStatus;
+	uint8_t canInterruptFlags;
+	uint8_t errorFlags;
+	uint8_t transmitErrorCounter;
+	uint8_t receiveErrorCounter;
+};
+#endif
+
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+/**
+ * @brief Performance-Counters of the Driver (see getPerformanceCounters()).
+ *
+ * spiTransactions = SPI-Instructions (one Activation of the CS-Pin each), spiBytes = transferred Bytes,
+ * busyWaitTime = Time in µs in Busy-Waits (Transmissions, Operation-Mode-Changes and fixed Delays),
+ * readbacks = Verification-Reads after a Write (see setReCheckEnabler()),
+ * contextCalls and contextTime = Count and cumulative Time in µs of the public Calls per Context (Index = MCP2515_CONTEXT_*),
+ * all public Methods of a Context share one Counter and Methods called by other public Methods are counted in the outermost Call.
+ */
+struct MCP2515PerformanceCounters
+{
+	uint32_t spiTransactions;
+	uint32_t spiBytes;
+	uint32_t busyWaitTime;
+	uint32_t readbacks;
+	uint32_t contextCalls[MCP2515_CONTEXTS];
+	uint32_t contextTime[MCP2515_CONTEXTS];
+};
+#endif
+
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+/**
+ * @brief Latency-Histogram (see getLatencyHistogram()).
+ *
+ * count, min and max in µs are exact, buckets count the Latencies per logarithmic Bucket (saturated at 65535).
+ */
+struct MCP2515LatencyHistogram
+{
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint16_t buckets[MCP2515_LATENCY_BUCKETS];
+};
+#endif
+
+/**
+ * MCP2515 Layout-Check
+ *
+ * The MCP2515_ENABLE_* Flags and the Sizes of the optional Features change the Layout of the MCP2515-Class.
+ * A #define in a Sketch does not reach MCP2515.cpp, so they have to be defined for the whole Build (build flag).
+ * Each Construction refers to MCP2515LayoutCheck<sizeof(MCP2515), MCP2515_FEATURES>::value, which is only
+ * defined for the Layout the Library is compiled with, so a different Layout fails to link.
+ */
+#ifdef MCP2515_ENABLE_ERROR_LOG
+	#define MCP2515_FEATURE_ERROR_LOG				0x01
+#else
+	#define MCP2515_FEATURE_ERROR_LOG				0x00
+#endif
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+	#define MCP2515_FEATURE_PERFORMANCE_COUNTERS	0x02
+#else
+	#define MCP2515_FEATURE_PERFORMANCE_COUNTERS	0x00
+#endif
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+	#define MCP2515_FEATURE_LATENCY_HISTOGRAMS		0x04
+#else
+	#define MCP2515_FEATURE_LATENCY_HISTOGRAMS		0x00
+#endif
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+	#define MCP2515_FEATURE_CYCLIC_MESSAGES			0x08
+#else
+	#define MCP2515_FEATURE_CYCLIC_MESSAGES			0x00
+#endif
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+	#define MCP2515_FEATURE_TRANSMIT_QUEUE			0x10
+#else
+	#define MCP2515_FEATURE_TRANSMIT_QUEUE			0x00
+#endif
+#ifdef MCP2515_ENABLE_BUS_LOAD
+	#define MCP2515_FEATURE_BUS_LOAD				0x20
+#else
+	#define MCP2515_FEATURE_BUS_LOAD				0x00
+#endif
+
+#define MCP2515_FEATURES	(MCP2515_FEATURE_ERROR_LOG | MCP2515_FEATURE_PERFORMANCE_COUNTERS | MCP2515_FEATURE_LATENCY_HISTOGRAMS | \
+							 MCP2515_FEATURE_CYCLIC_MESSAGES | MCP2515_FEATURE_TRANSMIT_QUEUE | MCP2515_FEATURE_BUS_LOAD)
+
+template <size_t Size, uint8_t Features>
+struct MCP2515LayoutCheck
+{
+	static const uint8_t value;
+};
 
 class MCP2515
 {
@@ -94,10 +644,106 @@ class MCP2515
 		uint32_t _clockFrequency;
 		uint8_t _operationMode;
 		uint32_t _baudRate;
+		uint16_t _samplePoint;
+		uint32_t _maxBitRateError;
+		int32_t _bitRateError;
+		uint16_t _actualSamplePoint;
 		bool _isInitialized;
 		uint16_t _lastMcpError;
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+		uint8_t _callDepth;
+#endif
+#ifdef MCP2515_ENABLE_ERROR_LOG
+		MCP2515ErrorEvent _errorEvents[MCP2515_ERROR_LOG_SIZE];
+		uint8_t _errorEventHead;
+		uint8_t _errorEventCount;
+		uint32_t _errorEventTotal;
+#endif
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+		MCP2515PerformanceCounters _performanceCounters;
+#endif
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+		MCP2515LatencyHistogram _latencyHistograms[MCP2515_LATENCY_HISTOGRAMS];
+		volatile uint32_t _interruptTime;
+		volatile bool _interruptCaptured;
+		uint32_t _rxAvailableTime[2];
+		uint8_t _rxAvailableMask;
+		uint32_t _transmitEnqueueTime[3];
+		uint8_t _transmitEnqueuedMask;
+		uint8_t _transmitStartedMask;
+#endif
 		bool _reCheckEnabled;
+		bool _oneShotMode;
+
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+		MCP2515CyclicMessage _cyclicMessages[MCP2515_MAX_CYCLIC_MESSAGES];
+		uint8_t _cyclicHeap[MCP2515_MAX_CYCLIC_MESSAGES];
+		uint8_t _cyclicHeapSize;
+		uint32_t _cyclicEpoch;
+		uint32_t _cyclicEpochSteps;
+#endif
 
+		MCP2515TransmitCallback _transmitCallback;
+		uint32_t _transmitTag[3];
+		uint8_t _pendingTransmissions;
+		uint32_t _transmitDeadline[3];
+		uint8_t _transmitDeadlineMask;
+		uint32_t _maxSendTime;
+		uint32_t _modeTransitionTime;
+		uint8_t _sleepPreviousMode;
+		bool _sleepWakeUpInterrupt;
+		bool _wakeUpPending;
+		uint32_t _wakeUpTime;
+		uint32_t _wakeUpLatency;
+		bool _busStateMonitoring;
+		MCP2515BusStateCallback _busStateCallback;
+		uint8_t _busState;
+		uint8_t _transmitErrorCounter;
+		uint8_t _receiveErrorCounter;
+		uint32_t _busOffBackoff;
+		uint8_t _busOffPreviousMode;
+		uint32_t _busOffTime;
+		uint32_t _busOffRecoveryTime;
+		uint16_t _busOffCount;
+		volatile uint32_t _sofTimestamp;
+		volatile uint32_t _sofCount;
+		volatile uint32_t _sofLatched[2];
+		volatile uint8_t _sofLatchedMask;
+		volatile uint32_t _sofLatchedCount;
+		uint32_t _rxStartOfFrame;
+		bool _rxStartOfFrameValid;
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+		MCP2515QueueEntry _txQueue[MCP2515_TX_QUEUE_SIZE];
+		uint8_t _txQueueCount;
+		uint16_t _txQueueSequence;
+		uint8_t _txQueueInFlight;
+		uint8_t _txQueueSlot[3];
+		uint8_t _txQueuePriority[3];
+		uint8_t _txQueuePreempted;
+		uint8_t _txQueueExpired;
+		MCP2515TransmitQueueStatistic _txQueueStatistic;
+
+		MCP2515RateLimit _rateLimits[MCP2515_MAX_RATE_LIMITS];
+		MCP2515RateLimit _busLoadLimit;
+		uint32_t _utilizationBits;
+		uint32_t _utilizationStart;
+		uint16_t _utilization;
+#endif
+#ifdef MCP2515_ENABLE_BUS_LOAD
+		uint8_t _transmitFrameBits[3];
+		uint8_t _transmitStuffBits[3];
+		uint32_t _busLoadBits[MCP2515_BUS_LOAD_SLOTS];
+		uint8_t _busLoadSlot;
+		uint8_t _busLoadSlotCount;
+		uint32_t _busLoadSlotStart;
+		MCP2515BusLoadStatistic _busLoadStatistic;
+#endif
+		uint8_t _filterRegisters[MCP2515_FILTER_REGISTERS];
+		bool _filterRegistersValid;
+		bool _registerCacheEnabled;
+		uint8_t _registerCache[MCP2515_CACHED_REGISTERS];
+		uint16_t _registerCacheValid;
 
 
 
@@ -214,28 +860,157 @@ class MCP2515
 
 		bool resetInstruction();
 		bool writeInstruction(uint8_t Address, uint8_t Value);
+		bool writeInstruction(uint8_t Address, const uint8_t Values[], uint8_t Length);
 		bool bitModifyInstruction(uint8_t Address, uint8_t Mask, uint8_t Value);
 		bool loadTxBufferInstruction(uint8_t Value, bool a = false, bool b = false, bool c = false);
+		bool loadTxBufferInstruction(const uint8_t Values[], uint8_t Length, bool a = false, bool b = false, bool c = false);
 		bool rtsInstruction(bool TXBuffer_0 = false, bool TXBuffer_1 = false, bool TXBuffer_2 = false);
 		uint8_t rxStatusInstruction();
 		uint8_t readInstruction(uint8_t Address);
+		bool readInstruction(uint8_t Address, uint8_t Values[], uint8_t Length);
 		uint8_t readStatusInstruction();
 		uint8_t readRxBufferInstruction(bool n = false, bool m = false);
 
 		// other privat Methods
 
 		bool changeBitTiming(uint32_t targetBaudRate = MCP2515_DEFAULT_BAUDRATE, uint32_t targetClockFrequency = MCP2515_DEFAULT_CLOCK_FREQUENCY);
+		bool writeBitTiming(const uint8_t cnf[3]);
+		bool setOperationMode(uint8_t OperationMode);
+		void restoreOperationMode(uint8_t OperationMode);
+		bool requestOperationMode(uint8_t OperationMode);
+		bool handleWakeUp();
+		bool updateBusState();
+		bool recoverFromBusOff();
+		bool startInitialization(uint32_t ClockFrequency, bool reCheckEnabled);
+		bool initialize(uint32_t ClockFrequency, uint32_t BaudRate, const uint8_t Cnf[3], int32_t BitRateError, uint16_t SamplePoint, bool reCheckEnabled);
+		bool writeConfiguration(const MCP2515Snapshot &Snapshot, bool Filters);
+		uint8_t calculateSnapshotChecksum(const MCP2515Snapshot &Snapshot);
+		bool loadTransmitBuffer(uint8_t BufferNumber, uint32_t ID, bool Extended, bool RTR, uint8_t DLC, const uint8_t Data[8]);
+
+		// Transmit-Queue (Earliest Deadline First)
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+		bool txQueueSameId(uint8_t SlotA, uint8_t SlotB);
+		void txQueueUpdateHead(uint8_t Slot);
+		bool txQueueMustPrecede(uint8_t SlotA, uint8_t SlotB, bool HasDeadline, uint32_t Deadline);
+		bool txQueueRaisePriorities();
+#endif
+
+		// Transmit-Rate-Limits (Token-Buckets)
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+		void refillRateLimit(MCP2515RateLimit &Limit, uint32_t Now);
+		MCP2515RateLimit *findRateLimit(const MCP2515Frame &Frame);
+#endif
+		void appendFrameBits(uint8_t Stream[], uint8_t &Position, uint16_t Value, uint8_t Count);
+		uint16_t getFrameBitLength(const MCP2515Frame &Frame, uint8_t &StuffBits);
+
+		// Bus-Load
+
+#ifdef MCP2515_ENABLE_BUS_LOAD
+		void updateBusLoad(uint32_t Now);
+		void addBusLoad(uint16_t Bits, uint8_t StuffBits, bool Transmitted);
+		void addTransmittedBuffer(uint8_t BufferNumber);
+#endif
+
+		// Acceptance-Filter
+
+		bool writeFilter(uint8_t FilterNumber, uint32_t Value, bool Extended);
+		bool writeMask(uint8_t MaskNumber, uint32_t Value);
+		uint32_t countFilterMatches(const uint32_t Care[], const uint32_t Value[], uint8_t Count, uint8_t Bits);
+		void encodeFilters(const MCP2515FilterConfig &Config, uint8_t Registers[MCP2515_FILTER_REGISTERS]);
+		uint8_t getFilterRegisterAddress(uint8_t Index);
+		uint8_t getFilterRegisterIndex(uint8_t Address);
+
+		// Error-Log
+
+		/**
+		 * @brief Marks a public Call: clears an Error of a previous Call at the Start and stores an Error-Event when the Call
+		 * ends with an Error (a failed public Method which is called by another public Method is not logged twice,
+		 * the Event is completed by the calling Method). A successful Call writes no Member.
+		 */
+		class ErrorContext
+		{
+			public:
+				ErrorContext(MCP2515 &Module, uint8_t Context);
+				~ErrorContext();
+
+			private:
+				MCP2515 &_module;
+				uint8_t _context;
+#ifdef MCP2515_ENABLE_ERROR_LOG
+				uint32_t _errorEventTotal;
+#endif
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+				uint32_t _start;
+#endif
+		};
+
+#ifdef MCP2515_ENABLE_ERROR_LOG
+		void logErrorEvent(uint8_t Context);
+		void completeErrorEvent(uint8_t Context);
+#endif
+
+		// Register-Cache
+
+		uint8_t getCachedRegisterIndex(uint8_t Address);
+		void resetRegisterCache();
+
+		// Cyclic-Message-Scheduler (Min-Heap sorted by the next Release-Time)
+
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+		bool cyclicHeapBefore(uint8_t HeapPositionA, uint8_t HeapPositionB);
+		void cyclicHeapSiftUp(uint8_t HeapPosition);
+		void cyclicHeapSiftDown(uint8_t HeapPosition);
+		void updateCyclicEpoch(uint32_t Now);
+#endif
+
+		// Latency-Histograms
+
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+		uint8_t getLatencyBucket(uint32_t Latency);
+		uint32_t getLatencyBucketStart(uint8_t Bucket);
+		void recordLatency(uint8_t Histogram, uint32_t Latency);
+		void noteReceiveAvailable(uint8_t Flags);
+		void noteReceiveConsumed(uint8_t BufferNumber);
+		void noteTransmitEnqueued(uint8_t BufferNumber, uint32_t Time);
+		void noteTransmitStarted(uint8_t Mask);
+		void noteTransmitCompleted(uint8_t BufferNumber);
+#endif
 
 
 	public:
 		// Constructors
 
-		MCP2515();
+		MCP2515(const uint8_t *LayoutCheck = &MCP2515LayoutCheck<sizeof(MCP2515), MCP2515_FEATURES>::value);
 		~MCP2515();
 
 		// for Error-Handling
 
 		uint16_t getLastMCPError();
+#ifdef MCP2515_ENABLE_ERROR_LOG
+		uint8_t getErrorEventCount();
+		uint32_t getErrorEventTotal();
+		bool getErrorEvent(uint8_t Index, MCP2515ErrorEvent &Event);
+		void clearErrorEvents();
+#endif
+
+		// Performance-Counters
+
+#ifdef MCP2515_ENABLE_PERFORMANCE_COUNTERS
+		void getPerformanceCounters(MCP2515PerformanceCounters &Counters);
+		void resetPerformanceCounters();
+#endif
+
+		// Latency-Histograms
+
+#ifdef MCP2515_ENABLE_LATENCY_HISTOGRAMS
+		void captureInterrupt();
+		bool getLatencyHistogram(uint8_t Histogram, MCP2515LatencyHistogram &Result);
+		uint32_t getLatencyPercentile(uint8_t Histogram, uint8_t Percentile);
+		void resetLatencyHistograms();
+		void printLatencyHistograms(Print &Output);
+#endif
 
 		// only before initialisation
 
@@ -248,7 +1023,12 @@ class MCP2515
 		// De-/Initialisation of the MCP2515
 
 		bool init(uint32_t BaudRate = MCP2515_DEFAULT_BAUDRATE, bool reCheckEnabled = true);
+		bool init(const MCP2515InitConfig &Config);
+		template <uint32_t ClockFrequency, uint32_t BaudRate, uint16_t SamplePoint = MCP2515_DEFAULT_SAMPLE_POINT, uint32_t MaxBitRateError = MCP2515_DEFAULT_MAX_BITRATE_ERROR>
+		bool init(bool reCheckEnabled = true);
 		void deinit();
+		bool captureSnapshot(MCP2515Snapshot &Snapshot);
+		bool restoreSnapshot(const MCP2515Snapshot &Snapshot, uint32_t &ReadyTime, bool reCheckEnabled = true);
 
 		// MCP2515-Operationmodes
 
@@ -257,16 +1037,32 @@ class MCP2515
 		bool setSleepMode();
 		bool setListenOnlyMode();
 		bool setLoopbackMode();
+		bool enterSleepMode(bool WakeUpFilter = true);
+		bool wakeUp();
 
 		// change Settings
 
 		bool setReCheckEnabler(bool reCheckEnabler);
+		bool setRegisterCacheEnabler(bool RegisterCacheEnabler);
+		bool scrubRegisterCache(uint8_t &Divergences);
 		bool changeBaudRate(uint32_t targetBaudRate = MCP2515_DEFAULT_BAUDRATE);
+		bool detectBaudRate(const uint32_t Candidates[], uint8_t Count, uint32_t &BaudRate, uint32_t &Duration, uint32_t Window = MCP2515_AUTOBAUD_WINDOW);
+		bool detectBaudRate(uint32_t &BaudRate, uint32_t &Duration, uint32_t Window = MCP2515_AUTOBAUD_WINDOW);
+		bool setSamplePoint(uint16_t SamplePoint = MCP2515_DEFAULT_SAMPLE_POINT);
+		bool setMaxBitRateError(uint32_t MaxBitRateError = MCP2515_DEFAULT_MAX_BITRATE_ERROR);
+		bool calculateBitTiming(uint32_t BaudRate, uint32_t ClockFrequency, uint8_t Cnf[3], int32_t &BitRateError, uint16_t &SamplePoint);
 		//bool changeClockFrequency(uint32_t targetClockFrequency = MCP2515_DEFAULT_CLOCK_FREQUENCY);
 		bool changeInterruptSetting(bool value, uint8_t InterruptBit);
 
+		bool setOneShotMode(bool OneShot);
+		bool setClockOutput(uint8_t Mode, uint8_t Prescaler = 1);
+
 		bool enableFilterMask(uint8_t buffer = 0);
 		bool disableFilterMask(uint8_t buffer = 0);
+		bool compileFilters(const uint32_t Ids[], const bool Extended[], uint8_t Count, MCP2515FilterConfig &Config);
+		bool setFilters(const MCP2515FilterConfig &Config);
+		bool setAcceptedIds(const uint32_t Ids[], const bool Extended[], uint8_t Count, MCP2515FilterConfig &Config);
+		bool reprogramFilters(const MCP2515FilterConfig &Config, uint32_t &OffBusTime);
 
 		// Message-Handling
 		// Transmission
@@ -274,6 +1070,52 @@ class MCP2515
 		uint8_t check4FreeTransmitBuffer();
 		bool fillTransmitBuffer(uint8_t BufferNumber, uint32_t ID, bool Extended, bool RTR, uint8_t DLC, uint8_t Data[8]);
 		bool sendMessage(uint8_t BufferNumber, uint8_t Priority = 0);
+		uint8_t sendMessageOneShot(uint8_t BufferNumber, uint8_t Priority = 0);
+		bool sendMessageTimeout(uint8_t BufferNumber, uint8_t Priority, uint32_t Timeout, bool Async = false, uint32_t Tag = 0);
+		uint32_t getMaxSendTime(bool Reset = false);
+		bool sendBuffers(uint8_t Mask);
+		bool sendFrames(const MCP2515Frame Frames[], uint8_t Count);
+		bool startTransmission(uint8_t BufferNumber, uint8_t Priority = 0, uint32_t Tag = 0);
+		uint8_t getPendingTransmissions();
+
+		// Transmit-Queue
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+		bool queueMessage(const MCP2515Frame &Frame, uint32_t Deadline = 0);
+		uint8_t processTransmitQueue();
+		uint8_t getTransmitQueueCount();
+		void getTransmitQueueStatistic(MCP2515TransmitQueueStatistic &Statistic);
+		void resetTransmitQueueStatistic();
+#endif
+
+		// Transmit-Rate-Limits
+
+#ifdef MCP2515_ENABLE_TRANSMIT_QUEUE
+		bool setTransmitRateLimit(uint8_t Index, bool Extended, uint32_t IdFrom, uint32_t IdTo, uint16_t Rate, uint32_t Burst = MCP2515_MAX_FRAME_BITS);
+		bool setTransmitBusLoadLimit(uint16_t Rate, uint32_t Burst = MCP2515_MAX_FRAME_BITS);
+		uint16_t getTransmitUtilization();
+#endif
+		uint16_t calculateFrameBitLength(const MCP2515Frame &Frame);
+		uint16_t calculateFrameBitLength(const MCP2515Frame &Frame, uint8_t &StuffBits);
+
+		// Bus-Load
+
+#ifdef MCP2515_ENABLE_BUS_LOAD
+		uint16_t getBusLoad();
+		void getBusLoadStatistic(MCP2515BusLoadStatistic &Statistic);
+		void resetBusLoad();
+#endif
+
+		// Cyclic Messages
+
+#ifdef MCP2515_ENABLE_CYCLIC_MESSAGES
+		uint8_t addCyclicMessage(uint32_t ID, bool Extended, uint8_t DLC, uint8_t Data[8], uint32_t Period, uint32_t Offset = 0);
+		bool updateCyclicMessage(uint8_t Handle, uint8_t DLC, uint8_t Data[8]);
+		bool removeCyclicMessage(uint8_t Handle);
+		uint8_t processCyclicMessages();
+		bool getCyclicMessageStatistic(uint8_t Handle, MCP2515CyclicStatistic &Statistic);
+		bool resetCyclicMessageStatistic(uint8_t Handle);
+#endif
 
 		// Reception
 
@@ -293,6 +1135,25 @@ class MCP2515
 		uint8_t check4InterruptFlags();
 		bool resetInterruptFlag(uint8_t Flag);
 		bool setInterruptFlag(uint8_t Flag);
+		void setTransmitCallback(MCP2515TransmitCallback Callback);
+		uint8_t handleInterrupt();
+
+		// Bus-State
+
+		bool enableBusStateMonitoring(MCP2515BusStateCallback Callback = NULL, uint32_t BusOffBackoff = MCP2515_BUS_OFF_RECOVERY_AUTOMATIC);
+		bool disableBusStateMonitoring();
+		uint8_t processBusState();
+		bool getErrorCounters(uint8_t &TransmitErrorCounter, uint8_t &ReceiveErrorCounter);
+		uint8_t getBusState();
+		uint32_t getBusOffRecoveryTime();
+		uint16_t getBusOffCount();
+
+		// Start-of-Frame-Timestamps
+
+		void captureStartOfFrame(uint32_t Timestamp);
+		void latchStartOfFrame(uint8_t BufferNumber);
+		bool getStartOfFrameTimestamp(uint32_t &Timestamp);
+		uint32_t getStartOfFrameCount();
 
 		// get Settings
 
@@ -302,9 +1163,50 @@ class MCP2515
 		uint32_t getFrequency();
 		uint32_t getClockFrequency();
 		uint8_t getOperationMode();
+		uint32_t getLastModeTransitionTime();
+		uint32_t getWakeUpLatency();
 		uint32_t getBaudRate();
+		int32_t getBitRateError();
+		uint16_t getSamplePoint();
 		bool getIsInitialized();
 		bool getReCheckEnabled();
+		bool getRegisterCacheEnabled();
+		bool getOneShotMode();
+		uint8_t getClockOutput();
 };
 
+/**
+ * @brief Initialize the MCP2515 with a Bit-Timing calculated at Compile-Time.
+ *
+ * Same as init(), but CNF1 - CNF3 are calculated by the Compiler (see MCP2515BitTiming) and an impossible
+ * Combination of ClockFrequency and Baudrate fails with a static_assert. The Runtime-Calculation is not linked
+ * as long as changeBaudRate() and init(BaudRate) are not used.
+ * @tparam ClockFrequency ClockFrequency of the MCP2515 (1E6 - 40E6)
+ * @tparam BaudRate Baudrate of the CAN-Communication (1E3 - 1000E3)
+ * @tparam SamplePoint target Sample-Point in ‰ of the Bittime (500 - 950)
+ * @tparam MaxBitRateError max. Deviation of the Bitrate in ppm (0 - 50000)
+ * @param reCheckEnabled bool true if after Set-Processes a recheck of setted Values has to be execute
+ * @return true when success, false on any error (Check _lastMcpError)
+ */
+template <uint32_t ClockFrequency, uint32_t BaudRate, uint16_t SamplePoint, uint32_t MaxBitRateError>
+bool MCP2515::init(bool reCheckEnabled)
+{
+	static_assert((ClockFrequency >= MCP2515_MIN_CLOCK_FREQUENCY) && (ClockFrequency <= MCP2515_MAX_CLOCK_FREQUENCY), "MCP2515: ClockFrequency not valid (1MHz - 40MHz)");
+	static_assert((BaudRate >= MCP2515_MIN_BAUDRATE) && (BaudRate <= MCP2515_MAX_BAUDRATE), "MCP2515: Baudrate not valid (1kB - 1000kB)");
+	static_assert((SamplePoint >= 500) && (SamplePoint <= 950), "MCP2515: Sample-Point not valid (500 - 950)");
+	static_assert(MaxBitRateError <= 50000, "MCP2515: max. Deviation of the Bitrate not valid (0 - 50000)");
+	static_assert(MCP2515BitTiming::timeQuanta(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError) != 0, "MCP2515: no Bit-Timing for this ClockFrequency and Baudrate (Prescaler out of range or Deviation of the Bitrate too high)");
+
+	constexpr uint8_t Cnf[3] = {
+		MCP2515BitTiming::cnf1(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError),
+		MCP2515BitTiming::cnf2(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError),
+		MCP2515BitTiming::cnf3(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError),
+	};
+
+	return initialize(ClockFrequency, BaudRate, Cnf,
+					  MCP2515BitTiming::bitRateError(ClockFrequency, BaudRate, MCP2515BitTiming::timeQuanta(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError)),
+					  MCP2515BitTiming::samplePoint(MCP2515BitTiming::timeQuanta(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError), SamplePoint),
+					  reCheckEnabled);
+}
+
 #endif
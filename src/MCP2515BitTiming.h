@@ -0,0 +1,132 @@
+#ifndef MCP2515BITTIMING_H
+#define MCP2515BITTIMING_H
+
+#include <stdint.h>
+#include "MCP2515Register.h"
+
+/**
+ * @brief Compile-Time-Calculation of the Bit-Timing (CNF1 - CNF3).
+ *
+ * Same Algorithm as MCP2515::calculateBitTiming(), written as C++11-constexpr-Functions (only one return-Statement each):
+ *
+ * The Number of Time-Quanta per Bit is searched from 25 down to 5, the Prescaler (1 - 64) is rounded to the next Value.
+ * The smallest Deviation of the Bitrate wins, with the same Deviation the Sample-Point next to the target Sample-Point
+ * and then the higher Number of Time-Quanta.
+ *
+ * timeQuanta() returns 0 if there is no Bit-Timing for the Combination.
+ */
+struct MCP2515BitTiming
+{
+	// Bitrate = ClockFrequency / (2 * BRP * TQ), BRP rounded
+	static constexpr uint32_t prescaler(uint32_t ClockFrequency, uint32_t BaudRate, uint8_t TimeQuanta)
+	{
+		return (ClockFrequency + ((uint32_t)TimeQuanta * BaudRate)) / (2UL * TimeQuanta * BaudRate);
+	}
+
+	// Deviation of the Bitrate in ppm (positive = faster than the Baudrate)
+	static constexpr int32_t bitRateError(uint32_t ClockFrequency, uint32_t BaudRate, uint8_t TimeQuanta)
+	{
+		return (int32_t)(((uint64_t)ClockFrequency * 1000000ULL) / ((uint64_t)2UL * TimeQuanta * BaudRate * prescaler(ClockFrequency, BaudRate, TimeQuanta))) - 1000000L;
+	}
+
+	static constexpr uint32_t absBitRateError(uint32_t ClockFrequency, uint32_t BaudRate, uint8_t TimeQuanta)
+	{
+		return (bitRateError(ClockFrequency, BaudRate, TimeQuanta) < 0) ? (uint32_t)(-bitRateError(ClockFrequency, BaudRate, TimeQuanta)) : (uint32_t)bitRateError(ClockFrequency, BaudRate, TimeQuanta);
+	}
+
+	// PHSEG2 according to the Sample-Point, min. 2 TQ (IPT)
+	static constexpr uint8_t phaseSegment2Target(uint8_t TimeQuanta, uint16_t SamplePoint)
+	{
+		return ((((uint16_t)TimeQuanta * (1000 - SamplePoint) + 500) / 1000) < 2) ? 2 : (uint8_t)(((uint16_t)TimeQuanta * (1000 - SamplePoint) + 500) / 1000);
+	}
+
+	// PHSEG2 takes the Time-Quanta which don't fit into PRSEG + PHSEG1 (max. 16 TQ)
+	static constexpr uint8_t phaseSegment2(uint8_t TimeQuanta, uint16_t SamplePoint)
+	{
+		return ((TimeQuanta - 1 - phaseSegment2Target(TimeQuanta, SamplePoint)) > 16) ? (uint8_t)(TimeQuanta - 17) : phaseSegment2Target(TimeQuanta, SamplePoint);
+	}
+
+	// PRSEG + PHSEG1
+	static constexpr uint8_t segment1(uint8_t TimeQuanta, uint16_t SamplePoint)
+	{
+		return (uint8_t)(TimeQuanta - 1 - phaseSegment2(TimeQuanta, SamplePoint));
+	}
+
+	static constexpr uint16_t samplePoint(uint8_t TimeQuanta, uint16_t SamplePoint)
+	{
+		return (uint16_t)(((uint16_t)(TimeQuanta - phaseSegment2(TimeQuanta, SamplePoint)) * 1000) / TimeQuanta);
+	}
+
+	static constexpr uint16_t samplePointError(uint8_t TimeQuanta, uint16_t SamplePoint)
+	{
+		return (samplePoint(TimeQuanta, SamplePoint) > SamplePoint) ? (uint16_t)(samplePoint(TimeQuanta, SamplePoint) - SamplePoint) : (uint16_t)(SamplePoint - samplePoint(TimeQuanta, SamplePoint));
+	}
+
+	static constexpr bool valid(uint32_t ClockFrequency, uint32_t BaudRate, uint16_t SamplePoint, uint32_t MaxBitRateError, uint8_t TimeQuanta)
+	{
+		return (TimeQuanta >= 5) &&
+			   (prescaler(ClockFrequency, BaudRate, TimeQuanta) >= 1) &&
+			   (prescaler(ClockFrequency, BaudRate, TimeQuanta) <= 64) &&
+			   (absBitRateError(ClockFrequency, BaudRate, TimeQuanta) <= MaxBitRateError) &&
+			   (phaseSegment2(TimeQuanta, SamplePoint) <= 8) &&
+			   (segment1(TimeQuanta, SamplePoint) >= phaseSegment2(TimeQuanta, SamplePoint));
+	}
+
+	// Deviation of the Bitrate first, then Deviation of the Sample-Point
+	static constexpr uint64_t score(uint32_t ClockFrequency, uint32_t BaudRate, uint16_t SamplePoint, uint32_t MaxBitRateError, uint8_t TimeQuanta)
+	{
+		return valid(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError, TimeQuanta) ?
+			   (((uint64_t)absBitRateError(ClockFrequency, BaudRate, TimeQuanta) << 16) | samplePointError(TimeQuanta, SamplePoint)) :
+			   0xFFFFFFFFFFFFFFFFULL;
+	}
+
+	static constexpr uint8_t search(uint32_t ClockFrequency, uint32_t BaudRate, uint16_t SamplePoint, uint32_t MaxBitRateError, uint8_t TimeQuanta, uint8_t Best)
+	{
+		return (TimeQuanta < 5) ? Best :
+			   search(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError, TimeQuanta - 1,
+					  (score(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError, TimeQuanta) < score(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError, Best)) ? TimeQuanta : Best);
+	}
+
+	// Number of Time-Quanta per Bit (5 - 25), 0 = no Bit-Timing possible
+	static constexpr uint8_t timeQuanta(uint32_t ClockFrequency, uint32_t BaudRate, uint16_t SamplePoint, uint32_t MaxBitRateError)
+	{
+		return search(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError, 25, 0);
+	}
+
+	// SJW = min(4, PHSEG2 - 1)
+	static constexpr uint8_t syncJumpWidth(uint8_t TimeQuanta, uint16_t SamplePoint)
+	{
+		return (phaseSegment2(TimeQuanta, SamplePoint) > 4) ? 4 : (uint8_t)(phaseSegment2(TimeQuanta, SamplePoint) - 1);
+	}
+
+	// PHSEG1 at least SJW, the Rest is the Propagation-Segment
+	static constexpr uint8_t phaseSegment1(uint8_t TimeQuanta, uint16_t SamplePoint)
+	{
+		return ((segment1(TimeQuanta, SamplePoint) / 2) < syncJumpWidth(TimeQuanta, SamplePoint)) ? syncJumpWidth(TimeQuanta, SamplePoint) : (uint8_t)(segment1(TimeQuanta, SamplePoint) / 2);
+	}
+
+	static constexpr uint8_t propagationSegment(uint8_t TimeQuanta, uint16_t SamplePoint)
+	{
+		return (uint8_t)(segment1(TimeQuanta, SamplePoint) - phaseSegment1(TimeQuanta, SamplePoint));
+	}
+
+	static constexpr uint8_t cnf1(uint32_t ClockFrequency, uint32_t BaudRate, uint16_t SamplePoint, uint32_t MaxBitRateError)
+	{
+		return (uint8_t)(((syncJumpWidth(timeQuanta(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError), SamplePoint) - 1) << 6) |
+						 ((prescaler(ClockFrequency, BaudRate, timeQuanta(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError)) - 1) & CNF1_BIT_BRP));
+	}
+
+	static constexpr uint8_t cnf2(uint32_t ClockFrequency, uint32_t BaudRate, uint16_t SamplePoint, uint32_t MaxBitRateError)
+	{
+		return (uint8_t)(CNF2_BIT_BTLMODE |
+						 ((phaseSegment1(timeQuanta(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError), SamplePoint) - 1) << 3) |
+						 ((propagationSegment(timeQuanta(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError), SamplePoint) - 1) & CNF2_BIT_PRSEG));
+	}
+
+	static constexpr uint8_t cnf3(uint32_t ClockFrequency, uint32_t BaudRate, uint16_t SamplePoint, uint32_t MaxBitRateError)
+	{
+		return (uint8_t)((phaseSegment2(timeQuanta(ClockFrequency, BaudRate, SamplePoint, MaxBitRateError), SamplePoint) - 1) & CNF3_BIT_PHSEG2);
+	}
+};
+
+#endif
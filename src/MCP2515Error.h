@@ -5,7 +5,7 @@
 
 #define ERROR_MCP2515_BAUDRATE_NOT_VALID                0x1000      // Occurs when a baudrate that is not allowed is selected.
 #define ERROR_MCP2515_CLOCKFREQUENCY_NOT_VALID          0x1100      // Occurs when a ClockFrequency that is not allowed is selected.
-#define ERROR_MCP2515_CNF_NOT_FOUND                     0x1200      // Occurs when the CNF-Configuration could not be found.
+#define ERROR_MCP2515_CNF_NOT_FOUND                     0x1200      // Occurs when no CNF-Configuration within the max. Deviation of the Bitrate could be found.
 #define ERROR_MCP2515_DATA_ORDER_NOT_ALLOWED            0x1300      // Occurs when a SPI-DataOrder that is not allowed is selected.
 #define ERROR_MCP2515_FALSE_OPERATION_MODE              0x1400      // Occurs when the MCP2515 is in the wrong Operation Mode.
 #define ERROR_MCP2515_FALSE_SETTING                     0x1500      // Occurs when a defined Setting-Condition is not complied with.
@@ -25,6 +25,14 @@
 #define ERROR_SPI_NO_TRANSMISSION_INITIATED             0x2300      // Occurs when no transmission is to be initiated for the RTS-Instruction.
 #define ERROR_SPI_REGISTER_NOT_ALLOWED                  0x2400      // Occurs when the specified register address is not allowed in the BitModify-Instruction.
 #define ERROR_SPI_VALUE_OUTA_RANGE                      0x2500      // Occurs when the specified value for the SPI-Instruction is not within the defined range.
+#define ERROR_MCP2515_NO_CYCLIC_SLOT_FREE               0x2600      // Occurs when no further cyclic Message can be registered.
+#define ERROR_MCP2515_ONE_SHOT_NOT_TRANSMITTED          0x2700      // Occurs when the single attempt of a One-Shot-Transmission was not successful.
+#define ERROR_MCP2515_TX_QUEUE_FULL                     0x2800      // Occurs when no further Frame can be added to the Transmit-Queue.
+#define ERROR_MCP2515_TRANSMIT_TIMEOUT                  0x2900      // Occurs when a Message could not be transmitted within the given Timeout.
+#define ERROR_MCP2515_REGISTER_CACHE_DIVERGED           0x2A00      // Occurs when the Register-Cache differs from the Registers of the MCP2515 (e.g. after a Reset of the MCP2515).
+#define ERROR_MCP2515_BAUDRATE_NOT_DETECTED             0x2B00      // Occurs when none of the Candidates could be detected as Baudrate of the Bus.
+#define ERROR_MCP2515_SNAPSHOT_NOT_VALID                0x2C00      // Occurs when a Configuration-Snapshot has an unknown Version, a wrong Checksum or invalid Values.
+#define ERROR_MCP2515_BUS_OFF                           0x2D00      // Occurs when a Message should be transmitted while the MCP2515 is held Bus-Off (see enableBusStateMonitoring()).
 
 // Secondary Errors
 
@@ -36,6 +44,7 @@
 #define ERROR_MCP2515_INIT_SET_TX_BUFFER_FLAGS          0x0006      // Occurs when the TX buffer flags cannot be set correctly during initialization.
 #define ERROR_MCP2515_INIT_DISABLE_MASKS_FILTERS        0x0007      // Occurs when the mask and filter could not be deactivated during initialization.
 #define ERROR_MCP2515_INIT_SET_NORMAL_MODE              0x0008      // Occurs when the normal operating mode could not be set during initialization.
+#define ERROR_MCP2515_INIT_WRITE_CONFIGURATION          0x0009      // Occurs when the Configuration could not be written during initialization.
 
 #define ERROR_MCP2515_BITMODIFY_INSTRUCTION             0x0010      // Occurs when the BitModify-Instruction failed.
 #define ERROR_MCP2515_CNF1_NOT_SET                      0x0020      // Occurs when the CNF1-Configuration could not be set.
@@ -55,9 +64,12 @@
 #define ERROR_MCP2515_GET_DLC                           0x005A      // Occurs when retrieving the DLC failed.
 #define ERROR_MCP2515_GET_DATA                          0x005B      // Occurs when retrieving the Data failed.
 #define ERROR_MCP2515_GET_ALL_DATA                      0x005C      // Occurs when an error occurs while retrieving all data.
+#define ERROR_MCP2515_CYCLIC_SENDING                    0x005D      // Occurs when a released cyclic Message could not be loaded or requested.
+#define ERROR_MCP2515_SET_FILTERS                       0x005E      // Occurs when the Masks and Filters could not be set.
+#define ERROR_MCP2515_RESTORE_SNAPSHOT                  0x005F      // Occurs when the Configuration could not be restored from a Snapshot.
 
 #define ERROR_MCP2515_MESSAGE_SENDING_ABORTED           0x0060      // Occurs when the send operation was aborted.
-#define ERROR_MCP2515_ERROR_DURING_SENDING              0x0001      // Appended to "ERROR_MCP2515_MESSAGE_SENDING_ABORTED" if the send operation was aborted due to a method error.
+#define ERROR_MCP2515_ERROR_DURING_SENDING              0x0061      // Occurs instead of "ERROR_MCP2515_MESSAGE_SENDING_ABORTED" if the send operation was aborted due to a method error.
 
 #define ERROR_MCP2515_NOT_IMPLEMENTED                   0xFFFF      // Occurs when Method is not implemented yet.
 
@@ -8,7 +8,7 @@
  * @note The Mask and Filter registers read all ‘0’s when in any mode except Configuration mode.
  * @param n Filternumber 0 - 5
  */
-#define REG_RXFnSIDH(n)		(0x00 + (n * 0x04))
+#define REG_RXFnSIDH(n)		(0x00 + (n * 0x04) + ((n > 2) ? 0x04 : 0x00))
 
 /**
  * @brief Standard Identifier Filter bits (R/W-x)
@@ -24,7 +24,7 @@
  * @note The Mask and Filter registers read all ‘0’s when in any mode except Configuration mode.
  * @param n Filternumber 0 - 5
  */
-#define REG_RXFnSIDL(n)		(0x01 + (n * 0x04))
+#define REG_RXFnSIDL(n)		(0x01 + (n * 0x04) + ((n > 2) ? 0x04 : 0x00))
 
 /**
  * @brief Extended Identifier Filter bits (R/W-x)
@@ -56,7 +56,7 @@
  * @note The Mask and Filter registers read all ‘0’s when in any mode except Configuration mode.
  * @param n Filternumber 0 - 5
  */
-#define REG_RXFnEID8(n)		(0x02 + (n * 0x04))
+#define REG_RXFnEID8(n)		(0x02 + (n * 0x04) + ((n > 2) ? 0x04 : 0x00))
 
 /**
  * @brief Extended Identifier bits (R/W-x)
@@ -74,7 +74,7 @@
  * @note The Mask and Filter registers read all ‘0’s when in any mode except Configuration mode.
  * @param n Filternumber 0 - 5
  */
-#define REG_RXFnEID0(n)		(0x03 + (n * 0x04))		// and Register 0x07, 0x0B, 0x13, 0x17, 0x1B => n = 0..5
+#define REG_RXFnEID0(n)		(0x03 + (n * 0x04) + ((n > 2) ? 0x04 : 0x00))		// and Register 0x07, 0x0B, 0x13, 0x17, 0x1B => n = 0..5
 
 /**
  * @brief Extended Identifier bits (R/W-x)